@@ -40,6 +40,14 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(DOXYGEN) || defined(MODULE_CORE_PRIO_WAITQ)
+    /**
+     * @brief   Index of the waiting queue
+     * @note    Only available if module core_prio_waitq is used.
+     * @internal
+     */
+    prio_waitq_t waitq;
+#endif
 #if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
     || defined(MODULE_CORE_MUTEX_DEBUG)
     /**
@@ -141,6 +149,9 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_PRIO_WAITQ
+    mutex->waitq = (prio_waitq_t){ 0 };
+#endif
 }
 
 /**
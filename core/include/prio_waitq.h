@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    core_prio_waitq Priority-indexed wait queues
+ * @ingroup     core
+ * @brief       O(1) insertion into priority-ordered lists of waiting threads
+ *
+ * Threads waiting for a @ref core_sync_mutex "mutex" or for delivering a
+ * blocking @ref core_msg "message" are kept in a singly linked list, sorted by
+ * priority and in FIFO order within a priority. @ref thread_add_to_list()
+ * walks this list with interrupts disabled to find the insertion point, which
+ * gets expensive with many threads contending on the same resource.
+ *
+ * With the module `core_prio_waitq`, these lists get an index similar to the
+ * run queue of the @ref core_sched "scheduler": a bitmap of the priorities
+ * with waiters and a pointer to the last waiter of each priority. Adding a
+ * waiter and removing the one with the highest priority take constant time.
+ * The list itself stays the same, so it is still read from its head.
+ *
+ * The index costs `4 + SCHED_PRIO_LEVELS * sizeof(void *)` bytes in every
+ * @ref mutex_t and every @ref thread_t, so only use it if many threads wait
+ * on the same mutex or send to the same thread.
+ *
+ * A thread stays in the position it was added at when its priority is
+ * changed while waiting, as with @ref thread_add_to_list().
+ *
+ * @{
+ *
+ * @file
+ * @brief       Priority-indexed wait queue API
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "list.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Index of a priority-ordered list of waiting threads
+ *
+ * Must be all zeros while the list is empty.
+ */
+typedef struct {
+    uint32_t bitmap;                        /**< priorities with waiters */
+    list_node_t *tail[SCHED_PRIO_LEVELS];   /**< last waiter per priority */
+} prio_waitq_t;
+
+/**
+ * @brief   Adds a thread to a priority-ordered list, behind all threads with
+ *          the same or a higher priority
+ *
+ * @pre     IRQs are disabled
+ * @pre     @p list was only modified by the functions of this module
+ *
+ * @param[in,out] q         Index of @p list.
+ * @param[in,out] list      Head of the list.
+ * @param[in] thread        Thread to add.
+ */
+void prio_waitq_add(prio_waitq_t *q, list_node_t *list, thread_t *thread);
+
+/**
+ * @brief   Removes the first thread, i.e. the one with the highest priority
+ *          waiting the longest, from a list
+ *
+ * @pre     IRQs are disabled
+ *
+ * @param[in,out] q         Index of @p list.
+ * @param[in,out] list      Head of the list.
+ *
+ * @return  The run queue entry of the removed thread.
+ * @retval  NULL if @p list is empty.
+ */
+list_node_t *prio_waitq_remove_head(prio_waitq_t *q, list_node_t *list);
+
+/**
+ * @brief   Removes a thread from a list
+ *
+ * This walks the list, it is meant for rare operations like cancellation.
+ *
+ * @pre     IRQs are disabled
+ *
+ * @param[in,out] q         Index of @p list.
+ * @param[in,out] list      Head of the list.
+ * @param[in] thread        Thread to remove.
+ *
+ * @retval  true if @p thread was in @p list.
+ * @retval  false otherwise.
+ */
+bool prio_waitq_remove(prio_waitq_t *q, list_node_t *list, thread_t *thread);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
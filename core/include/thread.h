@@ -121,6 +121,9 @@
 #include "clist.h"
 #include "compiler_hints.h"
 #include "msg.h"
+#ifdef MODULE_CORE_PRIO_WAITQ
+#include "prio_waitq.h"
+#endif
 #include "sched.h"
 #include "thread_config.h"
 
@@ -186,6 +189,10 @@ struct _thread {
     list_node_t msg_waiters;        /**< threads waiting for their message
                                          to be delivered to this thread
                                          (i.e. all blocked sends)       */
+#if defined(MODULE_CORE_PRIO_WAITQ) || defined(DOXYGEN)
+    prio_waitq_t msg_waitq;         /**< index of thread_t::msg_waiters,
+                                         see @ref core_prio_waitq       */
+#endif
     cib_t msg_queue;                /**< index of this [thread's message queue]
                                          (thread_t::msg_array), if any  */
     msg_t *msg_array;               /**< memory holding messages sent
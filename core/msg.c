@@ -32,6 +32,9 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#ifdef MODULE_SCHED_TRACE
+#include "sched_trace.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -40,6 +43,17 @@ static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
 
+#ifdef MODULE_SCHED_TRACE
+static void _trace(sched_trace_event_t event, thread_t *thread,
+                   const msg_t *m)
+{
+    unsigned depth = thread_has_msg_queue(thread)
+                   ? cib_avail(&thread->msg_queue) : 0;
+
+    sched_trace_record(event, thread->pid, m->type | (depth << 16));
+}
+#endif
+
 static int queue_msg(thread_t *target, const msg_t *m)
 {
     int n = cib_put(&(target->msg_queue));
@@ -97,6 +111,10 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
 
     thread_t *me = thread_get_active();
 
+#ifdef MODULE_SCHED_TRACE
+    _trace(SCHED_TRACE_MSG_SEND, target, m);
+#endif
+
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
           ". block=%i src->state=%i target->state=%i\n", __FILE__,
           __LINE__, thread_getpid(), target_pid,
@@ -144,7 +162,11 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
 
         sched_set_status(me, newstatus);
 
+#ifdef MODULE_CORE_PRIO_WAITQ
+        prio_waitq_add(&target->msg_waitq, &target->msg_waiters, me);
+#else
         thread_add_to_list(&(target->msg_waiters), me);
+#endif
 
 #if MODULE_CORE_THREAD_FLAGS
         thread_flags_set_internal(target, THREAD_FLAG_MSG_WAITING);
@@ -192,6 +214,10 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+#ifdef MODULE_SCHED_TRACE
+    _trace(SCHED_TRACE_MSG_SEND, target, m);
+#endif
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -349,12 +375,24 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+#ifdef MODULE_SCHED_TRACE
+    if (res > 0) {
+        _trace(SCHED_TRACE_MSG_RECEIVE, thread_get_active(), m);
+    }
+#endif
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+#ifdef MODULE_SCHED_TRACE
+    _trace(SCHED_TRACE_MSG_RECEIVE, thread_get_active(), m);
+#endif
+    return res;
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -387,7 +425,11 @@ static int _msg_receive(msg_t *m, int block)
         me->wait_data = (void *)m;
     }
 
+#ifdef MODULE_CORE_PRIO_WAITQ
+    list_node_t *next = prio_waitq_remove_head(&me->msg_waitq, &me->msg_waiters);
+#else
     list_node_t *next = list_remove_head(&me->msg_waiters);
+#endif
 
     if (next == NULL) {
         DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive(): No thread in "
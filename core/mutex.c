@@ -27,12 +27,51 @@
 #include "sched.h"
 #include "irq.h"
 #include "list.h"
+#ifdef MODULE_SCHED_TRACE
+#include "sched_trace.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 #if MAXTHREADS > 1
 
+static inline void _queue_add(mutex_t *mutex, thread_t *thread)
+{
+#if IS_USED(MODULE_CORE_PRIO_WAITQ)
+    if (mutex->queue.next == MUTEX_LOCKED) {
+        mutex->queue.next = NULL;
+    }
+    prio_waitq_add(&mutex->waitq, &mutex->queue, thread);
+#else
+    if (mutex->queue.next == MUTEX_LOCKED) {
+        mutex->queue.next = (list_node_t *)&thread->rq_entry;
+        mutex->queue.next->next = NULL;
+    }
+    else {
+        thread_add_to_list(&mutex->queue, thread);
+    }
+#endif
+}
+
+static inline list_node_t *_queue_remove_head(mutex_t *mutex)
+{
+#if IS_USED(MODULE_CORE_PRIO_WAITQ)
+    return prio_waitq_remove_head(&mutex->waitq, &mutex->queue);
+#else
+    return list_remove_head(&mutex->queue);
+#endif
+}
+
+static inline bool _queue_remove(mutex_t *mutex, thread_t *thread)
+{
+#if IS_USED(MODULE_CORE_PRIO_WAITQ)
+    return prio_waitq_remove(&mutex->waitq, &mutex->queue, thread);
+#else
+    return list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry) != NULL;
+#endif
+}
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -62,16 +101,14 @@ void _block(mutex_t *mutex,
     /* Fail visibly even if a blocking action is called from somewhere where
      * it's subtly not allowed, eg. board_init */
     assert(me != NULL);
+#ifdef MODULE_SCHED_TRACE
+    sched_trace_record(SCHED_TRACE_MUTEX_WAIT, me->pid,
+                       (uint32_t)(uintptr_t)mutex);
+#endif
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock() Adding node to mutex queue: "
           "prio: %" PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
     sched_set_status(me, STATUS_MUTEX_BLOCKED);
-    if (mutex->queue.next == MUTEX_LOCKED) {
-        mutex->queue.next = (list_node_t *)&me->rq_entry;
-        mutex->queue.next->next = NULL;
-    }
-    else {
-        thread_add_to_list(&mutex->queue, me);
-    }
+    _queue_add(mutex, me);
 
 #ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
     thread_t *owner = thread_get(mutex->owner);
@@ -201,7 +238,7 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
-    list_node_t *next = list_remove_head(&mutex->queue);
+    list_node_t *next = _queue_remove_head(mutex);
 
     thread_t *process = container_of((clist_node_t *)next, thread_t, rq_entry);
 
@@ -241,7 +278,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             mutex->queue.next = NULL;
         }
         else {
-            list_node_t *next = list_remove_head(&mutex->queue);
+            list_node_t *next = _queue_remove_head(mutex);
             thread_t *process = container_of((clist_node_t *)next, thread_t,
                                              rq_entry);
             DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): waking up "
@@ -278,7 +315,7 @@ void mutex_cancel(mutex_cancel_t *mc)
 
     if ((mutex->queue.next != MUTEX_LOCKED)
         && (mutex->queue.next != NULL)
-        && list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry)) {
+        && _queue_remove(mutex, thread)) {
         /* Thread was queued and removed from list, wake it up */
         if (mutex->queue.next == NULL) {
             mutex->queue.next = MUTEX_LOCKED;
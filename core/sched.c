@@ -28,6 +28,9 @@
 #include "sched.h"
 #include "thread.h"
 #include "panic.h"
+#ifdef MODULE_SCHED_TRACE
+#include "sched_trace.h"
+#endif
 
 #ifdef MODULE_MPU_STACK_GUARD
 #include "mpu.h"
@@ -198,6 +201,12 @@ thread_t *__attribute__((used)) sched_run(void)
         sched_active_pid = next_thread->pid;
         sched_active_thread = next_thread;
 
+#ifdef MODULE_SCHED_TRACE
+        sched_trace_record(SCHED_TRACE_SWITCH, next_thread->pid,
+                           previous_thread ? previous_thread->pid
+                                           : KERNEL_PID_UNDEF);
+#endif
+
 #ifdef MODULE_SCHED_CB
         if (sched_cb) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
@@ -263,6 +272,10 @@ void sched_set_status(thread_t *process, thread_status_t status)
 {
     if (status >= STATUS_ON_RUNQUEUE) {
         if (!(process->status >= STATUS_ON_RUNQUEUE)) {
+#ifdef MODULE_SCHED_TRACE
+            sched_trace_record(SCHED_TRACE_READY, process->pid,
+                               process->status);
+#endif
             _runqueue_push(process, process->priority);
         }
     }
@@ -204,6 +204,82 @@ void thread_add_to_list(list_node_t *list, thread_t *thread)
     list->next = new_node;
 }
 
+#ifdef MODULE_CORE_PRIO_WAITQ
+/* The list is sorted by priority, so the waiters of a priority form a run
+ * that ends at q->tail[prio], and the first waiter belongs to the lowest set
+ * bit. The priority a waiter was added with is not stored in the list, as
+ * its current priority might have changed since. */
+void prio_waitq_add(prio_waitq_t *q, list_node_t *list, thread_t *thread)
+{
+    assert(thread->status < STATUS_ON_RUNQUEUE);
+
+    unsigned prio = thread->priority;
+    list_node_t *new_node = (list_node_t *)&thread->rq_entry;
+    list_node_t *prev = list;
+
+    if (q->bitmap & (1UL << prio)) {
+        prev = q->tail[prio];
+    }
+    else {
+        uint32_t higher = q->bitmap & ((1UL << prio) - 1);
+
+        if (higher) {
+            prev = q->tail[bitarithm_msb(higher)];
+        }
+        q->bitmap |= 1UL << prio;
+    }
+
+    new_node->next = prev->next;
+    prev->next = new_node;
+    q->tail[prio] = new_node;
+}
+
+list_node_t *prio_waitq_remove_head(prio_waitq_t *q, list_node_t *list)
+{
+    list_node_t *head = list_remove_head(list);
+
+    if (head) {
+        unsigned prio = bitarithm_lsb(q->bitmap);
+
+        if (q->tail[prio] == head) {
+            q->bitmap &= ~(1UL << prio);
+        }
+    }
+    return head;
+}
+
+bool prio_waitq_remove(prio_waitq_t *q, list_node_t *list, thread_t *thread)
+{
+    list_node_t *node = (list_node_t *)&thread->rq_entry;
+    list_node_t *prev = list;
+    uint32_t groups = q->bitmap;
+    bool first_of_prio = true;
+
+    for (list_node_t *cur = list->next; cur; prev = cur, cur = cur->next) {
+        unsigned prio = bitarithm_lsb(groups);
+        bool last_of_prio = (cur == q->tail[prio]);
+
+        if (cur == node) {
+            prev->next = cur->next;
+            if (last_of_prio) {
+                if (first_of_prio) {
+                    q->bitmap &= ~(1UL << prio);
+                }
+                else {
+                    q->tail[prio] = prev;
+                }
+            }
+            return true;
+        }
+        if (last_of_prio) {
+            groups &= ~(1UL << prio);
+        }
+        first_of_prio = last_of_prio;
+    }
+    return false;
+}
+#endif
+
 uintptr_t measure_stack_free_internal(const char *stack, size_t size)
 {
     /* Alignment of stack has been fixed (if needed) by thread_create(), so
@@ -350,6 +426,9 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 #ifdef MODULE_CORE_MSG
     thread->wait_data = NULL;
     thread->msg_waiters.next = NULL;
+#ifdef MODULE_CORE_PRIO_WAITQ
+    thread->msg_waitq = (prio_waitq_t){ 0 };
+#endif
     cib_init(&(thread->msg_queue), 0);
     thread->msg_array = NULL;
 #endif
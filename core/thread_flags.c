@@ -18,6 +18,9 @@
 #include "thread_flags.h"
 #include "irq.h"
 #include "thread.h"
+#ifdef MODULE_SCHED_TRACE
+#include "sched_trace.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -136,6 +139,9 @@ thread_flags_t thread_flags_wait_all(thread_flags_t mask)
 
 bool thread_flags_set_internal(thread_t *thread, thread_flags_t mask)
 {
+#ifdef MODULE_SCHED_TRACE
+    sched_trace_record(SCHED_TRACE_FLAGS_SET, thread->pid, mask);
+#endif
     thread->flags |= mask;
     return _thread_flags_wake(thread);
 }
@@ -146,6 +152,9 @@ void thread_flags_set(thread_t *thread, thread_flags_t mask)
           mask, thread->pid);
     unsigned state = irq_disable();
 
+#ifdef MODULE_SCHED_TRACE
+    sched_trace_record(SCHED_TRACE_FLAGS_SET, thread->pid, mask);
+#endif
     thread->flags |= mask;
     if (_thread_flags_wake(thread)) {
         irq_restore(state);
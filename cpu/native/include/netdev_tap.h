@@ -34,6 +34,33 @@ extern "C" {
  * @name Low-level ethernet driver for native tap interfaces
  * @{
  */
+/**
+ * @brief   Maximum number of frames received per wakeup of the TAP
+ *
+ * With the default of 1 every frame is announced by its own SIGIO. Larger
+ * values make the driver drain up to this many frames, each read straight
+ * into the buffer provided by the upper layer, before it resumes monitoring
+ * the file descriptor. This saves a signal and a context switch per frame
+ * under load, at the price of a longer run of the network interface thread.
+ */
+#ifndef CONFIG_NETDEV_TAP_RX_BATCH
+#  define CONFIG_NETDEV_TAP_RX_BATCH    1
+#endif
+
+/**
+ * @brief   Let the host complete the transport layer checksums of outgoing
+ *          frames
+ *
+ * If set to 1, the TAP is opened with `IFF_VNET_HDR` (Linux only) and the
+ * driver supports @ref NETOPT_L4_CSUM_OFFLOAD: frames are written with a
+ * `virtio_net_hdr` asking the host kernel to fill in the UDP, TCP, or ICMPv6
+ * checksum, which saves the network stack one pass over every payload it
+ * sends.
+ */
+#ifndef CONFIG_NETDEV_TAP_CSUM_OFFLOAD
+#  define CONFIG_NETDEV_TAP_CSUM_OFFLOAD    0
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -44,6 +71,11 @@ typedef struct netdev_tap {
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     bool promiscuous;                   /**< Flag for promiscuous mode */
     bool wired;                         /**< Flag for wired mode */
+    bool rx_empty;                      /**< No frame was left to read
+                                             (batch receive mode) */
+    bool tx_csum_offload;               /**< Next frame sent needs its
+                                             checksum completed, see
+                                             @ref NETOPT_L4_CSUM_OFFLOAD */
 } netdev_tap_t;
 
 /**
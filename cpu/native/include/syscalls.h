@@ -86,6 +86,7 @@ __SPECIFIER long (*real_ftell)(FILE *stream);
 __SPECIFIER int (*real_fputc)(int c, FILE *stream);
 __SPECIFIER int (*real_fgetc)(FILE *stream);
 __SPECIFIER mode_t (*real_umask)(mode_t cmask);
+__SPECIFIER ssize_t (*real_readv)(int fildes, const struct iovec *iov, int iovcnt);
 __SPECIFIER ssize_t (*real_writev)(int fildes, const struct iovec *iov, int iovcnt);
 __SPECIFIER ssize_t (*real_send)(int sockfd, const void *buf, size_t len, int flags);
 __SPECIFIER off_t (*real_lseek)(int fd, off_t offset, int whence);
@@ -23,6 +23,9 @@
 #include "periph/pm.h"
 
 #include "native_internal.h"
+#ifdef MODULE_SCHED_TRACE
+#include "sched_trace.h"
+#endif
 #include "test_utils/expect.h"
 
 #define ENABLE_DEBUG 0
@@ -261,7 +264,13 @@ void _native_call_sig_handlers_and_switch(void)
 
         if (_native_irq_handlers[sig]) {
             DEBUG_IRQ("call sig handlers + switch: calling interrupt handler for %i\n", sig);
+#ifdef MODULE_SCHED_TRACE
+            sched_trace_isr_enter(sig);
+#endif
             _native_irq_handlers[sig]();
+#ifdef MODULE_SCHED_TRACE
+            sched_trace_isr_exit(sig);
+#endif
         }
         else if (sig == SIGUSR1) {
             warnx("call sig handlers + switch: ignoring SIGUSR1");
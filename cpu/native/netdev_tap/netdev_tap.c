@@ -41,6 +41,18 @@
 #  include <linux/if_ether.h>
 #endif
 
+#include "netdev_tap.h"
+
+#if CONFIG_NETDEV_TAP_CSUM_OFFLOAD && !defined(__FreeBSD__)
+#  include <stddef.h>
+#  include <linux/virtio_net.h>
+#  define _VNET_HDR         1
+#  define _VNET_HDR_LEN     sizeof(struct virtio_net_hdr)
+#else
+#  define _VNET_HDR         0
+#  define _VNET_HDR_LEN     0U
+#endif
+
 #include "native_internal.h"
 
 #include "async_read.h"
@@ -51,8 +63,15 @@
 #include "net/netdev/eth.h"
 #include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
-#include "netdev_tap.h"
 #include "net/netopt.h"
+#if _VNET_HDR
+#include "net/ethertype.h"
+#include "net/icmpv6.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/tcp.h"
+#include "net/udp.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -93,10 +112,25 @@ static inline int _get_wired(netdev_t *netdev)
     return dev->wired;
 }
 
+static void _continue_reading(netdev_tap_t *dev);
+
 static inline void _isr(netdev_t *netdev)
 {
     if (netdev->event_callback) {
-        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        if (CONFIG_NETDEV_TAP_RX_BATCH > 1) {
+            netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+
+            /* drain the TAP until it is empty or the batch is exhausted,
+             * _recv() does not resume reading in this mode */
+            dev->rx_empty = false;
+            for (unsigned i = 0; (i < CONFIG_NETDEV_TAP_RX_BATCH) && !dev->rx_empty; i++) {
+                netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+            }
+            _continue_reading(dev);
+        }
+        else {
+            netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        }
     }
 #if DEVELHELP
     else {
@@ -133,6 +167,13 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
                 res = sizeof(bool);
             }
             break;
+#if _VNET_HDR
+        case NETOPT_L4_CSUM_OFFLOAD:
+            assert(max_len >= sizeof(netopt_enable_t));
+            *((netopt_enable_t *)value) = NETOPT_ENABLE;
+            res = sizeof(netopt_enable_t);
+            break;
+#endif
         default:
             res = netdev_eth_get(dev, opt, value, max_len);
             break;
@@ -156,6 +197,14 @@ static int _set(netdev_t *dev, netopt_t opt, const void *value, size_t value_len
             _set_promiscuous(dev, ((const bool *)value)[0]);
             res = sizeof(netopt_enable_t);
             break;
+#if _VNET_HDR
+        case NETOPT_L4_CSUM_OFFLOAD:
+            assert(value_len >= sizeof(netopt_enable_t));
+            container_of(dev, netdev_tap_t, netdev)->tx_csum_offload =
+                (*((const netopt_enable_t *)value) == NETOPT_ENABLE);
+            res = sizeof(netopt_enable_t);
+            break;
+#endif
         default:
             res = netdev_eth_set(dev, opt, value, value_len);
             break;
@@ -225,6 +274,27 @@ static void _continue_reading(netdev_tap_t *dev)
     _native_pending_syscalls_down();
 }
 
+static ssize_t _read_frame(netdev_tap_t *dev, void *buf, size_t len)
+{
+#if _VNET_HDR
+    /* no offloads are enabled with TUNSETOFFLOAD, so the host always hands
+     * out complete checksums and the header can be skipped */
+    struct virtio_net_hdr vnet_hdr;
+    struct iovec iov[] = {
+        { .iov_base = &vnet_hdr, .iov_len = sizeof(vnet_hdr) },
+        { .iov_base = buf, .iov_len = len },
+    };
+    ssize_t nread = real_readv(dev->tap_fd, iov, ARRAY_SIZE(iov));
+
+    if (nread < 0) {
+        return nread;
+    }
+    return (nread > (ssize_t)_VNET_HDR_LEN) ? nread - (ssize_t)_VNET_HDR_LEN : 0;
+#else
+    return real_read(dev->tap_fd, buf, len);
+#endif
+}
+
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
@@ -243,11 +313,15 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
             }
             */
 
-            static uint8_t nullbuf[ETHERNET_FRAME_LEN];
+            static uint8_t nullbuf[_VNET_HDR_LEN + ETHERNET_FRAME_LEN];
 
-            real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
+            if (real_read(dev->tap_fd, nullbuf, sizeof(nullbuf)) < 0) {
+                dev->rx_empty = true;
+            }
 
-            _continue_reading(dev);
+            if (CONFIG_NETDEV_TAP_RX_BATCH == 1) {
+                _continue_reading(dev);
+            }
         }
 
         /* no way of figuring out packet size without racey buffering,
@@ -255,7 +329,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
         return ETHERNET_FRAME_LEN;
     }
 
-    int nread = real_read(dev->tap_fd, buf, len);
+    int nread = _read_frame(dev, buf, len);
     DEBUG("netdev_tap: read %d bytes\n", nread);
 
     if (nread > 0) {
@@ -268,17 +342,22 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
                   hdr->dst[0], hdr->dst[1], hdr->dst[2],
                   hdr->dst[3], hdr->dst[4], hdr->dst[5]);
 
-            native_async_read_continue(dev->tap_fd);
+            if (CONFIG_NETDEV_TAP_RX_BATCH == 1) {
+                native_async_read_continue(dev->tap_fd);
+            }
 
             return 0;
         }
 
-        _continue_reading(dev);
+        if (CONFIG_NETDEV_TAP_RX_BATCH == 1) {
+            _continue_reading(dev);
+        }
 
         return nread;
     }
     else if (nread == -1) {
         if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            dev->rx_empty = true;
         }
         else {
             err(EXIT_FAILURE, "netdev_tap: read");
@@ -294,16 +373,81 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     return -1;
 }
 
+#if _VNET_HDR
+static uint8_t _iolist_byte(const iolist_t *iolist, size_t offset)
+{
+    while (offset >= iolist->iol_len) {
+        offset -= iolist->iol_len;
+        iolist = iolist->iol_next;
+        assert(iolist != NULL);
+    }
+    return ((const uint8_t *)iolist->iol_base)[offset];
+}
+
+/* asks the host to complete the checksum of the header following the IPv6
+ * header, see NETOPT_L4_CSUM_OFFLOAD */
+static void _vnet_hdr_set_csum(struct virtio_net_hdr *vnet_hdr,
+                               const iolist_t *iolist)
+{
+    const size_t type_pos = offsetof(ethernet_hdr_t, type);
+    const size_t nh_pos = sizeof(ethernet_hdr_t) + offsetof(ipv6_hdr_t, nh);
+    uint16_t csum_offset;
+
+    if (((_iolist_byte(iolist, type_pos) << 8) |
+         _iolist_byte(iolist, type_pos + 1)) != ETHERTYPE_IPV6) {
+        DEBUG("netdev_tap: checksum offload requested for non-IPv6 frame\n");
+        return;
+    }
+    switch (_iolist_byte(iolist, nh_pos)) {
+        case PROTNUM_ICMPV6:
+            csum_offset = offsetof(icmpv6_hdr_t, csum);
+            break;
+        case PROTNUM_TCP:
+            csum_offset = offsetof(tcp_hdr_t, checksum);
+            break;
+        case PROTNUM_UDP:
+            csum_offset = offsetof(udp_hdr_t, checksum);
+            break;
+        default:
+            DEBUG("netdev_tap: no checksum offload for next header %u\n",
+                  _iolist_byte(iolist, nh_pos));
+            return;
+    }
+    vnet_hdr->flags = VIRTIO_NET_HDR_F_NEEDS_CSUM;
+    vnet_hdr->csum_start = sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t);
+    vnet_hdr->csum_offset = csum_offset;
+}
+#endif
+
 static int _send(netdev_t *netdev, const iolist_t *iolist)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
 
+#if _VNET_HDR
+    struct virtio_net_hdr vnet_hdr = { .gso_type = VIRTIO_NET_HDR_GSO_NONE };
+    struct iovec iov[iolist_count(iolist) + 1];
+
+    if (dev->tx_csum_offload) {
+        _vnet_hdr_set_csum(&vnet_hdr, iolist);
+        dev->tx_csum_offload = false;
+    }
+    iov[0].iov_base = &vnet_hdr;
+    iov[0].iov_len = sizeof(vnet_hdr);
+
+    unsigned n;
+    iolist_to_iovec(iolist, &iov[1], &n);
+
+    int res = _native_writev(dev->tap_fd, iov, n + 1);
+
+    return (res > 0) ? res - (int)_VNET_HDR_LEN : res;
+#else
     struct iovec iov[iolist_count(iolist)];
 
     unsigned n;
     iolist_to_iovec(iolist, iov, &n);
 
     return _native_writev(dev->tap_fd, iov, n);
+#endif
 }
 
 void netdev_tap_setup(netdev_tap_t *dev, const netdev_tap_params_t *params, int index) {
@@ -349,6 +493,8 @@ static int _init(netdev_t *netdev)
 # endif
     /* initialize device descriptor */
     dev->promiscuous = 0;
+    dev->rx_empty = true;
+    dev->tx_csum_offload = false;
     /* implicitly create the tap interface */
     if ((dev->tap_fd = real_open(clonedev, O_RDWR | O_NONBLOCK)) == -1) {
         err(EXIT_FAILURE, "open(%s)", clonedev);
@@ -368,6 +514,10 @@ static int _init(netdev_t *netdev)
 # else /* Linux */
     memset(&ifr, 0, sizeof(ifr));
     ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+#  if _VNET_HDR
+    /* frames are prefixed with a struct virtio_net_hdr */
+    ifr.ifr_flags |= IFF_VNET_HDR;
+#  endif
     strncpy(ifr.ifr_name, name, IFNAMSIZ);
     if (real_ioctl(dev->tap_fd, TUNSETIFF, (void *)&ifr) == -1) {
         _native_pending_syscalls_up();
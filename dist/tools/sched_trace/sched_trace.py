@@ -0,0 +1,191 @@
+#! /usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""
+Decodes the output of `sched_trace_dump()` (module `sched_trace`) into a
+Chrome trace (JSON), which can be opened in https://ui.perfetto.dev or
+chrome://tracing, and prints context switch and wakeup latencies.
+"""
+
+import argparse
+import json
+import re
+import statistics
+import sys
+
+TIME, SWITCH, READY, MSG_SEND, MSG_RECEIVE, MUTEX_WAIT, FLAGS_SET, \
+    ISR_ENTER, ISR_EXIT, USER = range(10)
+
+EVENT_NAMES = {
+    MSG_SEND: "msg_send",
+    MSG_RECEIVE: "msg_receive",
+    MUTEX_WAIT: "mutex_wait",
+    FLAGS_SET: "thread_flags_set",
+    USER: "user",
+}
+
+PID = 0     # process ID of all events in the Chrome trace
+ISR_TID = 0     # the ISR track, unused as thread PID by RIOT
+
+RE_BEGIN = re.compile(r"sched_trace: begin (\d+) (\d+) (\d+) us")
+RE_THREAD = re.compile(r"sched_trace: thread (\d+) (\S+)")
+RE_ENTRIES = re.compile(r"sched_trace:((?: [0-9a-f]{16})+)\s*$")
+RE_END = re.compile(r"sched_trace: end")
+
+
+def parse(lines):
+    """Returns (threads, entries, lost) of the last dump in lines.
+
+    entries are (time, event, pid, arg) tuples with absolute times in us.
+    """
+    dump = None
+    result = None
+    for line in lines:
+        if m := RE_BEGIN.search(line):
+            dump = {"last": int(m[3]), "lost": int(m[2]), "threads": {},
+                    "raw": []}
+        elif dump is None:
+            continue
+        elif m := RE_THREAD.search(line):
+            dump["threads"][int(m[1])] = m[2]
+        elif m := RE_ENTRIES.search(line):
+            dump["raw"] += m[1].split()
+        elif RE_END.search(line):
+            result = dump
+    if dump is None:
+        sys.exit("no sched_trace dump found")
+    if result is not dump:
+        print("warning: last dump incomplete", file=sys.stderr)
+        result = dump
+
+    # the delta of an entry is the time since the previous one, so the
+    # absolute times are reconstructed backwards from the newest entry
+    entries = []
+    t = result["last"]
+    for raw in reversed(result["raw"]):
+        delta, event, pid, arg = (int(raw[0:4], 16), int(raw[4:6], 16),
+                                  int(raw[6:8], 16), int(raw[8:16], 16))
+        if event == TIME:
+            t -= arg
+            continue
+        entries.append((t, event, pid, arg))
+        t -= delta
+    entries.reverse()
+    return result["threads"], entries, result["lost"]
+
+
+def to_chrome(threads, entries):
+    """Converts entries to a list of Chrome trace events"""
+    out = []
+
+    def name(pid):
+        return threads.get(pid, "pid {}".format(pid))
+
+    for pid in sorted({e[2] for e in entries if e[1] != ISR_ENTER} |
+                      set(threads)):
+        if pid == ISR_TID:
+            continue
+        out.append({"name": "thread_name", "ph": "M", "pid": PID, "tid": pid,
+                    "args": {"name": "{} ({})".format(name(pid), pid)}})
+        out.append({"name": "thread_sort_index", "ph": "M", "pid": PID,
+                    "tid": pid, "args": {"sort_index": pid}})
+    out.append({"name": "thread_name", "ph": "M", "pid": PID, "tid": ISR_TID,
+                "args": {"name": "ISR"}})
+
+    running = None
+    for t, event, pid, arg in entries:
+        if event == SWITCH:
+            if running is not None:
+                out.append({"name": name(running[0]), "ph": "X", "pid": PID,
+                            "tid": running[0], "ts": running[1],
+                            "dur": t - running[1]})
+            running = (pid, t)
+        elif event == READY:
+            out.append({"name": "ready", "ph": "i", "s": "t", "pid": PID,
+                        "tid": pid, "ts": t, "args": {"status": arg}})
+        elif event == ISR_ENTER:
+            out.append({"name": "irq {}".format(arg), "ph": "B", "pid": PID,
+                        "tid": ISR_TID, "ts": t})
+        elif event == ISR_EXIT:
+            out.append({"name": "irq {}".format(arg), "ph": "E", "pid": PID,
+                        "tid": ISR_TID, "ts": t})
+        elif event in (MSG_SEND, MSG_RECEIVE):
+            depth = arg >> 16
+            out.append({"name": EVENT_NAMES[event], "ph": "i", "s": "t",
+                        "pid": PID, "tid": pid, "ts": t,
+                        "args": {"type": "0x{:04x}".format(arg & 0xffff),
+                                 "queued": depth}})
+            # a send is recorded before the message is queued
+            if event == MSG_SEND:
+                depth += 1
+            out.append({"name": "msg queue {}".format(name(pid)), "ph": "C",
+                        "pid": PID, "ts": t, "args": {"queued": depth}})
+        elif event in EVENT_NAMES:
+            out.append({"name": EVENT_NAMES[event], "ph": "i", "s": "t",
+                        "pid": PID, "tid": pid, "ts": t,
+                        "args": {"arg": "0x{:08x}".format(arg)}})
+    if running is not None and entries:
+        out.append({"name": name(running[0]), "ph": "X", "pid": PID,
+                    "tid": running[0], "ts": running[1],
+                    "dur": entries[-1][0] - running[1]})
+    return out
+
+
+def _stats(values):
+    if not values:
+        return "-"
+    return "n={} mean={:.1f} us max={} us".format(
+        len(values), statistics.mean(values), max(values))
+
+
+def summary(threads, entries, lost):
+    """Prints switch counts and latencies"""
+    switches = {}
+    ready = {}
+    wakeup = []
+    isr_wakeup = []
+    last_isr_exit = None
+    for t, event, pid, arg in entries:
+        if event == READY:
+            ready.setdefault(pid, t)
+        elif event == ISR_EXIT:
+            last_isr_exit = t
+        elif event == SWITCH:
+            switches[pid] = switches.get(pid, 0) + 1
+            if pid in ready:
+                wakeup.append(t - ready.pop(pid))
+                # a thread woken up by an ISR is switched in on its return
+                if last_isr_exit is not None and last_isr_exit <= t:
+                    isr_wakeup.append(t - last_isr_exit)
+            last_isr_exit = None
+
+    span = entries[-1][0] - entries[0][0] if entries else 0
+    print("entries: {} ({} lost), span: {} us".format(len(entries), lost,
+                                                       span))
+    for pid in sorted(switches):
+        print("  {:>3} {:<16} {} switches".format(
+            pid, threads.get(pid, "-"), switches[pid]))
+    print("wakeup latency (ready to running): {}".format(_stats(wakeup)))
+    print("ISR return to switch: {}".format(_stats(isr_wakeup)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("log", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin,
+                        help="output of the node (default: stdin)")
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        help="Chrome trace (JSON) to write")
+    args = parser.parse_args()
+
+    threads, entries, lost = parse(args.log)
+    if args.output:
+        json.dump({"traceEvents": to_chrome(threads, entries),
+                   "displayTimeUnit": "ns"}, args.output)
+    summary(threads, entries, lost)
+
+
+if __name__ == "__main__":
+    main()
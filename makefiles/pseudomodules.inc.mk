@@ -101,10 +101,17 @@ PSEUDOMODULES += credman_load
 PSEUDOMODULES += crypto_aes_128
 PSEUDOMODULES += crypto_aes_192
 PSEUDOMODULES += crypto_aes_256
+# This pseudomodule selects a constant-time AES encryption: bitsliced, or with
+# AES-NI and PCLMULQDQ (for GCM) on x86 if the CPU has them.
+PSEUDOMODULES += crypto_aes_ct
 # By using this pseudomodule, T tables will be precalculated.
 PSEUDOMODULES += crypto_aes_precalculated
 # This pseudomodule causes a loop in AES to be unrolled (more flash, less CPU)
 PSEUDOMODULES += crypto_aes_unroll
+# This pseudomodule computes several ChaCha blocks in parallel with SIMD
+# instructions (SSE2 and AVX2 on x86, NEON on ARM), and Poly1305 in two lanes
+# with SSE2.
+PSEUDOMODULES += crypto_chacha_simd
 
 PSEUDOMODULES += dbgpin
 PSEUDOMODULES += devfs_%
@@ -122,6 +129,13 @@ PSEUDOMODULES += ethos_stdio
 PSEUDOMODULES += event_%
 PSEUDOMODULES += event_timeout
 PSEUDOMODULES += event_timeout_ztimer
+## @defgroup sys_evtimer_heap evtimer_heap
+## @ingroup sys_evtimer
+## @brief   Keeps the events of @ref sys_evtimer in a pairing heap
+##
+## Adding events takes O(log n) instead of O(n) time. Removing an event only
+## searches the events due no later than it.
+PSEUDOMODULES += evtimer_heap
 PSEUDOMODULES += evtimer_mbox
 
 PSEUDOMODULES += fatfs_vfs_format
@@ -170,11 +184,24 @@ PSEUDOMODULES += gnrc_ipv6_nib_6ln
 PSEUDOMODULES += gnrc_ipv6_nib_6lr
 PSEUDOMODULES += gnrc_ipv6_nib_dns
 PSEUDOMODULES += gnrc_ipv6_nib_dyn_lladdr
+## @defgroup net_gnrc_ipv6_nib_lpm gnrc_ipv6_nib_lpm
+## @ingroup net_gnrc_ipv6_nib
+## @brief   Longest-prefix-match trie for the off-link entries of the NIB
+##
+## Enables @ref CONFIG_GNRC_IPV6_NIB_OFFL_LPM.
+PSEUDOMODULES += gnrc_ipv6_nib_lpm
+## @defgroup net_gnrc_ipv6_nib_nc_hash gnrc_ipv6_nib_nc_hash
+## @ingroup net_gnrc_ipv6_nib
+## @brief   Hash index for the neighbor cache of the NIB
+##
+## Enables @ref CONFIG_GNRC_IPV6_NIB_NC_HASH.
+PSEUDOMODULES += gnrc_ipv6_nib_nc_hash
 PSEUDOMODULES += gnrc_ipv6_nib_rio
 PSEUDOMODULES += gnrc_ipv6_nib_router
 PSEUDOMODULES += gnrc_ipv6_nib_rtr_adv_pio_cb
 PSEUDOMODULES += gnrc_lorawan_1_1
 PSEUDOMODULES += gnrc_neterr
+PSEUDOMODULES += gnrc_netapi_batch
 PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
 PSEUDOMODULES += gnrc_netif_bus
@@ -183,6 +210,12 @@ PSEUDOMODULES += gnrc_netif_6lo
 PSEUDOMODULES += gnrc_netif_ipv6
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_dedup
+## @defgroup net_gnrc_netreg_hash gnrc_netreg_hash
+## @ingroup net_gnrc_netreg
+## @brief   Hash index for the demultiplexing contexts of @ref net_gnrc_netreg
+##
+## See @ref CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP.
+PSEUDOMODULES += gnrc_netreg_hash
 
 
 ## @addtogroup 	net_gnrc_nettype
@@ -237,6 +270,19 @@ PSEUDOMODULES += gnrc_nettype_udp
 ## @}
 ## @}
 
+## @defgroup	net_gnrc_pktbuf_static_tlsf gnrc_pktbuf_static_tlsf
+## @ingroup	net_gnrc_pktbuf
+## @brief	Segregated-fit allocator for @ref net_gnrc_pktbuf
+##
+## Replaces the first-fit free list of `gnrc_pktbuf_static` by two-level
+## segregated free lists with bitmap lookup (in the spirit of TLSF). Freeing
+## takes constant time. Allocating does as well, as long as a free block of a
+## larger size class than the request exists. Otherwise the blocks of the
+## request's own size class are searched for one that fits.
+## @{
+PSEUDOMODULES += gnrc_pktbuf_static_tlsf
+## @}
+
 ## @addtogroup	net_gnrc_pktshark
 ## @{
 ## @brief	Enable parsing of IPv6 encapsulated IPv4 packets
@@ -253,6 +299,20 @@ PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
 PSEUDOMODULES += gnrc_sixlowpan_frag_hint
+## @defgroup net_gnrc_sixlowpan_frag_rb_bitmap gnrc_sixlowpan_frag_rb_bitmap
+## @ingroup net_gnrc_sixlowpan_frag_rb
+## @brief   Track received fragments with a bitmap per reassembly buffer entry
+##
+## Replaces the shared pool of fragment intervals. Not usable with
+## @ref net_gnrc_sixlowpan_frag_sfr, whose fragments are not aligned to 8 bytes.
+## See @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MAX_DATAGRAM_SIZE.
+PSEUDOMODULES += gnrc_sixlowpan_frag_rb_bitmap
+## @defgroup net_gnrc_sixlowpan_frag_rb_hash gnrc_sixlowpan_frag_rb_hash
+## @ingroup net_gnrc_sixlowpan_frag_rb
+## @brief   Hash index for the (virtual) reassembly buffer
+##
+## See @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE.
+PSEUDOMODULES += gnrc_sixlowpan_frag_rb_hash
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_in
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_out
@@ -292,13 +352,57 @@ PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_quic
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_sfr
 ## @}
 ## @}
+## @defgroup net_gnrc_sixlowpan_iphc_cache gnrc_sixlowpan_iphc_cache
+## @ingroup net_gnrc_sixlowpan_iphc
+## @brief   Cache the compressed addresses of outgoing IPHC headers per flow
+##
+## Packets to the same source, destination, and link-layer destination on the
+## same interface reuse the compressed addresses of the previous packet instead
+## of looking up the compression contexts and interface identifiers again. See
+## @ref CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE.
+PSEUDOMODULES += gnrc_sixlowpan_iphc_cache
 PSEUDOMODULES += gnrc_sixlowpan_iphc_nhc
 PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+## @defgroup net_gnrc_tcp_gro gnrc_tcp_gro
+## @ingroup net_gnrc_tcp
+## @brief   Receive-side coalescing of in-order segments for @ref net_gnrc_tcp
+##
+## In-order segments received back-to-back are coalesced into the receive
+## buffer under a single ACK and a single notification of the user, see
+## @ref CONFIG_GNRC_TCP_GRO_SEGS_MAX.
+PSEUDOMODULES += gnrc_tcp_gro
+## @defgroup net_gnrc_tcp_gso gnrc_tcp_gso
+## @ingroup net_gnrc_tcp
+## @brief   Send-side segmentation offload for @ref net_gnrc_tcp
+##
+## Bulk data is handed down as one super-segment of up to
+## @ref CONFIG_GNRC_TCP_GSO_SEGS segments, which @ref net_gnrc_netif_gso
+## splits right before it is sent.
+PSEUDOMODULES += gnrc_tcp_gso
+## @defgroup net_gnrc_tcp_sack gnrc_tcp_sack
+## @ingroup net_gnrc_tcp
+## @brief   Selective acknowledgments and fast retransmit for @ref net_gnrc_tcp
+##
+## Segments received out of order are held until the gap before them is
+## filled and reported to the peer in SACK options (RFC 2018), see
+## @ref CONFIG_GNRC_TCP_OOO_QUEUE_SIZE. Duplicate ACKs trigger a fast
+## retransmit of the unacknowledged data instead of waiting for the
+## retransmission timeout.
+PSEUDOMODULES += gnrc_tcp_sack
 PSEUDOMODULES += gnrc_txtsnd
 
+## @defgroup sys_hashes_sha2_accel hashes_sha2_accel
+## @ingroup sys_hashes_unkeyed
+## @brief   Uses the SHA instructions of the CPU for SHA-224 and SHA-256
+##
+## The x86 SHA extensions (e.g. on native, checked at runtime) and the ARMv8
+## cryptography extensions (if enabled for the compiler) are supported. On
+## other CPUs, the portable implementation is used.
+PSEUDOMODULES += hashes_sha2_accel
+
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
 PSEUDOMODULES += ipv4
@@ -686,6 +790,27 @@ PSEUDOMODULES += ztimer64_%
 ## `tests/sys/ztimer_overhead`.
 PSEUDOMODULES += ztimer_auto_adjust
 
+## @defgroup pseudomodule_ztimer_slack ztimer_slack
+## @brief Coalesce ztimer timers that may fire late into one interrupt
+##
+## When this module is active, timers can be set with a slack using
+## ztimer_set_with_slack(). The backend alarm of a clock is set to the latest
+## time within the slack of all timers due until then, so that they fire in one
+## interrupt. This costs one word per timer and two words per clock. See
+## @ref sys_ztimer for details.
+PSEUDOMODULES += ztimer_slack
+
+## @defgroup pseudomodule_ztimer_wheel ztimer_wheel
+## @brief Store ztimer timers in a hierarchical timing wheel
+##
+## When this module is active, each ztimer clock with more than
+## CONFIG_ZTIMER_WHEEL_LIST_LEN active timers keeps only the timers due
+## within the next 2^CONFIG_ZTIMER_WHEEL_NEAR_BITS ticks in its sorted list.
+## All other timers are hashed into wheel slots, so ztimer_set() and
+## ztimer_remove() no longer walk a list of all active timers. This costs
+## roughly 700 bytes of RAM per clock. See @ref sys_ztimer for details.
+PSEUDOMODULES += ztimer_wheel
+
 # ztimer's main module is called "ztimer_core"
 NO_PSEUDOMODULES += ztimer_core
 
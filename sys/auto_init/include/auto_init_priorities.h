@@ -55,6 +55,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS              1050
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_SCHED_TRACE
+/**
+ * @brief   scheduler event trace priority
+ */
+#define AUTO_INIT_PRIO_MOD_SCHED_TRACE                  1055
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN
 /**
  * @brief   round robin scheduling priority
@@ -74,7 +74,8 @@ static const cipher_interface_t aes_interface = {
     AES_BLOCK_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    aes_encrypt_blocks
 };
 
 const cipher_id_t CIPHER_AES = &aes_interface;
@@ -841,9 +842,11 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
 
     /* Make sure that context is large enough. If this is not the case,
        you should build with -DAES */
+#if CIPHER_MAX_CONTEXT_SIZE < UINT8_MAX
     if (CIPHER_MAX_CONTEXT_SIZE < keySize) {
         return CIPHER_ERR_BAD_CONTEXT_SIZE;
     }
+#endif
 
     /* key must be at least CIPHERS_MAX_KEY_SIZE Bytes long */
     if (keySize < CIPHERS_MAX_KEY_SIZE) {
@@ -858,6 +861,11 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
         }
     }
 
+#if IS_USED(MODULE_CRYPTO_AES_CT)
+    /* the schedule follows the key, which decryption still uses */
+    aes_ct_init(context->context + CIPHERS_MAX_KEY_SIZE, key, keySize);
+#endif
+
     return CIPHER_INIT_SUCCESS;
 }
 
@@ -1058,24 +1066,28 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
 }
 
 #ifndef AES_ASM
-/*
- * Encrypt a single block
- * in and out can overlap
- */
+#if IS_USED(MODULE_CRYPTO_AES_CT)
 int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
                 uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    aes_key_t aeskey;
-    const aes_key_t *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE(context) * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
 
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t numof)
+{
+    aes_ct_encrypt_blocks(context->context + CIPHERS_MAX_KEY_SIZE,
+                          AES_KEY_SIZE(context), plain, cipher, numof);
+    return 1;
+}
+#else /* IS_USED(MODULE_CRYPTO_AES_CT) */
+/*
+ * Encrypt a single block with an expanded key
+ * in and out can overlap
+ */
+static void aes_encrypt_block(const aes_key_t *key, const uint8_t *plainBlock,
+                              uint8_t *cipherBlock)
+{
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1324,8 +1336,38 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
+}
+
+/*
+ * Encrypt a single block
+ * in and out can overlap
+ */
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
+{
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
+
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t numof)
+{
+    /* setup AES_KEY once for all blocks */
+    int res;
+    aes_key_t aeskey;
+
+    res = aes_set_encrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE(context) * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+
+    for (size_t i = 0; i < numof; i++) {
+        aes_encrypt_block(&aeskey, plain + (i * AES_BLOCK_SIZE),
+                          cipher + (i * AES_BLOCK_SIZE));
+    }
     return 1;
 }
+#endif /* IS_USED(MODULE_CRYPTO_AES_CT) */
 
 /*
  * Decrypt a single block
@@ -0,0 +1,472 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       Constant-time AES encryption
+ *
+ * The bitsliced kernel follows the aes_ct design of BearSSL: two blocks are
+ * spread over eight 32-bit words, one word per bit of each byte, and the
+ * S-box is the circuit of Boyar and Peralta, so neither memory accesses nor
+ * branches depend on the key or the data. On x86, the AES instructions are
+ * used instead if the CPU has them.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto/aes.h"
+#include "crypto/helper.h"
+#include "modules.h"
+
+#if IS_USED(MODULE_CRYPTO_AES_CT)
+
+#if defined(__x86_64__) || defined(__i386__)
+#  define AES_CT_AESNI      1
+#  include <cpuid.h>
+#  include <immintrin.h>
+#endif
+
+static inline uint32_t _dec32le(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void _enc32le(uint8_t *p, uint32_t x)
+{
+    p[0] = x;
+    p[1] = x >> 8;
+    p[2] = x >> 16;
+    p[3] = x >> 24;
+}
+
+/* transposes the 8x8 bit matrices of the state, converting between blocks
+ * and bitsliced form in both directions */
+static void _ortho(uint32_t *q)
+{
+#define SWAPN(cl, ch, s, x, y) do { \
+        uint32_t a = (x), b = (y); \
+        (x) = (a & (uint32_t)(cl)) | ((b & (uint32_t)(cl)) << (s)); \
+        (y) = ((a & (uint32_t)(ch)) >> (s)) | (b & (uint32_t)(ch)); \
+    } while (0)
+#define SWAP2(x, y) SWAPN(0x55555555, 0xAAAAAAAA, 1, x, y)
+#define SWAP4(x, y) SWAPN(0x33333333, 0xCCCCCCCC, 2, x, y)
+#define SWAP8(x, y) SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, x, y)
+
+    SWAP2(q[0], q[1]);
+    SWAP2(q[2], q[3]);
+    SWAP2(q[4], q[5]);
+    SWAP2(q[6], q[7]);
+
+    SWAP4(q[0], q[2]);
+    SWAP4(q[1], q[3]);
+    SWAP4(q[4], q[6]);
+    SWAP4(q[5], q[7]);
+
+    SWAP8(q[0], q[4]);
+    SWAP8(q[1], q[5]);
+    SWAP8(q[2], q[6]);
+    SWAP8(q[3], q[7]);
+
+#undef SWAP8
+#undef SWAP4
+#undef SWAP2
+#undef SWAPN
+}
+
+/* the AES S-box on all 32 bytes at once, as a circuit of 113 gates */
+static void _sbox(uint32_t *q)
+{
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint32_t y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* top linear transformation */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* non-linear section */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* bottom linear transformation */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+static void _shift_rows(uint32_t *q)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+
+        q[i] = (x & 0x000000FF)
+               | ((x & 0x0000FC00) >> 2) | ((x & 0x00000300) << 6)
+               | ((x & 0x00F00000) >> 4) | ((x & 0x000F0000) << 4)
+               | ((x & 0xC0000000) >> 6) | ((x & 0x3F000000) << 2);
+    }
+}
+
+static inline uint32_t _rotr16(uint32_t x)
+{
+    return (x << 16) | (x >> 16);
+}
+
+static void _mix_columns(uint32_t *q)
+{
+    uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+    uint32_t r0 = (q0 >> 8) | (q0 << 24);
+    uint32_t r1 = (q1 >> 8) | (q1 << 24);
+    uint32_t r2 = (q2 >> 8) | (q2 << 24);
+    uint32_t r3 = (q3 >> 8) | (q3 << 24);
+    uint32_t r4 = (q4 >> 8) | (q4 << 24);
+    uint32_t r5 = (q5 >> 8) | (q5 << 24);
+    uint32_t r6 = (q6 >> 8) | (q6 << 24);
+    uint32_t r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q7 ^ r7 ^ r0 ^ _rotr16(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ _rotr16(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ _rotr16(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ _rotr16(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ _rotr16(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ _rotr16(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ _rotr16(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ _rotr16(q7 ^ r7);
+}
+
+/* the schedule is part of the cipher context, which is not aligned */
+static inline void _add_round_key(uint32_t *q, const uint8_t *sk)
+{
+    uint32_t k[8];
+
+    memcpy(k, sk, sizeof(k));
+    for (unsigned i = 0; i < 8; i++) {
+        q[i] ^= k[i];
+    }
+}
+
+static uint32_t _sub_word(uint32_t x)
+{
+    uint32_t q[8] = { x };
+
+    _ortho(q);
+    _sbox(q);
+    _ortho(q);
+    return q[0];
+}
+
+static void _encrypt_blocks_ct(const uint8_t *schedule, unsigned rounds,
+                               const uint8_t *in, uint8_t *out, size_t numof)
+{
+    while (numof) {
+        uint32_t q[8] = { 0 };
+        unsigned n = (numof > 1) ? 2 : 1;
+
+        for (unsigned k = 0; k < 4; k++) {
+            q[2 * k] = _dec32le(in + 4 * k);
+            if (n == 2) {
+                q[2 * k + 1] = _dec32le(in + AES_BLOCK_SIZE + 4 * k);
+            }
+        }
+        _ortho(q);
+
+        _add_round_key(q, schedule);
+        for (unsigned r = 1; r < rounds; r++) {
+            _sbox(q);
+            _shift_rows(q);
+            _mix_columns(q);
+            _add_round_key(q, schedule + (r * AES_CT_ROUND_KEY_SIZE));
+        }
+        _sbox(q);
+        _shift_rows(q);
+        _add_round_key(q, schedule + (rounds * AES_CT_ROUND_KEY_SIZE));
+
+        _ortho(q);
+        for (unsigned k = 0; k < 4; k++) {
+            _enc32le(out + 4 * k, q[2 * k]);
+            if (n == 2) {
+                _enc32le(out + AES_BLOCK_SIZE + 4 * k, q[2 * k + 1]);
+            }
+        }
+
+        in += n * AES_BLOCK_SIZE;
+        out += n * AES_BLOCK_SIZE;
+        numof -= n;
+    }
+}
+
+#if AES_CT_AESNI
+static bool _has_aesni(void)
+{
+    /* CPUID is slow, so it is only asked once */
+    static int8_t has_aesni = -1;
+
+    if (has_aesni < 0) {
+        unsigned eax, ebx, ecx, edx;
+
+        has_aesni = __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_AES);
+    }
+    return has_aesni;
+}
+
+/* four blocks at a time, as aesenc has a latency of several cycles */
+__attribute__((target("aes,sse2")))
+static void _encrypt_blocks_aesni(const uint8_t *schedule, unsigned rounds,
+                                  const uint8_t *in, uint8_t *out,
+                                  size_t numof)
+{
+    __m128i rk[AES_MAXNR + 1];
+
+    for (unsigned r = 0; r <= rounds; r++) {
+        rk[r] = _mm_loadu_si128((const __m128i *)(schedule + 16 * r));
+    }
+
+    for (; numof >= 4; numof -= 4, in += 64, out += 64) {
+        __m128i b0 = _mm_loadu_si128((const __m128i *)in);
+        __m128i b1 = _mm_loadu_si128((const __m128i *)(in + 16));
+        __m128i b2 = _mm_loadu_si128((const __m128i *)(in + 32));
+        __m128i b3 = _mm_loadu_si128((const __m128i *)(in + 48));
+
+        b0 = _mm_xor_si128(b0, rk[0]);
+        b1 = _mm_xor_si128(b1, rk[0]);
+        b2 = _mm_xor_si128(b2, rk[0]);
+        b3 = _mm_xor_si128(b3, rk[0]);
+        for (unsigned r = 1; r < rounds; r++) {
+            b0 = _mm_aesenc_si128(b0, rk[r]);
+            b1 = _mm_aesenc_si128(b1, rk[r]);
+            b2 = _mm_aesenc_si128(b2, rk[r]);
+            b3 = _mm_aesenc_si128(b3, rk[r]);
+        }
+        b0 = _mm_aesenclast_si128(b0, rk[rounds]);
+        b1 = _mm_aesenclast_si128(b1, rk[rounds]);
+        b2 = _mm_aesenclast_si128(b2, rk[rounds]);
+        b3 = _mm_aesenclast_si128(b3, rk[rounds]);
+        _mm_storeu_si128((__m128i *)out, b0);
+        _mm_storeu_si128((__m128i *)(out + 16), b1);
+        _mm_storeu_si128((__m128i *)(out + 32), b2);
+        _mm_storeu_si128((__m128i *)(out + 48), b3);
+    }
+
+    for (; numof; numof--, in += 16, out += 16) {
+        __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in), rk[0]);
+
+        for (unsigned r = 1; r < rounds; r++) {
+            b = _mm_aesenc_si128(b, rk[r]);
+        }
+        _mm_storeu_si128((__m128i *)out, _mm_aesenclast_si128(b, rk[rounds]));
+    }
+}
+#endif /* AES_CT_AESNI */
+
+void aes_ct_init(uint8_t *schedule, const uint8_t *key, uint8_t key_size)
+{
+    uint32_t w[4 * (AES_MAXNR + 1)];
+    unsigned nk = key_size / 4;
+    unsigned rounds = nk + 6;
+    uint32_t rcon = 1;
+
+    /* FIPS 197 key expansion, with the words loaded little-endian */
+    for (unsigned i = 0; i < nk; i++) {
+        w[i] = _dec32le(key + 4 * i);
+    }
+    for (unsigned i = nk; i < 4 * (rounds + 1); i++) {
+        uint32_t tmp = w[i - 1];
+
+        if ((i % nk) == 0) {
+            tmp = _sub_word((tmp << 24) | (tmp >> 8)) ^ rcon;
+            rcon = (rcon << 1) ^ (0x11b & -(rcon >> 7));
+        }
+        else if ((nk > 6) && ((i % nk) == 4)) {
+            tmp = _sub_word(tmp);
+        }
+        w[i] = w[i - nk] ^ tmp;
+    }
+
+#if AES_CT_AESNI
+    if (_has_aesni()) {
+        for (unsigned i = 0; i < 4 * (rounds + 1); i++) {
+            _enc32le(schedule + 4 * i, w[i]);
+        }
+        crypto_secure_wipe(w, sizeof(w));
+        return;
+    }
+#endif
+
+    /* each round key is bitsliced as both blocks of the state */
+    for (unsigned r = 0; r <= rounds; r++) {
+        uint32_t q[8];
+
+        for (unsigned k = 0; k < 4; k++) {
+            q[2 * k] = w[4 * r + k];
+            q[2 * k + 1] = w[4 * r + k];
+        }
+        _ortho(q);
+        memcpy(schedule + (r * AES_CT_ROUND_KEY_SIZE), q, sizeof(q));
+    }
+    crypto_secure_wipe(w, sizeof(w));
+}
+
+void aes_ct_encrypt_blocks(const uint8_t *schedule, uint8_t key_size,
+                           const uint8_t *in, uint8_t *out, size_t numof)
+{
+    unsigned rounds = key_size / 4 + 6;
+
+#if AES_CT_AESNI
+    if (_has_aesni()) {
+        _encrypt_blocks_aesni(schedule, rounds, in, out, numof);
+        return;
+    }
+#endif
+    _encrypt_blocks_ct(schedule, rounds, in, out, numof);
+}
+
+#endif /* IS_USED(MODULE_CRYPTO_AES_CT) */
@@ -32,14 +32,27 @@
 
 #include "crypto/chacha.h"
 #include "byteorder.h"
+#include "modules.h"
 
 #if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
 #   error \
     "This code is implementented in a way that it will only work for little-endian systems!"
 #endif
 
+#include <stdbool.h>
 #include <string.h>
 
+#if IS_USED(MODULE_CRYPTO_CHACHA_SIMD)
+#  if defined(__SSE2__)
+#    define CHACHA_SSE2     1
+#    include <cpuid.h>
+#    include <immintrin.h>
+#  elif defined(__ARM_NEON)
+#    define CHACHA_NEON     1
+#    include <arm_neon.h>
+#  endif
+#endif
+
 static void _r(uint32_t *d, uint32_t *a, const uint32_t *b, unsigned c)
 {
     *a += *b;
@@ -115,6 +128,211 @@ void chacha_keystream_bytes(chacha_ctx *ctx, void *x)
     }
 }
 
+#if defined(CHACHA_SSE2) || defined(CHACHA_NEON)
+/* The multi-block kernels hold word i of all blocks in the lanes of one
+ * vector, so a quarter round works on all blocks at once. The counter is
+ * added per lane, the caller makes sure its low word does not wrap. */
+#define QR(add, xor, rotl, x, a, b, c, d)                       \
+    do {                                                        \
+        x[a] = add(x[a], x[b]); x[d] = rotl(xor(x[d], x[a]), 16); \
+        x[c] = add(x[c], x[d]); x[b] = rotl(xor(x[b], x[c]), 12); \
+        x[a] = add(x[a], x[b]); x[d] = rotl(xor(x[d], x[a]),  8); \
+        x[c] = add(x[c], x[d]); x[b] = rotl(xor(x[b], x[c]),  7); \
+    } while (0)
+
+#define DOUBLEROUND(add, xor, rotl, x)                          \
+    do {                                                        \
+        QR(add, xor, rotl, x, 0, 4,  8, 12);                    \
+        QR(add, xor, rotl, x, 1, 5,  9, 13);                    \
+        QR(add, xor, rotl, x, 2, 6, 10, 14);                    \
+        QR(add, xor, rotl, x, 3, 7, 11, 15);                    \
+        QR(add, xor, rotl, x, 0, 5, 10, 15);                    \
+        QR(add, xor, rotl, x, 1, 6, 11, 12);                    \
+        QR(add, xor, rotl, x, 2, 7,  8, 13);                    \
+        QR(add, xor, rotl, x, 3, 4,  9, 14);                    \
+    } while (0)
+#endif
+
+#ifdef CHACHA_SSE2
+#define SSE2_ROTL(v, n) \
+    _mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - (n)))
+
+/* stores words i to i + 3 of four blocks, held by x[i] to x[i + 3] */
+static void _store4_sse2(uint8_t *out, const __m128i *x)
+{
+    __m128i t0 = _mm_unpacklo_epi32(x[0], x[1]);
+    __m128i t1 = _mm_unpacklo_epi32(x[2], x[3]);
+    __m128i t2 = _mm_unpackhi_epi32(x[0], x[1]);
+    __m128i t3 = _mm_unpackhi_epi32(x[2], x[3]);
+
+    _mm_storeu_si128((__m128i *)(out + 0 * 64), _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *)(out + 1 * 64), _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *)(out + 2 * 64), _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128((__m128i *)(out + 3 * 64), _mm_unpackhi_epi64(t2, t3));
+}
+
+static void _blocks4_sse2(const uint32_t state[16], unsigned rounds,
+                          uint8_t *out)
+{
+    __m128i s[16];
+    __m128i x[16];
+
+    for (unsigned i = 0; i < 16; i++) {
+        s[i] = _mm_set1_epi32(state[i]);
+    }
+    s[12] = _mm_add_epi32(s[12], _mm_set_epi32(3, 2, 1, 0));
+    memcpy(x, s, sizeof(x));
+
+    for (unsigned i = 0; i < rounds; i += 2) {
+        DOUBLEROUND(_mm_add_epi32, _mm_xor_si128, SSE2_ROTL, x);
+    }
+
+    for (unsigned i = 0; i < 16; i++) {
+        x[i] = _mm_add_epi32(x[i], s[i]);
+    }
+    for (unsigned i = 0; i < 16; i += 4) {
+        _store4_sse2(out + 4 * i, &x[i]);
+    }
+}
+
+static bool _has_avx2(void)
+{
+    /* CPUID is slow, so it is only asked once */
+    static int8_t has_avx2 = -1;
+
+    if (has_avx2 < 0) {
+        unsigned eax, ebx, ecx, edx;
+
+        has_avx2 = 0;
+        /* the OS must also save the upper halves of the registers */
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_OSXSAVE) &&
+            __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) &&
+            (ebx & bit_AVX2)) {
+            uint32_t xcr0_lo, xcr0_hi;
+
+            __asm__ volatile ("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+            (void)xcr0_hi;
+            has_avx2 = (xcr0_lo & 0x6) == 0x6;
+        }
+    }
+    return has_avx2;
+}
+
+#define AVX2_ROTL(v, n) \
+    _mm256_or_si256(_mm256_slli_epi32(v, n), _mm256_srli_epi32(v, 32 - (n)))
+
+/* as _blocks4_sse2(), the upper halves of the vectors hold blocks 4 to 7 */
+__attribute__((target("avx2")))
+static void _blocks8_avx2(const uint32_t state[16], unsigned rounds,
+                          uint8_t *out)
+{
+    __m256i s[16];
+    __m256i x[16];
+
+    for (unsigned i = 0; i < 16; i++) {
+        s[i] = _mm256_set1_epi32(state[i]);
+    }
+    s[12] = _mm256_add_epi32(s[12], _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    memcpy(x, s, sizeof(x));
+
+    for (unsigned i = 0; i < rounds; i += 2) {
+        DOUBLEROUND(_mm256_add_epi32, _mm256_xor_si256, AVX2_ROTL, x);
+    }
+
+    for (unsigned i = 0; i < 16; i += 4) {
+        __m256i a = _mm256_add_epi32(x[i + 0], s[i + 0]);
+        __m256i b = _mm256_add_epi32(x[i + 1], s[i + 1]);
+        __m256i c = _mm256_add_epi32(x[i + 2], s[i + 2]);
+        __m256i d = _mm256_add_epi32(x[i + 3], s[i + 3]);
+        __m256i t0 = _mm256_unpacklo_epi32(a, b);
+        __m256i t1 = _mm256_unpacklo_epi32(c, d);
+        __m256i t2 = _mm256_unpackhi_epi32(a, b);
+        __m256i t3 = _mm256_unpackhi_epi32(c, d);
+        __m256i w[4] = {
+            _mm256_unpacklo_epi64(t0, t1), _mm256_unpackhi_epi64(t0, t1),
+            _mm256_unpacklo_epi64(t2, t3), _mm256_unpackhi_epi64(t2, t3),
+        };
+
+        for (unsigned j = 0; j < 4; j++) {
+            _mm_storeu_si128((__m128i *)(out + j * 64 + 4 * i),
+                             _mm256_castsi256_si128(w[j]));
+            _mm_storeu_si128((__m128i *)(out + (j + 4) * 64 + 4 * i),
+                             _mm256_extracti128_si256(w[j], 1));
+        }
+    }
+}
+
+/* returns the number of blocks written, up to numof but at least four */
+static size_t _blocks_simd(const uint32_t state[16], unsigned rounds,
+                           uint8_t *out, size_t numof)
+{
+    if ((numof >= 8) && _has_avx2()) {
+        _blocks8_avx2(state, rounds, out);
+        return 8;
+    }
+    _blocks4_sse2(state, rounds, out);
+    return 4;
+}
+#endif /* CHACHA_SSE2 */
+
+#ifdef CHACHA_NEON
+#define NEON_ROTL(v, n) vsliq_n_u32(vshrq_n_u32(v, 32 - (n)), v, n)
+
+static size_t _blocks_simd(const uint32_t state[16], unsigned rounds,
+                           uint8_t *out, size_t numof)
+{
+    static const uint32_t lanes[4] = { 0, 1, 2, 3 };
+    uint32x4_t s[16];
+    uint32x4_t x[16];
+
+    (void)numof;
+    for (unsigned i = 0; i < 16; i++) {
+        s[i] = vdupq_n_u32(state[i]);
+    }
+    s[12] = vaddq_u32(s[12], vld1q_u32(lanes));
+    memcpy(x, s, sizeof(x));
+
+    for (unsigned i = 0; i < rounds; i += 2) {
+        DOUBLEROUND(vaddq_u32, veorq_u32, NEON_ROTL, x);
+    }
+
+    for (unsigned i = 0; i < 16; i += 4) {
+        uint32x4x4_t w = { {
+            vaddq_u32(x[i + 0], s[i + 0]), vaddq_u32(x[i + 1], s[i + 1]),
+            vaddq_u32(x[i + 2], s[i + 2]), vaddq_u32(x[i + 3], s[i + 3]),
+        } };
+        uint32_t tmp[16];
+
+        /* interleaving gives words i to i + 3 of each block in turn */
+        vst4q_u32(tmp, w);
+        for (unsigned j = 0; j < 4; j++) {
+            memcpy(out + j * 64 + 4 * i, &tmp[4 * j], 16);
+        }
+    }
+    return 4;
+}
+#endif /* CHACHA_NEON */
+
+void chacha_keystream_blocks(chacha_ctx *ctx, void *x, size_t numof)
+{
+    uint8_t *out = x;
+
+#if defined(CHACHA_SSE2) || defined(CHACHA_NEON)
+    /* the lanes only add to the low word of the counter, blocks at which it
+     * wraps are left to the single block code */
+    while ((numof >= 4) && (ctx->state[12] <= UINT32_MAX - 8)) {
+        size_t done = _blocks_simd(ctx->state, ctx->rounds, out, numof);
+
+        ctx->state[12] += done;
+        out += done * 64;
+        numof -= done;
+    }
+#endif
+    for (; numof > 0; numof--, out += 64) {
+        chacha_keystream_bytes(ctx, out);
+    }
+}
+
 void chacha_encrypt_bytes(chacha_ctx *ctx, const uint8_t *m, uint8_t *c)
 {
     uint8_t x[64];
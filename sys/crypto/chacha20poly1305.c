@@ -16,13 +16,16 @@
  * @}
  */
 
+#include <stdalign.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
 
 #include "crypto/helper.h"
+#include "crypto/chacha.h"
 #include "crypto/chacha20poly1305.h"
 #include "crypto/poly1305.h"
+#include "modules.h"
 #include "unaligned.h"
 
 /* Missing operations to convert numbers to little endian prevents this from
@@ -40,72 +43,57 @@ static const uint32_t constant[] = {0x61707865,
 /* Padding to add to the poly1305 authentication tag */
 static const uint8_t padding[15] = {0};
 
-/* Single round */
-static void _r(uint32_t *a, uint32_t *b, uint32_t *d, unsigned c)
-{
-    *a += *b;
-    uint32_t tmp = *a ^ *d;
-    *d = (tmp << c) | (tmp >> (32 - c));
-}
+/* Blocks of keystream generated at once, enough to fill all SIMD lanes */
+#if IS_USED(MODULE_CRYPTO_CHACHA_SIMD)
+#define XCRYPT_BLOCKS   (8U)
+#else
+#define XCRYPT_BLOCKS   (1U)
+#endif
 
-static void _add_initial(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                         const uint8_t *nonce, uint32_t blk)
+static void _init(chacha_ctx *ctx, const uint8_t *key, const uint8_t *nonce,
+                  uint32_t blk)
 {
     for (unsigned i = 0; i < 4; i++) {
-        ctx->state[i] += constant[i];
+        ctx->state[i] = constant[i];
     }
     for (unsigned i = 0; i < 8; i++) {
-        ctx->state[i+4] += unaligned_get_u32(key + 4*i);
+        ctx->state[i+4] = unaligned_get_u32(key + 4*i);
     }
-    ctx->state[12] += unaligned_get_u32((uint8_t*)&blk);
-    ctx->state[13] += unaligned_get_u32(nonce);
-    ctx->state[14] += unaligned_get_u32(nonce+4);
-    ctx->state[15] += unaligned_get_u32(nonce+8);
+    ctx->state[12] = blk;
+    ctx->state[13] = unaligned_get_u32(nonce);
+    ctx->state[14] = unaligned_get_u32(nonce+4);
+    ctx->state[15] = unaligned_get_u32(nonce+8);
+    ctx->rounds = 20;
 }
 
-static void _keystream(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                       const uint8_t *nonce, uint32_t blk)
+static void _xcrypt(const uint8_t *key, const uint8_t *nonce,
+                    const uint8_t *in, uint8_t *out, size_t len,
+                    uint32_t counter)
 {
-    /* Initialize block state */
-    memset(ctx->state, 0, sizeof(ctx->state));
-    _add_initial(ctx, key, nonce, blk);
-
-    /* perform rounds */
-    for (unsigned i = 0; i < 80; ++i) {
-        uint32_t *a = &ctx->state[((i                    ) & 3)          ];
-        uint32_t *b = &ctx->state[((i + ((i & 4) ? 1 : 0)) & 3) + (4 * 1)];
-        uint32_t *c = &ctx->state[((i + ((i & 4) ? 2 : 0)) & 3) + (4 * 2)];
-        uint32_t *d = &ctx->state[((i + ((i & 4) ? 3 : 0)) & 3) + (4 * 3)];
-        _r(a, b, d, 16);
-        _r(c, d, b, 12);
-        _r(a, b, d, 8);
-        _r(c, d, b, 7);
-    }
-    /* add initial state */
-    _add_initial(ctx, key, nonce, blk);
-}
+    chacha_ctx ctx;
+    /* the keystream is written in words */
+    alignas(uint32_t) uint8_t stream[XCRYPT_BLOCKS * 64];
 
-static void _xcrypt(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                    const uint8_t *nonce, const uint8_t *in, uint8_t *out,
-                    size_t len, size_t counter)
-{
-    /* Number of full 64 byte blocks */
-    const size_t num_blocks = len >> 6;
-    size_t pos = 0;
-    /* xcrypt full blocks */
-    for (size_t i = 0; i < num_blocks; i++, pos += 64) {
-        _keystream(ctx, key, nonce, i + counter);
-        for (size_t j = 0; j < 64; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
+    _init(&ctx, key, nonce, counter);
+    while (len) {
+        size_t numof = (len + 63) >> 6;
+
+        if (numof > XCRYPT_BLOCKS) {
+            numof = XCRYPT_BLOCKS;
         }
-    }
-    /* xcrypt remaining bytes */
-    if (len - pos) {
-        _keystream(ctx, key, nonce, num_blocks + counter);
-        for (size_t j = 0; j < len - pos; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
+        chacha_keystream_blocks(&ctx, stream, numof);
+
+        size_t n = (len < numof * 64) ? len : numof * 64;
+
+        for (size_t j = 0; j < n; j++) {
+            out[j] = in[j] ^ stream[j];
         }
+        in += n;
+        out += n;
+        len -= n;
     }
+    crypto_secure_wipe(&ctx, sizeof(ctx));
+    crypto_secure_wipe(stream, sizeof(stream));
 }
 
 static void _poly1305_padded(poly1305_ctx_t *pctx, const uint8_t *data, size_t len)
@@ -121,9 +109,14 @@ static void _poly1305_gentag(uint8_t *mac, const uint8_t *key, const uint8_t *no
                              const uint8_t *aad, size_t aadlen)
 {
     chacha20poly1305_ctx_t ctx;
+    chacha_ctx cctx;
+    alignas(uint32_t) uint8_t otk[64];
     /* generate one time key */
-    _keystream(&ctx, key, nonce, 0);
-    poly1305_init(&ctx.poly, (uint8_t*)ctx.state);
+    _init(&cctx, key, nonce, 0);
+    chacha_keystream_bytes(&cctx, otk);
+    poly1305_init(&ctx.poly, otk);
+    crypto_secure_wipe(&cctx, sizeof(cctx));
+    crypto_secure_wipe(otk, sizeof(otk));
     /* Add aad */
     _poly1305_padded(&ctx.poly, aad, aadlen);
     /* Add ciphertext */
@@ -139,13 +132,10 @@ void chacha20poly1305_encrypt(uint8_t *cipher, const uint8_t *msg,
                               size_t msglen, const uint8_t *aad, size_t aadlen,
                               const uint8_t *key, const uint8_t *nonce)
 {
-    chacha20poly1305_ctx_t ctx;
-    _xcrypt(&ctx, key, nonce, msg, cipher, msglen, 1);
-    crypto_secure_wipe(&ctx, sizeof(ctx));
+    _xcrypt(key, nonce, msg, cipher, msglen, 1);
     /* Generate tag */
     _poly1305_gentag(&cipher[msglen], key, nonce,
                     cipher, msglen, aad, aadlen);
-    /* Wipe structures */
 }
 
 int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
@@ -160,9 +150,7 @@ int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
     if (crypto_equals(cipher+*msglen, mac, CHACHA20POLY1305_TAG_BYTES) == 0) {
         return 0;
     }
-    chacha20poly1305_ctx_t ctx;
-    /* Number of full blocks */
-    _xcrypt(&ctx, key, nonce, cipher, msg, *msglen, 1);
+    _xcrypt(key, nonce, cipher, msg, *msglen, 1);
     return 1;
 }
 
@@ -170,6 +158,5 @@ void chacha20_encrypt_decrypt(const uint8_t *input, uint8_t *output,
                               const uint8_t *key, const uint8_t *nonce,
                               size_t inputlen)
 {
-    chacha20poly1305_ctx_t ctx;
-    _xcrypt(&ctx, key, nonce, input, output, inputlen, 0);
+    _xcrypt(key, nonce, input, output, inputlen, 0);
 }
@@ -54,10 +54,12 @@ uint32_t chacha_prng_next(void)
     mutex_lock(&_chacha_prng_mutex);
 
     if (--_chacha_prng_pos < 0) {
-        _chacha_prng_pos = 15;
-        chacha_keystream_bytes(&_chacha_prng_ctx, _chacha_prng_data);
+        _chacha_prng_pos = 63;
+        chacha_keystream_blocks(&_chacha_prng_ctx, _chacha_prng_data, 4);
     }
-    uint32_t result = _chacha_prng_data[_chacha_prng_pos];
+    /* the words of each block are returned from last to first, blocks in
+     * order, as when one block was generated at a time */
+    uint32_t result = _chacha_prng_data[_chacha_prng_pos ^ 0x30];
 
     mutex_unlock(&_chacha_prng_mutex);
     return result;
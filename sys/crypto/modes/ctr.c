@@ -15,32 +15,45 @@
  * @}
  */
 
+#include <string.h>
+
 #include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 
+/* number of stream blocks computed at once, so ciphers with a multi-block
+ * implementation can encrypt several counters in one go */
+#define CTR_BATCH   (4U)
+
 int cipher_encrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
                        uint8_t nonce_len, const uint8_t *input, size_t length,
                        uint8_t *output)
 {
     size_t offset = 0;
-    uint8_t stream_block[16] = { 0 }, block_size;
+    uint8_t stream[CTR_BATCH * CIPHER_MAX_BLOCK_SIZE], block_size;
 
     block_size = cipher_get_block_size(cipher);
     do {
-        uint8_t block_size_input;
+        size_t numof = (length - offset + block_size - 1) / block_size;
 
-        if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
+        /* as before, a stream block is computed even for no input */
+        numof = (numof > CTR_BATCH) ? CTR_BATCH : (numof ? numof : 1);
+        for (size_t i = 0; i < numof; i++) {
+            memcpy(&stream[i * block_size], nonce_counter, block_size);
+            crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        }
+        if (cipher_encrypt_blocks(cipher, stream, stream, numof) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
 
-        block_size_input = (length - offset > block_size) ?
-                           block_size : length - offset;
-        for (uint8_t i = 0; i < block_size_input; ++i) {
-            output[offset + i] = stream_block[i] ^ input[offset + i];
-        }
+        size_t n = numof * block_size;
 
-        offset += block_size_input;
-        crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        if (n > length - offset) {
+            n = length - offset;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            output[offset + i] = stream[i] ^ input[offset + i];
+        }
+        offset += n;
     } while (offset < length);
 
     return offset;
@@ -23,7 +23,7 @@
 int cipher_encrypt_ecb(const cipher_t *cipher, const uint8_t *input,
                        size_t length, uint8_t *output)
 {
-    size_t offset;
+    size_t numof;
     uint8_t block_size;
 
     block_size = cipher_get_block_size(cipher);
@@ -31,16 +31,14 @@ int cipher_encrypt_ecb(const cipher_t *cipher, const uint8_t *input,
         return CIPHER_ERR_INVALID_LENGTH;
     }
 
-    offset = 0;
-    do {
-        if (cipher_encrypt(cipher, input + offset, output + offset) != 1) {
-            return CIPHER_ERR_ENC_FAILED;
-        }
-
-        offset += block_size;
-    } while (offset < length);
+    /* as with the block by block loop before, one block is encrypted even
+     * for no input */
+    numof = (length > 0) ? (length / block_size) : 1;
+    if (cipher_encrypt_blocks(cipher, input, output, numof) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
 
-    return offset;
+    return numof * block_size;
 }
 
 int cipher_decrypt_ecb(const cipher_t *cipher, const uint8_t *input,
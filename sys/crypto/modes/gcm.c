@@ -0,0 +1,333 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       Galois/Counter Mode (GCM) AEAD mode as specified in
+ *              NIST SP 800-38D
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "crypto/helper.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/gcm.h"
+#include "modules.h"
+
+#if IS_USED(MODULE_CRYPTO_AES_CT) && (defined(__x86_64__) || defined(__i386__))
+#  define GCM_CLMUL     1
+#  include <cpuid.h>
+#  include <immintrin.h>
+#endif
+
+typedef struct {
+    uint8_t h[GCM_BLOCK_SIZE];  /* hash key, the encrypted zero block */
+    uint8_t y[GCM_BLOCK_SIZE];  /* hash so far */
+} gcm_state_t;
+
+/* x = x * h in GF(2^128), bit by bit with masks instead of branches */
+static void _gf_mul(uint8_t x[GCM_BLOCK_SIZE], const uint8_t h[GCM_BLOCK_SIZE])
+{
+    uint64_t z0 = 0, z1 = 0;
+    uint64_t v0 = byteorder_bebuftohll(h);
+    uint64_t v1 = byteorder_bebuftohll(h + 8);
+
+    for (unsigned i = 0; i < 128; i++) {
+        uint64_t mask = -(uint64_t)((x[i / 8] >> (7 - (i % 8))) & 1);
+
+        z0 ^= v0 & mask;
+        z1 ^= v1 & mask;
+        mask = -(v1 & 1);
+        v1 = (v1 >> 1) | (v0 << 63);
+        v0 = (v0 >> 1) ^ (0xe100000000000000ULL & mask);
+    }
+    byteorder_htobebufll(x, z0);
+    byteorder_htobebufll(x + 8, z1);
+}
+
+#if GCM_CLMUL
+static bool _has_clmul(void)
+{
+    /* CPUID is slow, so it is only asked once */
+    static int8_t has_clmul = -1;
+
+    if (has_clmul < 0) {
+        unsigned eax, ebx, ecx, edx;
+
+        has_clmul = __get_cpuid(1, &eax, &ebx, &ecx, &edx) &&
+                    (ecx & bit_PCLMUL) && (ecx & bit_SSSE3);
+    }
+    return has_clmul;
+}
+
+/* a * b in GF(2^128) on byte-reversed operands, with the shift and reduction
+ * of the Intel carry-less multiplication white paper */
+__attribute__((target("pclmul,ssse3")))
+static __m128i _gf_mul_clmul(__m128i a, __m128i b)
+{
+    __m128i t2, t3, t4, t5, t6, t7, t8, t9;
+
+    t3 = _mm_clmulepi64_si128(a, b, 0x00);
+    t4 = _mm_clmulepi64_si128(a, b, 0x10);
+    t5 = _mm_clmulepi64_si128(a, b, 0x01);
+    t6 = _mm_clmulepi64_si128(a, b, 0x11);
+
+    t4 = _mm_xor_si128(t4, t5);
+    t5 = _mm_slli_si128(t4, 8);
+    t4 = _mm_srli_si128(t4, 8);
+    t3 = _mm_xor_si128(t3, t5);
+    t6 = _mm_xor_si128(t6, t4);
+
+    /* shift the 256 bit product left by one, as the operands are reflected */
+    t7 = _mm_srli_epi32(t3, 31);
+    t8 = _mm_srli_epi32(t6, 31);
+    t3 = _mm_slli_epi32(t3, 1);
+    t6 = _mm_slli_epi32(t6, 1);
+    t9 = _mm_srli_si128(t7, 12);
+    t8 = _mm_slli_si128(t8, 4);
+    t7 = _mm_slli_si128(t7, 4);
+    t3 = _mm_or_si128(t3, t7);
+    t6 = _mm_or_si128(t6, t8);
+    t6 = _mm_or_si128(t6, t9);
+
+    /* reduce modulo x^128 + x^7 + x^2 + x + 1 */
+    t7 = _mm_slli_epi32(t3, 31);
+    t8 = _mm_slli_epi32(t3, 30);
+    t9 = _mm_slli_epi32(t3, 25);
+    t7 = _mm_xor_si128(t7, t8);
+    t7 = _mm_xor_si128(t7, t9);
+    t8 = _mm_srli_si128(t7, 4);
+    t7 = _mm_slli_si128(t7, 12);
+    t3 = _mm_xor_si128(t3, t7);
+
+    t2 = _mm_srli_epi32(t3, 1);
+    t4 = _mm_srli_epi32(t3, 2);
+    t5 = _mm_srli_epi32(t3, 7);
+    t2 = _mm_xor_si128(t2, t4);
+    t2 = _mm_xor_si128(t2, t5);
+    t2 = _mm_xor_si128(t2, t8);
+    t3 = _mm_xor_si128(t3, t2);
+    return _mm_xor_si128(t6, t3);
+}
+
+__attribute__((target("pclmul,ssse3")))
+static void _ghash_blocks_clmul(gcm_state_t *state, const uint8_t *blocks,
+                                size_t numof)
+{
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                       8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i h = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)state->h),
+                                 bswap);
+    __m128i y = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)state->y),
+                                 bswap);
+
+    for (; numof; numof--, blocks += GCM_BLOCK_SIZE) {
+        __m128i x = _mm_loadu_si128((const __m128i *)blocks);
+
+        y = _gf_mul_clmul(_mm_xor_si128(y, _mm_shuffle_epi8(x, bswap)), h);
+    }
+    _mm_storeu_si128((__m128i *)state->y, _mm_shuffle_epi8(y, bswap));
+}
+#endif /* GCM_CLMUL */
+
+static void _ghash_blocks(gcm_state_t *state, const uint8_t *blocks,
+                          size_t numof)
+{
+#if GCM_CLMUL
+    if (_has_clmul()) {
+        _ghash_blocks_clmul(state, blocks, numof);
+        return;
+    }
+#endif
+    for (; numof; numof--, blocks += GCM_BLOCK_SIZE) {
+        for (unsigned i = 0; i < GCM_BLOCK_SIZE; i++) {
+            state->y[i] ^= blocks[i];
+        }
+        _gf_mul(state->y, state->h);
+    }
+}
+
+/* hashes data, padded with zeros to whole blocks */
+static void _ghash(gcm_state_t *state, const uint8_t *data, size_t len)
+{
+    size_t numof = len / GCM_BLOCK_SIZE;
+    size_t rest = len % GCM_BLOCK_SIZE;
+
+    _ghash_blocks(state, data, numof);
+    if (rest) {
+        uint8_t block[GCM_BLOCK_SIZE] = { 0 };
+
+        memcpy(block, data + (numof * GCM_BLOCK_SIZE), rest);
+        _ghash_blocks(state, block, 1);
+    }
+}
+
+static void _ghash_lengths(gcm_state_t *state, uint64_t a_len, uint64_t c_len)
+{
+    uint8_t block[GCM_BLOCK_SIZE];
+
+    byteorder_htobebufll(block, a_len * 8);
+    byteorder_htobebufll(block + 8, c_len * 8);
+    _ghash_blocks(state, block, 1);
+}
+
+/* computes the hash key and the pre-counter block J0 */
+static int _init(const cipher_t *cipher, gcm_state_t *state,
+                 const uint8_t *nonce, size_t nonce_len,
+                 uint8_t j0[GCM_BLOCK_SIZE])
+{
+    if (cipher_get_block_size(cipher) != GCM_BLOCK_SIZE) {
+        return GCM_ERR_INVALID_BLOCK_LENGTH;
+    }
+    if (nonce_len == 0) {
+        return GCM_ERR_INVALID_NONCE_LENGTH;
+    }
+
+    memset(state, 0, sizeof(*state));
+    if (cipher_encrypt(cipher, state->h, state->h) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
+
+    if (nonce_len == GCM_NONCE_LEN) {
+        memcpy(j0, nonce, GCM_NONCE_LEN);
+        byteorder_htobebufl(j0 + GCM_NONCE_LEN, 1);
+    }
+    else {
+        _ghash(state, nonce, nonce_len);
+        _ghash_lengths(state, 0, nonce_len);
+        memcpy(j0, state->y, GCM_BLOCK_SIZE);
+        memset(state->y, 0, GCM_BLOCK_SIZE);
+    }
+    return 0;
+}
+
+/* tag = E(J0) ^ GHASH(A, C) */
+static int _tag(const cipher_t *cipher, gcm_state_t *state,
+                const uint8_t j0[GCM_BLOCK_SIZE],
+                const uint8_t *auth_data, size_t auth_data_len,
+                const uint8_t *ciphertext, size_t len,
+                uint8_t tag[GCM_BLOCK_SIZE])
+{
+    _ghash(state, auth_data, auth_data_len);
+    _ghash(state, ciphertext, len);
+    _ghash_lengths(state, auth_data_len, len);
+
+    if (cipher_encrypt(cipher, j0, tag) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
+    for (unsigned i = 0; i < GCM_BLOCK_SIZE; i++) {
+        tag[i] ^= state->y[i];
+    }
+    return 0;
+}
+
+/* the counter is the last 32 bits of J0, incremented once for the first
+ * block of data */
+static int _crypt(const cipher_t *cipher, const uint8_t j0[GCM_BLOCK_SIZE],
+                  const uint8_t *input, size_t len, uint8_t *output)
+{
+    uint8_t counter[GCM_BLOCK_SIZE];
+
+    if (len == 0) {
+        return 0;
+    }
+    memcpy(counter, j0, GCM_BLOCK_SIZE);
+    crypto_block_inc_ctr(counter, GCM_BLOCK_SIZE - GCM_NONCE_LEN);
+    return cipher_encrypt_ctr(cipher, counter, GCM_NONCE_LEN, input, len,
+                              output);
+}
+
+static bool _tag_len_valid(uint8_t tag_len)
+{
+    return (tag_len == 4) || (tag_len == 8) ||
+           ((tag_len >= 12) && (tag_len <= GCM_BLOCK_SIZE));
+}
+
+int32_t cipher_encrypt_gcm(const cipher_t *cipher,
+                           const uint8_t *auth_data, size_t auth_data_len,
+                           uint8_t tag_len,
+                           const uint8_t *nonce, size_t nonce_len,
+                           const uint8_t *input, size_t input_len,
+                           uint8_t *output)
+{
+    gcm_state_t state;
+    uint8_t j0[GCM_BLOCK_SIZE], tag[GCM_BLOCK_SIZE];
+    int res;
+
+    if (!_tag_len_valid(tag_len)) {
+        return GCM_ERR_INVALID_TAG_LENGTH;
+    }
+    if (input_len > (size_t)(INT32_MAX - tag_len)) {
+        return GCM_ERR_INVALID_DATA_LENGTH;
+    }
+
+    res = _init(cipher, &state, nonce, nonce_len, j0);
+    if (res < 0) {
+        return res;
+    }
+    res = _crypt(cipher, j0, input, input_len, output);
+    if (res < 0) {
+        return res;
+    }
+    res = _tag(cipher, &state, j0, auth_data, auth_data_len, output,
+               input_len, tag);
+    if (res < 0) {
+        return res;
+    }
+
+    memcpy(output + input_len, tag, tag_len);
+    crypto_secure_wipe(&state, sizeof(state));
+    return input_len + tag_len;
+}
+
+int32_t cipher_decrypt_gcm(const cipher_t *cipher,
+                           const uint8_t *auth_data, size_t auth_data_len,
+                           uint8_t tag_len,
+                           const uint8_t *nonce, size_t nonce_len,
+                           const uint8_t *input, size_t input_len,
+                           uint8_t *output)
+{
+    gcm_state_t state;
+    uint8_t j0[GCM_BLOCK_SIZE], tag[GCM_BLOCK_SIZE];
+    int res;
+
+    if (!_tag_len_valid(tag_len)) {
+        return GCM_ERR_INVALID_TAG_LENGTH;
+    }
+    if ((input_len < tag_len) ||
+        ((input_len - tag_len) > (size_t)INT32_MAX)) {
+        return GCM_ERR_INVALID_DATA_LENGTH;
+    }
+
+    size_t len = input_len - tag_len;
+
+    res = _init(cipher, &state, nonce, nonce_len, j0);
+    if (res < 0) {
+        return res;
+    }
+    /* the tag is checked before anything is decrypted */
+    res = _tag(cipher, &state, j0, auth_data, auth_data_len, input, len, tag);
+    crypto_secure_wipe(&state, sizeof(state));
+    if (res < 0) {
+        return res;
+    }
+    if (!crypto_equals(tag, input + len, tag_len)) {
+        return GCM_ERR_INVALID_TAG;
+    }
+
+    res = _crypt(cipher, j0, input, len, output);
+    if (res < 0) {
+        return res;
+    }
+    return len;
+}
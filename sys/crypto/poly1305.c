@@ -20,6 +20,12 @@
 
 #include <string.h>
 #include "crypto/poly1305.h"
+#include "modules.h"
+
+#if IS_USED(MODULE_CRYPTO_CHACHA_SIMD) && defined(__SSE2__)
+#  define POLY1305_SSE2     1
+#  include <immintrin.h>
+#endif
 
 static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4);
 
@@ -101,15 +107,189 @@ static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
     ctx->c_idx++;
 }
 
+#ifdef POLY1305_SSE2
+/* Blocks needed before the vector code pays for computing r^2 */
+#define POLY1305_SSE2_MIN_BLOCKS    (8U)
+
+#define MASK26  (0x3ffffff)
+
+/* 130 bit numbers in five limbs of 26 bit, so that the products of two
+ * limbs and their sums fit in 64 bit */
+static void _to_26(uint32_t l[5], const uint32_t w[4], uint32_t hi)
+{
+    l[0] = w[0] & MASK26;
+    l[1] = ((w[0] >> 26) | (w[1] << 6)) & MASK26;
+    l[2] = ((w[1] >> 20) | (w[2] << 12)) & MASK26;
+    l[3] = ((w[2] >> 14) | (w[3] << 18)) & MASK26;
+    l[4] = (w[3] >> 8) | (hi << 24);
+}
+
+/* a * b modulo 2^130 - 5, the result is carried to 26 bit limbs again */
+static void _mul_26(uint32_t out[5], const uint32_t a[5], const uint32_t b[5])
+{
+    const uint64_t b1 = b[1] * 5, b2 = b[2] * 5, b3 = b[3] * 5, b4 = b[4] * 5;
+    uint64_t d[5];
+
+    d[0] = (uint64_t)a[0] * b[0] + a[1] * b4 + a[2] * b3 + a[3] * b2 + a[4] * b1;
+    d[1] = (uint64_t)a[0] * b[1] + (uint64_t)a[1] * b[0] + a[2] * b4 + a[3] * b3 +
+           a[4] * b2;
+    d[2] = (uint64_t)a[0] * b[2] + (uint64_t)a[1] * b[1] + (uint64_t)a[2] * b[0] +
+           a[3] * b4 + a[4] * b3;
+    d[3] = (uint64_t)a[0] * b[3] + (uint64_t)a[1] * b[2] + (uint64_t)a[2] * b[1] +
+           (uint64_t)a[3] * b[0] + a[4] * b4;
+    d[4] = (uint64_t)a[0] * b[4] + (uint64_t)a[1] * b[3] + (uint64_t)a[2] * b[2] +
+           (uint64_t)a[3] * b[1] + (uint64_t)a[4] * b[0];
+
+    for (unsigned i = 0; i < 4; i++) {
+        d[i + 1] += d[i] >> 26;
+        out[i] = d[i] & MASK26;
+    }
+    out[4] = d[4] & MASK26;
+    d[0] = out[0] + (d[4] >> 26) * 5;
+    out[0] = d[0] & MASK26;
+    out[1] += d[0] >> 26;
+}
+
+#define V_MUL(a, b)     _mm_mul_epu32(a, b)
+#define V_ADD(a, b)     _mm_add_epi64(a, b)
+
+/* Processes an even number of blocks in two lanes: even blocks go to the
+ * first lane and odd ones to the second, both multiplied by r^2. The last
+ * two blocks are multiplied by r^2 and r, so the sum of the lanes is the
+ * hash Horner's rule gives. */
+static void _blocks_sse2(poly1305_ctx_t *ctx, const uint8_t *data,
+                         size_t numof)
+{
+    const __m128i mask = _mm_set1_epi64x(MASK26);
+    const __m128i hibit = _mm_set1_epi64x(1 << 24);
+    uint32_t r[5], r2[5], h[5];
+    __m128i vr[5], vs[5], vh[5];
+
+    _to_26(r, ctx->r, 0);
+    _mul_26(r2, r, r);
+    _to_26(h, ctx->h, ctx->h[4]);
+
+    for (unsigned i = 0; i < 5; i++) {
+        vh[i] = _mm_set_epi64x(0, h[i]);
+    }
+
+    for (; numof; numof -= 2, data += 32) {
+        /* r^2 in both lanes, except for the last two blocks */
+        for (unsigned i = 0; i < 5; i++) {
+            vr[i] = (numof == 2) ? _mm_set_epi64x(r[i], r2[i])
+                                 : _mm_set1_epi64x(r2[i]);
+            vs[i] = V_ADD(vr[i], _mm_slli_epi64(vr[i], 2));
+        }
+
+        /* the low and high halves of both blocks */
+        __m128i a = _mm_loadu_si128((const __m128i *)data);
+        __m128i b = _mm_loadu_si128((const __m128i *)(data + 16));
+        __m128i lo = _mm_unpacklo_epi64(a, b);
+        __m128i hi = _mm_unpackhi_epi64(a, b);
+
+        vh[0] = V_ADD(vh[0], _mm_and_si128(lo, mask));
+        vh[1] = V_ADD(vh[1], _mm_and_si128(_mm_srli_epi64(lo, 26), mask));
+        vh[2] = V_ADD(vh[2], _mm_and_si128(
+                          _mm_or_si128(_mm_srli_epi64(lo, 52),
+                                       _mm_slli_epi64(hi, 12)), mask));
+        vh[3] = V_ADD(vh[3], _mm_and_si128(_mm_srli_epi64(hi, 14), mask));
+        vh[4] = V_ADD(vh[4], _mm_or_si128(_mm_srli_epi64(hi, 40), hibit));
+
+        __m128i d[5];
+
+        d[0] = V_ADD(V_ADD(V_ADD(V_ADD(V_MUL(vh[0], vr[0]), V_MUL(vh[1], vs[4])),
+                                 V_MUL(vh[2], vs[3])), V_MUL(vh[3], vs[2])),
+                     V_MUL(vh[4], vs[1]));
+        d[1] = V_ADD(V_ADD(V_ADD(V_ADD(V_MUL(vh[0], vr[1]), V_MUL(vh[1], vr[0])),
+                                 V_MUL(vh[2], vs[4])), V_MUL(vh[3], vs[3])),
+                     V_MUL(vh[4], vs[2]));
+        d[2] = V_ADD(V_ADD(V_ADD(V_ADD(V_MUL(vh[0], vr[2]), V_MUL(vh[1], vr[1])),
+                                 V_MUL(vh[2], vr[0])), V_MUL(vh[3], vs[4])),
+                     V_MUL(vh[4], vs[3]));
+        d[3] = V_ADD(V_ADD(V_ADD(V_ADD(V_MUL(vh[0], vr[3]), V_MUL(vh[1], vr[2])),
+                                 V_MUL(vh[2], vr[1])), V_MUL(vh[3], vr[0])),
+                     V_MUL(vh[4], vs[4]));
+        d[4] = V_ADD(V_ADD(V_ADD(V_ADD(V_MUL(vh[0], vr[4]), V_MUL(vh[1], vr[3])),
+                                 V_MUL(vh[2], vr[2])), V_MUL(vh[3], vr[1])),
+                     V_MUL(vh[4], vr[0]));
+
+        /* partial reduction, enough to keep the limbs below 2^27 */
+        for (unsigned i = 0; i < 4; i++) {
+            d[i + 1] = V_ADD(d[i + 1], _mm_srli_epi64(d[i], 26));
+            vh[i] = _mm_and_si128(d[i], mask);
+        }
+        __m128i c = _mm_srli_epi64(d[4], 26);
+
+        vh[4] = _mm_and_si128(d[4], mask);
+        vh[0] = V_ADD(vh[0], V_ADD(c, _mm_slli_epi64(c, 2)));
+        vh[1] = V_ADD(vh[1], _mm_srli_epi64(vh[0], 26));
+        vh[0] = _mm_and_si128(vh[0], mask);
+    }
+
+    /* sum the lanes and go back to 32 bit words */
+    uint64_t l[5];
+
+    for (unsigned i = 0; i < 5; i++) {
+        uint64_t lanes[2];
+
+        _mm_storeu_si128((__m128i *)lanes, vh[i]);
+        l[i] = lanes[0] + lanes[1];
+    }
+    for (unsigned i = 0; i < 4; i++) {
+        l[i + 1] += l[i] >> 26;
+        l[i] &= MASK26;
+    }
+    l[0] += (l[4] >> 26) * 5;
+    l[4] &= MASK26;
+
+    uint64_t t = l[0] + (l[1] << 26);
+
+    ctx->h[0] = (uint32_t)t;
+    t = (t >> 32) + (l[2] << 20);
+    ctx->h[1] = (uint32_t)t;
+    t = (t >> 32) + (l[3] << 14);
+    ctx->h[2] = (uint32_t)t;
+    t = (t >> 32) + (l[4] << 8);
+    ctx->h[3] = (uint32_t)t;
+    ctx->h[4] = (uint32_t)(t >> 32);
+}
+#endif /* POLY1305_SSE2 */
+
 void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *data, size_t len)
 {
-    for (size_t i = 0; i < len; i++) {
-        _take_input(ctx, data[i]);
+    /* fill up the chunk started by the previous call */
+    while (len && ctx->c_idx) {
+        _take_input(ctx, *data++);
+        len--;
         if (ctx->c_idx == 16) {
             poly1305_block(ctx, 1);
             _clear_c(ctx);
         }
     }
+    if (ctx->c_idx) {
+        /* all of the input went into the chunk */
+        return;
+    }
+#ifdef POLY1305_SSE2
+    if ((len >> 4) >= POLY1305_SSE2_MIN_BLOCKS) {
+        size_t numof = (len >> 4) & ~(size_t)1;
+
+        _blocks_sse2(ctx, data, numof);
+        data += numof * 16;
+        len -= numof * 16;
+    }
+#endif
+    /* full blocks are read directly */
+    for (; len >= 16; len -= 16, data += 16) {
+        for (unsigned i = 0; i < 4; i++) {
+            ctx->c[i] = u8to32(&data[4 * i]);
+        }
+        poly1305_block(ctx, 1);
+    }
+    _clear_c(ctx);
+    for (size_t i = 0; i < len; i++) {
+        _take_input(ctx, data[i]);
+    }
 }
 
 void poly1305_init(poly1305_ctx_t *ctx, const uint8_t *key)
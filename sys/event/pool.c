@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_event_pool
+ * @{
+ *
+ * @file
+ * @brief       Event thread pool implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "bitarithm.h"
+#include "event/pool.h"
+#include "irq.h"
+#include "thread.h"
+
+/* Gets an event from the worker's own queue, else takes one from the others.
+ * Events are taken from the head in both cases, as clist has no O(1) pop at
+ * the tail. */
+static event_t *_get(event_pool_t *pool, unsigned self)
+{
+    for (unsigned i = 0; i < pool->numof; i++) {
+        event_t *event = event_get(&pool->workers[(self + i) % pool->numof].queue);
+
+        if (event) {
+            return event;
+        }
+    }
+    return NULL;
+}
+
+static void *_worker(void *arg)
+{
+    event_pool_worker_t *me = arg;
+    event_pool_t *pool = me->pool;
+    unsigned self = me - pool->workers;
+    uint32_t bit = 1UL << self;
+
+    event_queue_claim(&me->queue);
+    while (1) {
+        event_t *event = _get(pool, self);
+
+        if (event == NULL) {
+            unsigned state = irq_disable();
+
+            pool->idle |= bit;
+            irq_restore(state);
+            /* events posted before the bit was set are found here, events
+             * posted after it are posted to this worker or another idle one */
+            event = _get(pool, self);
+            if (event == NULL) {
+                thread_flags_wait_any(THREAD_FLAG_EVENT);
+            }
+            state = irq_disable();
+            pool->idle &= ~bit;
+            irq_restore(state);
+            if (event == NULL) {
+                continue;
+            }
+        }
+        event->handler(event);
+    }
+
+    return NULL;
+}
+
+void event_pool_init(event_pool_t *pool, event_pool_worker_t *workers,
+                     unsigned numof, char *stacks, size_t stack_size,
+                     uint8_t priority)
+{
+    assert((numof > 0) && (numof <= EVENT_POOL_WORKERS_MAX));
+
+    pool->workers = workers;
+    pool->numof = numof;
+    pool->next = 0;
+    pool->idle = 0;
+    /* events may be posted before the workers run */
+    for (unsigned i = 0; i < numof; i++) {
+        event_queue_init_detached(&workers[i].queue);
+        workers[i].pool = pool;
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        thread_create(stacks + (i * stack_size), stack_size, priority, 0,
+                      _worker, &workers[i], "event_pool");
+    }
+}
+
+/* queues an event and returns the bit of the worker to wake up, if any */
+static uint32_t _push(event_pool_t *pool, event_t *event)
+{
+    assert(event->handler);
+
+    if (event->list_node.next) {
+        /* already queued */
+        return 0;
+    }
+
+    unsigned i;
+
+    if (pool->idle) {
+        i = bitarithm_lsb(pool->idle);
+        /* so the next event goes to another idle worker */
+        pool->idle &= ~(1UL << i);
+    }
+    else {
+        i = pool->next;
+        pool->next = (i + 1) % pool->numof;
+    }
+    clist_rpush(&pool->workers[i].queue.event_list, &event->list_node);
+    return 1UL << i;
+}
+
+static void _wake(event_pool_t *pool, uint32_t workers)
+{
+    while (workers) {
+        unsigned i = bitarithm_lsb(workers);
+        thread_t *waiter = pool->workers[i].queue.waiter;
+
+        workers &= ~(1UL << i);
+        if (waiter) {
+            thread_flags_set(waiter, THREAD_FLAG_EVENT);
+        }
+    }
+}
+
+void event_pool_post(event_pool_t *pool, event_t *event)
+{
+    assert(pool && event);
+
+    unsigned state = irq_disable();
+    uint32_t wake = _push(pool, event);
+
+    irq_restore(state);
+    _wake(pool, wake);
+}
+
+void event_pool_post_batch(event_pool_t *pool, event_t **events, size_t numof)
+{
+    assert(pool && (events || !numof));
+
+    uint32_t wake = 0;
+    unsigned state = irq_disable();
+
+    for (size_t i = 0; i < numof; i++) {
+        wake |= _push(pool, events[i]);
+    }
+    irq_restore(state);
+    _wake(pool, wake);
+}
+
+void event_pool_cancel(event_pool_t *pool, event_t *event)
+{
+    assert(pool && event);
+
+    /* not event_cancel(), it marks the event as not queued even if it is
+     * queued elsewhere */
+    unsigned state = irq_disable();
+
+    for (unsigned i = 0; i < pool->numof; i++) {
+        if (clist_remove(&pool->workers[i].queue.event_list,
+                         &event->list_node)) {
+            event->list_node.next = NULL;
+            break;
+        }
+    }
+    irq_restore(state);
+}
@@ -27,7 +27,229 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-static void _add_event_to_list(evtimer_t *evtimer, evtimer_event_t *event)
+#if IS_USED(MODULE_EVTIMER_HEAP)
+/* Pairing heap ordered by event->offset, which holds the absolute time of the
+ * event. Times are compared relative to evtimer->base, which is kept at or
+ * before the earliest event, so they compare correctly across wrap-arounds. */
+
+static inline uint32_t _key(const evtimer_t *evtimer,
+                            const evtimer_event_t *event)
+{
+    return event->offset - evtimer->base;
+}
+
+/* makes the later of two roots the first child of the other, the next and
+ * prev fields of the returned root are left to the caller */
+static evtimer_event_t *_meld(const evtimer_t *evtimer, evtimer_event_t *a,
+                              evtimer_event_t *b)
+{
+    if (_key(evtimer, b) < _key(evtimer, a)) {
+        evtimer_event_t *tmp = a;
+
+        a = b;
+        b = tmp;
+    }
+    b->next = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    b->prev = a;
+    a->child = b;
+    return a;
+}
+
+/* melds a list of siblings into one heap with the usual two passes */
+static evtimer_event_t *_meld_siblings(const evtimer_t *evtimer,
+                                       evtimer_event_t *first)
+{
+    evtimer_event_t *pairs = NULL;
+
+    /* left to right in pairs, collecting the results in reverse order */
+    while (first) {
+        evtimer_event_t *a = first;
+        evtimer_event_t *b = a->next;
+
+        if (b) {
+            first = b->next;
+            a = _meld(evtimer, a, b);
+        }
+        else {
+            first = NULL;
+        }
+        a->next = pairs;
+        pairs = a;
+    }
+
+    /* right to left into one */
+    evtimer_event_t *root = NULL;
+
+    while (pairs) {
+        evtimer_event_t *next = pairs->next;
+
+        pairs->next = NULL;
+        root = root ? _meld(evtimer, root, pairs) : pairs;
+        pairs = next;
+    }
+    if (root) {
+        root->prev = NULL;
+    }
+    return root;
+}
+
+static void _update_head_offset(evtimer_t *evtimer)
+{
+    /* the absolute times of the events stay valid, base is moved when an
+     * event is added */
+    (void)evtimer;
+}
+
+static void _add_event(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+
+    DEBUG("evtimer: new event offset %" PRIu32 " ms\n", event->offset);
+    /* an event due but not fired yet must stay at or after base, so base is
+     * not moved beyond it */
+    if (!evtimer->events ||
+        ((now - evtimer->base) <= _key(evtimer, evtimer->events))) {
+        evtimer->base = now;
+    }
+    else {
+        evtimer->base = evtimer->events->offset;
+    }
+    event->offset += now;
+    event->next = NULL;
+    event->prev = NULL;
+    event->child = NULL;
+    if (evtimer->events) {
+        evtimer->events = _meld(evtimer, evtimer->events, event);
+        evtimer->events->prev = NULL;
+    }
+    else {
+        evtimer->events = event;
+    }
+}
+
+/* checks if the event is in the heap, without following any pointer of the
+ * event itself: an event never added may hold anything. Only subtrees whose
+ * root is not after the event can contain it. */
+static bool _is_queued(const evtimer_t *evtimer, const evtimer_event_t *event)
+{
+    uint32_t key = _key(evtimer, event);
+    const evtimer_event_t *node = evtimer->events;
+
+    while (node) {
+        if (node == event) {
+            return true;
+        }
+        if (node->child && (_key(evtimer, node) <= key)) {
+            node = node->child;
+            continue;
+        }
+        /* next sibling of the node or of its closest ancestor having one */
+        while (node && !node->next) {
+            while (node->prev && (node->prev->child != node)) {
+                node = node->prev;
+            }
+            node = node->prev;
+        }
+        if (node) {
+            node = node->next;
+        }
+    }
+    return false;
+}
+
+static void _del_event(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    if (event == evtimer->events) {
+        evtimer->events = _meld_siblings(evtimer, event->child);
+    }
+    /* all events in the heap but the root have a prev */
+    else if (event->prev && _is_queued(evtimer, event)) {
+        if (event->prev->child == event) {
+            event->prev->child = event->next;
+        }
+        else {
+            event->prev->next = event->next;
+        }
+        if (event->next) {
+            event->next->prev = event->prev;
+        }
+
+        evtimer_event_t *sub = _meld_siblings(evtimer, event->child);
+
+        if (sub) {
+            evtimer->events = _meld(evtimer, evtimer->events, sub);
+        }
+    }
+    else {
+        /* not queued */
+        return;
+    }
+    event->next = NULL;
+    event->prev = NULL;
+    event->child = NULL;
+}
+
+static void _set_timer(evtimer_t *evtimer)
+{
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    uint32_t elapsed = now - evtimer->base;
+    uint32_t key = _key(evtimer, evtimer->events);
+
+    ztimer_set(ZTIMER_MSEC, &evtimer->timer,
+               (key > elapsed) ? (key - elapsed) : 0);
+    DEBUG("evtimer: now=%" PRIu32 " ms setting ztimer to %" PRIu32 " ms\n",
+          now, evtimer->events->offset);
+}
+
+static evtimer_event_t *_get_next(evtimer_t *evtimer)
+{
+    evtimer_event_t *event = evtimer->events;
+
+    if (event &&
+        (_key(evtimer, event) <= (ztimer_now(ZTIMER_MSEC) - evtimer->base))) {
+        _del_event(evtimer, event);
+        /* as with the list, so the event can be added again as is */
+        event->offset = 0;
+        return event;
+    }
+    return NULL;
+}
+
+static void _expire_head(evtimer_t *evtimer)
+{
+    /* events due are found by comparing with now */
+    (void)evtimer;
+}
+
+static void _update_base(evtimer_t *evtimer)
+{
+    /* all events left are after now */
+    evtimer->base = ztimer_now(ZTIMER_MSEC);
+}
+
+evtimer_event_t *evtimer_next_event(const evtimer_event_t *event)
+{
+    /* pre-order, going up to the parent when a subtree is done */
+    if (event->child) {
+        return event->child;
+    }
+    while (event) {
+        if (event->next) {
+            return event->next;
+        }
+        while (event->prev && (event->prev->child != event)) {
+            event = event->prev;
+        }
+        event = event->prev;
+    }
+    return NULL;
+}
+
+#else /* IS_USED(MODULE_EVTIMER_HEAP) */
+static void _add_event(evtimer_t *evtimer, evtimer_event_t *event)
 {
     DEBUG("evtimer: new event offset %" PRIu32 " ms\n", event->offset);
     evtimer_event_t **list = &evtimer->events;
@@ -62,7 +284,7 @@ static void _add_event_to_list(evtimer_t *evtimer, evtimer_event_t *event)
     *list = event;
 }
 
-static void _del_event_from_list(evtimer_t *evtimer, evtimer_event_t *event)
+static void _del_event(evtimer_t *evtimer, evtimer_event_t *event)
 {
     evtimer_event_t **list = &evtimer->events;
 
@@ -95,16 +317,6 @@ static void _set_timer(evtimer_t *evtimer)
           evtimer->base, next_event->offset);
 }
 
-static void _update_timer(evtimer_t *evtimer)
-{
-    if (evtimer->events) {
-        _set_timer(evtimer);
-    }
-    else {
-        ztimer_remove(ZTIMER_MSEC, &evtimer->timer);
-    }
-}
-
 static void _update_head_offset(evtimer_t *evtimer)
 {
     if (evtimer->events) {
@@ -120,6 +332,44 @@ static void _update_head_offset(evtimer_t *evtimer)
     }
 }
 
+static evtimer_event_t *_get_next(evtimer_t *evtimer)
+{
+    evtimer_event_t *event = evtimer->events;
+
+    if (event && (event->offset == 0)) {
+        evtimer->events = event->next;
+        return event;
+    }
+    else {
+        return NULL;
+    }
+}
+
+static void _expire_head(evtimer_t *evtimer)
+{
+    /* this function gets called directly by ztimer if the set ztimer expired.
+     * Thus the offset of the first event is down to zero. */
+    evtimer->events->offset = 0;
+}
+
+static void _update_base(evtimer_t *evtimer)
+{
+    /* the offset of the new head is relative to the time the timer fired */
+    (void)evtimer;
+}
+
+#endif /* IS_USED(MODULE_EVTIMER_HEAP) */
+
+static void _update_timer(evtimer_t *evtimer)
+{
+    if (evtimer->events) {
+        _set_timer(evtimer);
+    }
+    else {
+        ztimer_remove(ZTIMER_MSEC, &evtimer->timer);
+    }
+}
+
 void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event)
 {
     unsigned state = irq_disable();
@@ -127,7 +377,7 @@ void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event)
     DEBUG("evtimer_add(): adding event with offset %" PRIu32 "\n", event->offset);
 
     _update_head_offset(evtimer);
-    _add_event_to_list(evtimer, event);
+    _add_event(evtimer, event);
     if (evtimer->events == event) {
         _set_timer(evtimer);
     }
@@ -143,23 +393,15 @@ void evtimer_del(evtimer_t *evtimer, evtimer_event_t *event)
 
     DEBUG("evtimer_del(): removing event with offset %" PRIu32 "\n", event->offset);
 
-    _update_head_offset(evtimer);
-    _del_event_from_list(evtimer, event);
-    _update_timer(evtimer);
-    irq_restore(state);
-}
+    evtimer_event_t *head = evtimer->events;
 
-static evtimer_event_t *_get_next(evtimer_t *evtimer)
-{
-    evtimer_event_t *event = evtimer->events;
-
-    if (event && (event->offset == 0)) {
-        evtimer->events = event->next;
-        return event;
-    }
-    else {
-        return NULL;
+    _update_head_offset(evtimer);
+    _del_event(evtimer, event);
+    /* with the heap, the timer is still right for the same first event */
+    if (!IS_USED(MODULE_EVTIMER_HEAP) || (evtimer->events != head)) {
+        _update_timer(evtimer);
     }
+    irq_restore(state);
 }
 
 static void _evtimer_handler(void *arg)
@@ -167,17 +409,16 @@ static void _evtimer_handler(void *arg)
     DEBUG("_evtimer_handler()\n");
 
     evtimer_t *evtimer = (evtimer_t *)arg;
+    evtimer_event_t *event;
 
-    /* this function gets called directly by ztimer if the set ztimer expired.
-     * Thus the offset of the first event is down to zero. */
-    evtimer_event_t *event = evtimer->events;
-    event->offset = 0;
+    _expire_head(evtimer);
 
     /* iterate the event list */
     while ((event = _get_next(evtimer))) {
         evtimer->callback(event);
     }
 
+    _update_base(evtimer);
     _update_timer(evtimer);
 }
 
@@ -191,12 +432,12 @@ void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler)
 
 void evtimer_print(const evtimer_t *evtimer)
 {
-    evtimer_event_t *list = evtimer->events;
+    evtimer_event_t *list = evtimer_first_event(evtimer);
     int nr = 0;
 
     while (list) {
         nr++;
         printf("ev #%d offset=%u\n", nr, (unsigned)list->offset);
-        list = list->next;
+        list = evtimer_next_event(list);
     }
 }
@@ -24,9 +24,22 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <assert.h>
 
 #include "hashes/sha2xx_common.h"
+#include "modules.h"
+
+#if IS_USED(MODULE_HASHES_SHA2_ACCEL)
+#  if defined(__x86_64__) || defined(__i386__)
+#    define SHA2XX_SHANI    1
+#    include <cpuid.h>
+#    include <immintrin.h>
+#  elif defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO)
+#    define SHA2XX_ARMV8    1
+#    include <arm_neon.h>
+#  endif
+#endif
 
 #if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
@@ -145,6 +158,146 @@ static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
     }
 }
 
+#if SHA2XX_SHANI
+static bool _has_shani(void)
+{
+    /* CPUID is slow, so it is only asked once */
+    static int8_t has_shani = -1;
+
+    if (has_shani < 0) {
+        unsigned eax, ebx, ecx, edx;
+        bool sse41 = __get_cpuid(1, &eax, &ebx, &ecx, &edx) &&
+                     (ecx & bit_SSE4_1);
+        bool sha = __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) &&
+                   (ebx & bit_SHA);
+
+        has_shani = sse41 && sha;
+    }
+    return has_shani;
+}
+
+/*
+ * SHA256 block compression with the x86 SHA extensions. The state is kept as
+ * ABEF and CDGH in two registers, as the sha256rnds2 instruction expects.
+ */
+__attribute__((target("sha,sse4.1")))
+static void sha2xx_transform_shani(uint32_t *state, const unsigned char *blocks,
+                                   size_t numof)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                         0x0405060700010203ULL);
+    __m128i tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+    __m128i state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+
+    tmp = _mm_shuffle_epi32(tmp, 0xb1);                 /* CDAB */
+    state1 = _mm_shuffle_epi32(state1, 0x1b);           /* EFGH */
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);   /* ABEF */
+    state1 = _mm_blend_epi16(state1, tmp, 0xf0);        /* CDGH */
+
+    while (numof--) {
+        __m128i abef = state0;
+        __m128i cdgh = state1;
+        __m128i W[4];
+
+        for (int i = 0; i < 4; i++) {
+            W[i] = _mm_shuffle_epi8(
+                _mm_loadu_si128((const __m128i *)&blocks[i * 16]), bswap);
+        }
+
+        /* 16 times 4 rounds, computing the next 4 words of W meanwhile */
+        for (int i = 0; i < 16; i++) {
+            __m128i msg = _mm_add_epi32(W[i % 4],
+                                        _mm_loadu_si128((const __m128i *)&K[i * 4]));
+
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            state0 = _mm_sha256rnds2_epu32(state0, state1,
+                                           _mm_shuffle_epi32(msg, 0x0e));
+            if (i < 12) {
+                __m128i w = _mm_sha256msg1_epu32(W[i % 4], W[(i + 1) % 4]);
+
+                w = _mm_add_epi32(w, _mm_alignr_epi8(W[(i + 3) % 4],
+                                                     W[(i + 2) % 4], 4));
+                W[i % 4] = _mm_sha256msg2_epu32(w, W[(i + 3) % 4]);
+            }
+        }
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+        blocks += 64;
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1b);              /* FEBA */
+    state1 = _mm_shuffle_epi32(state1, 0xb1);           /* DCHG */
+    state0 = _mm_blend_epi16(tmp, state1, 0xf0);        /* DCBA */
+    state1 = _mm_alignr_epi8(state1, tmp, 8);           /* HGFE */
+    _mm_storeu_si128((__m128i *)&state[0], state0);
+    _mm_storeu_si128((__m128i *)&state[4], state1);
+}
+#endif /* SHA2XX_SHANI */
+
+#if SHA2XX_ARMV8
+/*
+ * SHA256 block compression with the ARMv8 cryptography extensions.
+ */
+static void sha2xx_transform_armv8(uint32_t *state, const unsigned char *blocks,
+                                   size_t numof)
+{
+    uint32x4_t abcd = vld1q_u32(&state[0]);
+    uint32x4_t efgh = vld1q_u32(&state[4]);
+
+    while (numof--) {
+        uint32x4_t abcd_save = abcd;
+        uint32x4_t efgh_save = efgh;
+        uint32x4_t W[4];
+
+        for (int i = 0; i < 4; i++) {
+            W[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&blocks[i * 16])));
+        }
+
+        /* 16 times 4 rounds, computing the next 4 words of W meanwhile */
+        for (int i = 0; i < 16; i++) {
+            uint32x4_t wk = vaddq_u32(W[i % 4], vld1q_u32(&K[i * 4]));
+            uint32x4_t abcd_prev = abcd;
+
+            abcd = vsha256hq_u32(abcd, efgh, wk);
+            efgh = vsha256h2q_u32(efgh, abcd_prev, wk);
+            if (i < 12) {
+                W[i % 4] = vsha256su1q_u32(vsha256su0q_u32(W[i % 4],
+                                                           W[(i + 1) % 4]),
+                                           W[(i + 2) % 4], W[(i + 3) % 4]);
+            }
+        }
+
+        abcd = vaddq_u32(abcd, abcd_save);
+        efgh = vaddq_u32(efgh, efgh_save);
+        blocks += 64;
+    }
+
+    vst1q_u32(&state[0], abcd);
+    vst1q_u32(&state[4], efgh);
+}
+#endif /* SHA2XX_ARMV8 */
+
+void sha2xx_transform_blocks(uint32_t *state, const void *blocks, size_t numof)
+{
+    const unsigned char *src = blocks;
+
+#if SHA2XX_SHANI
+    if (_has_shani()) {
+        sha2xx_transform_shani(state, src, numof);
+        return;
+    }
+#elif SHA2XX_ARMV8
+    sha2xx_transform_armv8(state, src, numof);
+    return;
+#endif
+
+    while (numof--) {
+        sha2xx_transform(state, src);
+        src += 64;
+    }
+}
+
 static const unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -199,21 +352,21 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
         return;
     }
 
-    /* Finish the current block */
     const unsigned char *src = data;
 
-    memcpy(&ctx->buf[r], src, f);
-    sha2xx_transform(ctx->state, ctx->buf);
-    src += f;
-    len -= f;
-
-    /* Perform complete blocks */
-    while (len >= 64) {
-        sha2xx_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
+    /* Finish the current block */
+    if (r) {
+        memcpy(&ctx->buf[r], src, f);
+        sha2xx_transform_blocks(ctx->state, ctx->buf, 1);
+        src += f;
+        len -= f;
     }
 
+    /* Perform complete blocks at once */
+    sha2xx_transform_blocks(ctx->state, src, len / 64);
+    src += len & ~(size_t)63;
+    len &= 63;
+
     /* Copy left over data into buffer */
     memcpy(ctx->buf, src, len);
 }
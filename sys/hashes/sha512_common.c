@@ -154,6 +154,17 @@ static void sha512_transform(uint64_t *state, const unsigned char block[128])
     }
 }
 
+void sha512_common_transform_blocks(uint64_t *state, const void *blocks,
+                                    size_t numof)
+{
+    const unsigned char *src = blocks;
+
+    while (numof--) {
+        sha512_transform(state, src);
+        src += 128;
+    }
+}
+
 static const unsigned char PAD[128] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -216,21 +227,21 @@ void sha512_common_update(sha512_common_context_t *ctx, const void *data, size_t
         return;
     }
 
-    /* Finish the current block */
     const unsigned char *src = data;
 
-    memcpy(&ctx->buf[r], src, f);
-    sha512_transform(ctx->state, ctx->buf);
-    src += f;
-    len -= f;
-
-    /* Perform complete blocks */
-    while (len >= 128) {
-        sha512_transform(ctx->state, src);
-        src += 128;
-        len -= 128;
+    /* Finish the current block */
+    if (r) {
+        memcpy(&ctx->buf[r], src, f);
+        sha512_transform(ctx->state, ctx->buf);
+        src += f;
+        len -= f;
     }
 
+    /* Perform complete blocks at once */
+    sha512_common_transform_blocks(ctx->state, src, len / 128);
+    src += len & ~(size_t)127;
+    len &= 127;
+
     /* Copy left over data into buffer */
     memcpy(ctx->buf, src, len);
 }
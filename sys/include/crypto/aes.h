@@ -24,11 +24,20 @@
  * key size can be disabled with `DISABLE_MODULE += crypto_aes_128` as an
  * optimization.
  *
+ * The default implementation looks up tables indexed by key and data, so its
+ * timing depends on both, and it expands the key for every block. With
+ * `USEMODULE += crypto_aes_ct`, encryption uses a bitsliced implementation
+ * without tables and branches that depend on secrets, or the AES instructions
+ * on x86 CPUs that have them. The expanded key is kept in the
+ * @ref cipher_context_t, which grows to up to 512 bytes. Decryption always
+ * uses the tables, as CTR, CCM and GCM only encrypt.
+ *
  * @author      Nicolai Schmittberger <nicolai.schmittberger@fu-berlin.de>
  * @author      Fabrice Bellard
  * @author      Zakaria Kasmi <zkasmi@inf.fu-berlin.de>
  */
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "compiler_hints.h"
@@ -109,6 +118,25 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize);
 int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
                 uint8_t *cipher_block);
 
+/**
+ * @brief   Encrypts several blocks
+ *
+ * Faster than calling aes_encrypt() for each block, as the key is expanded
+ * only once and several blocks are encrypted at a time.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            encryption
+ * @param       plain         the plaintext, @p numof blocks
+ * @param       cipher        where to store the ciphertext, @p numof blocks,
+ *                            may be @p plain
+ * @param       numof         number of blocks
+ *
+ * @retval      1             success
+ * @retval      <0            error, see aes_encrypt()
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t numof);
+
 /**
  * @brief   Decrypts one cipher-block and saves the plain-block in @p plain_block.
  *          Decrypts one blocksize long block of ciphertext pointed to by
@@ -130,6 +158,38 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
 int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
                 uint8_t *plain_block);
 
+#if IS_USED(MODULE_CRYPTO_AES_CT) || defined(DOXYGEN)
+/**
+ * @brief   Size of a bitsliced round key of the constant-time implementation
+ */
+#define AES_CT_ROUND_KEY_SIZE   32
+
+/**
+ * @brief   Expands a key for the constant-time implementation
+ *
+ * @internal
+ *
+ * @param[out]  schedule    `AES_CT_ROUND_KEY_SIZE * (key_size / 4 + 7)` bytes
+ * @param[in]   key         the key
+ * @param[in]   key_size    size of @p key in bytes
+ */
+void aes_ct_init(uint8_t *schedule, const uint8_t *key, uint8_t key_size);
+
+/**
+ * @brief   Encrypts blocks with the constant-time implementation
+ *
+ * @internal
+ *
+ * @param[in]   schedule    the key as expanded by aes_ct_init()
+ * @param[in]   key_size    size of the key in bytes
+ * @param[in]   in          @p numof blocks to encrypt
+ * @param[out]  out         the encrypted blocks, may be @p in
+ * @param[in]   numof       number of blocks
+ */
+void aes_ct_encrypt_blocks(const uint8_t *schedule, uint8_t key_size,
+                           const uint8_t *in, uint8_t *out, size_t numof);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -62,10 +62,23 @@ int chacha_init(chacha_ctx *ctx,
  *          encrypted blocks, or the keystream will repeat!
  *
  * @param[in,out] ctx The ChaCha context
- * @param[out]    x   The block of the keystream (`sizeof(x) == 64`).
+ * @param[out]    x   The block of the keystream (`sizeof(x) == 64`),
+ *                    aligned to `uint32_t`.
  */
 void chacha_keystream_bytes(chacha_ctx *ctx, void *x);
 
+/**
+ * @brief Generate the next blocks in the keystream.
+ * @details The same as calling chacha_keystream_bytes() @p numof times. With
+ *          the module `crypto_chacha_simd`, four blocks (SSE2, NEON) or eight
+ *          blocks (AVX2) are computed in parallel.
+ * @param[in,out] ctx   The ChaCha context
+ * @param[out]    x     The blocks of the keystream (`sizeof(x) == 64 * numof`),
+ *                      aligned to `uint32_t`.
+ * @param[in]     numof Number of blocks to generate
+ */
+void chacha_keystream_blocks(chacha_ctx *ctx, void *x, size_t numof);
+
 /**
  * @brief Encode or decode a block of data.
  *
@@ -18,6 +18,7 @@
  * @author      Mark Essien <markessien@gmail.com>
  */
 
+#include <stddef.h>
 #include <stdint.h>
 #include "modules.h"
 
@@ -48,7 +49,12 @@ extern "C" {
  *
  * aes          needs CIPHERS_MAX_KEY_SIZE bytes          <br>
  */
-#if IS_USED(MODULE_CRYPTO_AES_256) || IS_USED(MODULE_CRYPTO_AES_192) || \
+#if IS_USED(MODULE_CRYPTO_AES_CT)
+/* the key and the bitsliced key schedule: 32 bytes for each of the
+ * key size / 4 + 7 round keys */
+    #define CIPHER_MAX_CONTEXT_SIZE (CIPHERS_MAX_KEY_SIZE + \
+                                     32 * (CIPHERS_MAX_KEY_SIZE / 4 + 7))
+#elif IS_USED(MODULE_CRYPTO_AES_256) || IS_USED(MODULE_CRYPTO_AES_192) || \
     IS_USED(MODULE_CRYPTO_AES_128)
     #define CIPHER_MAX_CONTEXT_SIZE CIPHERS_MAX_KEY_SIZE
 #else
@@ -98,6 +104,12 @@ typedef struct cipher_interface_st {
     /** @brief the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief the function to encrypt several blocks at once, may be NULL
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *plain,
+                          uint8_t *cipher, size_t numof);
 } cipher_interface_t;
 
 /** Pointer type to BlockCipher-Interface for the Cipher-Algorithms */
@@ -153,6 +165,24 @@ int cipher_init(cipher_t *cipher, cipher_id_t cipher_id, const uint8_t *key,
 int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
+/**
+ * @brief Encrypt several blocks of BLOCK_SIZE length
+ *
+ * Ciphers may encrypt several blocks faster than one after the other, e.g. AES
+ * with `crypto_aes_ct`.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to @p numof blocks to encrypt
+ * @param output     pointer to allocated memory for @p numof encrypted blocks,
+ *                   may be @p input
+ * @param numof      number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t numof);
+
 /**
  * @brief Decrypt data of BLOCK_SIZE length
  * *
@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file        gcm.h
+ * @brief       Galois/Counter Mode (GCM) AEAD mode as specified in
+ *              NIST SP 800-38D
+ *
+ * The hash is computed without tables, so its timing does not depend on the
+ * key or the data. With `crypto_aes_ct` on x86 CPUs that have PCLMULQDQ, the
+ * carry-less multiplication of the CPU is used.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "crypto/ciphers.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name GCM error codes
+ * @{
+ */
+
+/**
+ * Returned if an empty nonce was used
+ */
+#define GCM_ERR_INVALID_NONCE_LENGTH        (-2)
+/**
+ * GCM only works with ciphers with a block size of 128 bit
+ */
+#define GCM_ERR_INVALID_BLOCK_LENGTH        (-3)
+/**
+ * Returned if the amount of input data cannot be handled by this implementation
+ */
+#define GCM_ERR_INVALID_DATA_LENGTH         (-3)
+/**
+ * Returned if a tag of bad length was requested (not 4, 8 or 12 to 16 bytes)
+ */
+#define GCM_ERR_INVALID_TAG_LENGTH          (-4)
+/**
+ * Returned if the authentication failed during decryption
+ */
+#define GCM_ERR_INVALID_TAG                 (-5)
+
+/** @} */
+
+/**
+ * @brief Block size required for the cipher. GCM is only defined for 128 bit ciphers.
+ */
+#define GCM_BLOCK_SIZE                      16
+
+/**
+ * @brief Length of the nonce for which GCM is fastest, 96 bits
+ */
+#define GCM_NONCE_LEN                       12
+
+/**
+ * @brief Encrypt and authenticate data of arbitrary length in GCM mode.
+ *
+ * @param cipher           Already initialized cipher struct
+ * @param auth_data        Additional data to authenticate in the tag
+ * @param auth_data_len    Length of additional data
+ * @param tag_len          Length of the appended tag (4, 8 or 12 to 16 bytes)
+ * @param nonce            Nonce for the encryption (must be unique)
+ * @param nonce_len        Length of the nonce in bytes, preferably
+ *                         @ref GCM_NONCE_LEN
+ * @param input            pointer to input data to encrypt
+ * @param input_len        length of the input data.
+ *                         input_len + tag_len must be smaller than INT32_MAX (2^31-1)
+ * @param output           pointer to allocated memory for encrypted data.
+ *                         The tag will be appended to the ciphertext.
+ *                         It has to be of size data_len + tag_len.
+ * @return                 Length of the encrypted data (including the tag) or a (negative) error code
+ */
+int32_t cipher_encrypt_gcm(const cipher_t *cipher,
+                           const uint8_t *auth_data, size_t auth_data_len,
+                           uint8_t tag_len,
+                           const uint8_t *nonce, size_t nonce_len,
+                           const uint8_t *input, size_t input_len,
+                           uint8_t *output);
+
+/**
+ * @brief Decrypt and verify the authentication of GCM encrypted data.
+ *
+ * @param cipher           Already initialized cipher struct
+ * @param auth_data        Additional data to authenticate in the tag
+ * @param auth_data_len    Length of additional data
+ * @param tag_len          Length of the appended tag (4, 8 or 12 to 16 bytes)
+ * @param nonce            Nonce for the encryption (must be unique)
+ * @param nonce_len        Length of the nonce in bytes
+ * @param input            pointer to the ciphertext with the tag appended
+ * @param input_len        length of the input data.
+ *                         input_len - tag_len must be smaller than INT32_MAX (2^31-1)
+ * @param output           pointer to allocated memory for the plaintext data.
+ *                         It has to be of size input_len - tag_len.
+ *                         It is not written to if the authentication fails.
+ * @return                 Length of the plaintext data or a (negative) error code
+ */
+int32_t cipher_decrypt_gcm(const cipher_t *cipher,
+                           const uint8_t *auth_data, size_t auth_data_len,
+                           uint8_t tag_len,
+                           const uint8_t *nonce, size_t nonce_len,
+                           const uint8_t *input, size_t input_len,
+                           uint8_t *output);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
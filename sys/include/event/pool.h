@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_event_pool Event thread pool
+ * @ingroup     sys_event
+ * @brief       Runs events in a pool of worker threads that steal work from
+ *              each other
+ *
+ * To activate, use `USEMODULE += event_pool` in your application's Makefile.
+ *
+ * An @ref event_queue_t is served by exactly one thread, so while an event
+ * handler waits, e.g. for a bus transfer, a timer or a mutex, all other events
+ * of that queue wait as well. An event pool has several worker threads of the
+ * same priority, each with a queue of its own:
+ *
+ * - Events are posted to an idle worker if there is one, else to the queues of
+ *   the workers in turn. @ref event_pool_post_batch() posts several events
+ *   with interrupts disabled only once.
+ * - A worker whose queue is empty takes events from the queues of the other
+ *   workers before it goes to sleep.
+ *
+ * So events are only held up while all workers are busy. Events posted to a
+ * pool may run concurrently and in any order.
+ *
+ * @note    RIOT runs one thread at a time, so a pool does not speed up
+ *          handlers that compute without waiting.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * #define WORKERS  (4)
+ *
+ * static char _stacks[WORKERS][THREAD_STACKSIZE_DEFAULT];
+ * static event_pool_worker_t _workers[WORKERS];
+ * static event_pool_t _pool;
+ *
+ * event_pool_init(&_pool, _workers, WORKERS, _stacks[0], sizeof(_stacks[0]),
+ *                 THREAD_PRIORITY_MAIN - 1);
+ * event_pool_post(&_pool, &event);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event thread pool API
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of workers of a pool
+ */
+#define EVENT_POOL_WORKERS_MAX      (32U)
+
+/**
+ * @brief   Event pool forward declaration
+ */
+typedef struct event_pool event_pool_t;
+
+/**
+ * @brief   A worker of an event pool
+ *
+ * The contents of this structure are internal.
+ */
+typedef struct {
+    event_queue_t queue;    /**< events posted to this worker */
+    event_pool_t *pool;     /**< the pool of this worker */
+} event_pool_worker_t;
+
+/**
+ * @brief   Event pool
+ *
+ * The contents of this structure are internal.
+ */
+struct event_pool {
+    event_pool_worker_t *workers;   /**< the workers */
+    uint8_t numof;                  /**< number of workers */
+    uint8_t next;                   /**< worker to post to if none is idle */
+    uint32_t idle;                  /**< bitmap of idle workers */
+};
+
+/**
+ * @brief   Starts the workers of a pool
+ *
+ * @param[out] pool         The pool.
+ * @param[out] workers      Memory for @p numof workers.
+ * @param[in] numof         Number of workers, at most
+ *                          @ref EVENT_POOL_WORKERS_MAX.
+ * @param[in] stacks        Stacks of the workers, @p numof times
+ *                          @p stack_size bytes.
+ * @param[in] stack_size    Stack size of each worker.
+ * @param[in] priority      Priority of the workers.
+ */
+void event_pool_init(event_pool_t *pool, event_pool_worker_t *workers,
+                     unsigned numof, char *stacks, size_t stack_size,
+                     uint8_t priority);
+
+/**
+ * @brief   Queues an event in a pool
+ *
+ * As with @ref event_post(), an event that is already queued is not queued
+ * again.
+ *
+ * @note    Safe to call from interrupt context.
+ *
+ * @param[in] pool      The pool.
+ * @param[in] event     The event.
+ */
+void event_pool_post(event_pool_t *pool, event_t *event);
+
+/**
+ * @brief   Queues several events in a pool
+ *
+ * The events are spread over the workers. Events that are already queued are
+ * not queued again.
+ *
+ * @note    Safe to call from interrupt context.
+ *
+ * @param[in] pool      The pool.
+ * @param[in] events    The events.
+ * @param[in] numof     Number of events.
+ */
+void event_pool_post_batch(event_pool_t *pool, event_t **events, size_t numof);
+
+/**
+ * @brief   Removes an event from a pool
+ *
+ * Does nothing if @p event is not queued, e.g. because it runs already.
+ *
+ * @param[in] pool      The pool.
+ * @param[in] event     The event.
+ */
+void event_pool_cancel(event_pool_t *pool, event_t *event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
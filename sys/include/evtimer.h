@@ -28,6 +28,16 @@
  * - when a number of timeouts with the same callback function need to be
  *   scheduled, evtimer is using less RAM (due to storing the callback function
  *   only once), while each ztimer has a function pointer for the callback.
+ *
+ * By default, events are kept in a list sorted by time, so adding and removing
+ * an event walks the list. With hundreds of events, use the module
+ * `evtimer_heap`: events are kept in a pairing heap then, which takes
+ * O(log n) to add an event (amortized) and finds the next event in O(1), at
+ * the cost of two more pointers per event. Removing an event first looks it
+ * up among the events due no later than it, so an event never added can be
+ * removed safely as with the list. Events due at the same time may fire in any
+ * order then. Use evtimer_first_event() and evtimer_next_event() to go through
+ * the events independent of the module.
  * @{
  *
  * @file
@@ -50,8 +60,21 @@ extern "C" {
  * @brief   Generic event
  */
 typedef struct evtimer_event {
-    struct evtimer_event *next; /**< the next event in the queue */
-    uint32_t offset;            /**< offset in milliseconds from previous event */
+    struct evtimer_event *next; /**< the next event in the queue, the next
+                                     sibling with `evtimer_heap` */
+    /**
+     * @brief   offset in milliseconds from previous event
+     *
+     * Set to the offset from now before evtimer_add(). With `evtimer_heap`,
+     * this is the time of the event (of @ref ZTIMER_MSEC) once added, and 0
+     * again once it fired.
+     */
+    uint32_t offset;
+#if IS_USED(MODULE_EVTIMER_HEAP) || defined(DOXYGEN)
+    struct evtimer_event *child;    /**< first child, with `evtimer_heap` */
+    struct evtimer_event *prev;     /**< parent if first child, else previous
+                                         sibling, with `evtimer_heap` */
+#endif
 } evtimer_event_t;
 
 /**
@@ -64,10 +87,12 @@ typedef void(*evtimer_callback_t)(evtimer_event_t* event);
  */
 typedef struct {
     ztimer_t timer;                 /**< Timer */
-    uint32_t base;                  /**< Absolute time the first event is built on */
+    uint32_t base;                  /**< Absolute time the first event is built on,
+                                         no event is earlier with `evtimer_heap` */
     evtimer_callback_t callback;    /**< Handler function for this evtimer's
                                          event type */
-    evtimer_event_t *events;        /**< Event queue */
+    evtimer_event_t *events;        /**< Event queue, the root with
+                                         `evtimer_heap` */
 } evtimer_t;
 
 /**
@@ -98,6 +123,41 @@ void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event);
  */
 void evtimer_del(evtimer_t *evtimer, evtimer_event_t *event);
 
+/**
+ * @brief   Gets the first event of an event timer to go through its events
+ *
+ * @param[in] evtimer   An event timer
+ *
+ * @return  The first event, the next one to fire.
+ * @retval  NULL if there are no events.
+ */
+static inline evtimer_event_t *evtimer_first_event(const evtimer_t *evtimer)
+{
+    return evtimer->events;
+}
+
+/**
+ * @brief   Gets the event after @p event
+ *
+ * The events are in the order they fire, but with `evtimer_heap` only the
+ * first one is.
+ *
+ * @note    Do not add or remove events while going through the events.
+ *
+ * @param[in] event     An event of an event timer
+ *
+ * @return  The next event.
+ * @retval  NULL if @p event was the last one.
+ */
+#if IS_USED(MODULE_EVTIMER_HEAP) || defined(DOXYGEN)
+evtimer_event_t *evtimer_next_event(const evtimer_event_t *event);
+#else
+static inline evtimer_event_t *evtimer_next_event(const evtimer_event_t *event)
+{
+    return event->next;
+}
+#endif
+
 /**
  * @brief   Print overview of current state of an event timer
  *
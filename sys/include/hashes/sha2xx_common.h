@@ -44,6 +44,22 @@ typedef struct {
     unsigned char buf[64];
 } sha2xx_context_t;
 
+/**
+ * @brief Compresses whole blocks into a SHA-2XX state
+ *
+ * This is the core of sha2xx_update(), for callers that keep their own
+ * state, e.g. to hash data that is already split into blocks. With the module
+ * `hashes_sha2_accel`, the SHA instructions of the CPU are used where
+ * available: the SHA extensions on x86 (checked at runtime) and the ARMv8
+ * cryptography extensions (if enabled for the compiler).
+ *
+ * @param state         State of the hash, initialized with the initial hash
+ *                      value
+ * @param[in] blocks    Input data, need not be aligned
+ * @param[in] numof     Number of 64 byte blocks in @p blocks
+ */
+void sha2xx_transform_blocks(uint32_t *state, const void *blocks, size_t numof);
+
 /**
  * @brief SHA-2XX initialization.  Begins a SHA-2XX operation.
  *
@@ -36,6 +36,20 @@ typedef struct {
     unsigned char buf[128];
 } sha512_common_context_t;
 
+/**
+ * @brief Compresses whole blocks into a SHA-512 state
+ *
+ * This is the core of sha512_common_update(), for callers that keep their
+ * own state, e.g. to hash data that is already split into blocks.
+ *
+ * @param state         State of the hash, initialized with the initial hash
+ *                      value
+ * @param[in] blocks    Input data, need not be aligned
+ * @param[in] numof     Number of 128 byte blocks in @p blocks
+ */
+void sha512_common_transform_blocks(uint64_t *state, const void *blocks,
+                                    size_t numof);
+
 /**
  * @brief SHA-512 initialization.  Begins a SHA-512 operation.
  *
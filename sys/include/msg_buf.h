@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_msg_buf Buffer messages
+ * @ingroup     sys
+ * @brief       Passes pool-allocated buffers between threads and ISRs
+ *              without copying
+ *
+ * To activate, use `USEMODULE += msg_buf` in your application's Makefile.
+ *
+ * A @ref msg_t only carries a pointer, so whoever passes a buffer with it has
+ * to agree with the receiver on who frees the buffer and when. This module
+ * attaches buffers from a fixed-size pool (see @ref sys_memarray) to messages
+ * with a simple rule: the sender owns a buffer until it is sent and the
+ * receiver owns it afterwards, until it calls msg_buf_free(). Each buffer
+ * knows its pool and its length, so the receiver needs neither.
+ *
+ * If a buffer cannot be delivered, e.g. because the message queue of the
+ * receiver is full when sending from an ISR, it is freed, so no buffer is
+ * lost on the way. Allocating and freeing buffers is safe in interrupt
+ * context, so a driver ISR can fill a buffer and hand it to a worker thread:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static MSG_BUF_POOL_MEM(_mem, FRAME_SIZE, 4);
+ * static msg_buf_pool_t _pool;
+ *
+ * // once: msg_buf_pool_init(&_pool, _mem, FRAME_SIZE, 4);
+ *
+ * static void _isr(void *arg)
+ * {
+ *     uint8_t *frame = msg_buf_alloc(&_pool);
+ *
+ *     if (frame) {
+ *         size_t len = _read_frame(frame, FRAME_SIZE);
+ *         msg_t msg = { .type = MSG_TYPE_FRAME };
+ *
+ *         msg_buf_send(&msg, _worker_pid, frame, len);
+ *     }
+ * }
+ *
+ * static void *_worker(void *arg)
+ * {
+ *     ...
+ *     while (1) {
+ *         msg_t msg;
+ *         size_t len;
+ *
+ *         msg_receive(&msg);
+ *         uint8_t *frame = msg_buf_get(&msg, &len);
+ *         _handle_frame(frame, len);
+ *         msg_buf_free(frame);
+ *     }
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief   @ref sys_msg_buf API
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memarray.h"
+#include "msg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   A pool of buffers of the same size
+ */
+typedef struct {
+    memarray_t mem;     /**< the buffers (internal) */
+} msg_buf_pool_t;
+
+/**
+ * @brief   Header of a buffer, in front of its data
+ *
+ * @internal
+ */
+typedef struct {
+    msg_buf_pool_t *pool;   /**< the pool the buffer belongs to */
+    size_t len;             /**< number of bytes sent */
+} msg_buf_hdr_t;
+
+/**
+ * @brief   Size of a buffer of @p size bytes in the memory of its pool
+ */
+#define MSG_BUF_ELEM_SIZE(size) \
+    ((sizeof(msg_buf_hdr_t) + (size) + sizeof(uintptr_t) - 1) \
+     & ~(sizeof(uintptr_t) - 1))
+
+/**
+ * @brief   Defines the memory of a pool
+ *
+ * @param[in] name  Name of the array.
+ * @param[in] size  Size of a buffer in bytes.
+ * @param[in] num   Number of buffers.
+ */
+#define MSG_BUF_POOL_MEM(name, size, num) \
+    uintptr_t name[(MSG_BUF_ELEM_SIZE(size) / sizeof(uintptr_t)) * (num)]
+
+/**
+ * @brief   Initializes a pool
+ *
+ * @param[out] pool     The pool.
+ * @param[in] mem       Memory of the pool, see @ref MSG_BUF_POOL_MEM.
+ * @param[in] size      Size of a buffer in bytes.
+ * @param[in] num       Number of buffers.
+ */
+void msg_buf_pool_init(msg_buf_pool_t *pool, void *mem, size_t size,
+                       size_t num);
+
+/**
+ * @brief   Allocates a buffer
+ *
+ * @note    Safe to call from interrupt context.
+ *
+ * @param[in] pool      The pool.
+ *
+ * @return  The data of the buffer, owned by the caller.
+ * @retval  NULL if all buffers of @p pool are in use.
+ */
+void *msg_buf_alloc(msg_buf_pool_t *pool);
+
+/**
+ * @brief   Returns a buffer to its pool
+ *
+ * @note    Safe to call from interrupt context.
+ *
+ * @param[in] data      Data of a buffer, as returned by msg_buf_alloc().
+ *                      May be NULL.
+ */
+void msg_buf_free(void *data);
+
+/**
+ * @brief   Gets the number of bytes a buffer can hold
+ *
+ * @param[in] data      Data of a buffer, as returned by msg_buf_alloc().
+ *
+ * @return  The size of the buffer.
+ */
+size_t msg_buf_size(const void *data);
+
+/**
+ * @brief   Gets the number of free buffers of a pool
+ *
+ * @param[in] pool      The pool.
+ *
+ * @return  The number of buffers msg_buf_alloc() can return.
+ */
+size_t msg_buf_available(msg_buf_pool_t *pool);
+
+/**
+ * @brief   Sends a buffer with a message, see @ref msg_send()
+ *
+ * Ownership of the buffer moves to the receiver. If the message is not
+ * delivered, the buffer is freed.
+ *
+ * @param[in,out] m     The message, msg_t::type set by the caller.
+ * @param[in] target_pid    PID of the receiver.
+ * @param[in] data      Data of a buffer, as returned by msg_buf_alloc().
+ * @param[in] len       Number of bytes used in @p data.
+ *
+ * @return  see @ref msg_send()
+ */
+int msg_buf_send(msg_t *m, kernel_pid_t target_pid, void *data, size_t len);
+
+/**
+ * @brief   Sends a buffer with a message without blocking, see
+ *          @ref msg_try_send()
+ *
+ * Ownership of the buffer moves to the receiver. If the message is not
+ * delivered, the buffer is freed.
+ *
+ * @param[in,out] m     The message, msg_t::type set by the caller.
+ * @param[in] target_pid    PID of the receiver.
+ * @param[in] data      Data of a buffer, as returned by msg_buf_alloc().
+ * @param[in] len       Number of bytes used in @p data.
+ *
+ * @return  see @ref msg_try_send()
+ */
+int msg_buf_try_send(msg_t *m, kernel_pid_t target_pid, void *data,
+                     size_t len);
+
+/**
+ * @brief   Gets the buffer of a received message
+ *
+ * The caller owns the buffer and has to pass it on or free it with
+ * msg_buf_free().
+ *
+ * @param[in] m         A message sent with msg_buf_send() or
+ *                      msg_buf_try_send().
+ * @param[out] len      Number of bytes used in the buffer. May be NULL.
+ *
+ * @return  The data of the buffer.
+ */
+static inline void *msg_buf_get(const msg_t *m, size_t *len)
+{
+    if (len) {
+        *len = ((const msg_buf_hdr_t *)m->content.ptr - 1)->len;
+    }
+    return m->content.ptr;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
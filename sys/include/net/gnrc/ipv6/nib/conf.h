@@ -75,6 +75,14 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_DNS                    1
 #endif
 
+#ifdef MODULE_GNRC_IPV6_NIB_LPM
+#  define CONFIG_GNRC_IPV6_NIB_OFFL_LPM               1
+#endif
+
+#ifdef MODULE_GNRC_IPV6_NIB_NC_HASH
+#  define CONFIG_GNRC_IPV6_NIB_NC_HASH                1
+#endif
+
 /**
  * @name    Compile flags
  * @brief   Compile flags to (de-)activate certain features for NIB
@@ -298,6 +306,19 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_NUMOF                 (4)
 #endif
 
+/**
+ * @brief   Index the on-link entries in a hash table
+ *
+ * Without the index, resolving an address to a neighbor compares it with all
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF on-link entries. With it, the lookup takes
+ * constant time on average, at the cost of
+ * `2 * CONFIG_GNRC_IPV6_NIB_NUMOF` pointers of RAM. Enable it for border
+ * routers with large neighbor caches.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_HASH
+#  define CONFIG_GNRC_IPV6_NIB_NC_HASH               0
+#endif
+
 /**
  * @brief Per-neighbor packet queue capacity
  *
@@ -320,6 +341,19 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF            (8)
 #endif
 
+/**
+ * @brief   Index the off-link entries in a longest-prefix-match trie
+ *
+ * Without the index, every route lookup compares the destination with all
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF off-link entries. With it, a lookup
+ * only visits the trie nodes along the destination's prefix, at the cost of
+ * `2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF` trie nodes of RAM. Enable it for
+ * routers with many forwarding table entries.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_LPM
+#  define CONFIG_GNRC_IPV6_NIB_OFFL_LPM              0
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_netapi_batch  Batched packet dispatch
+ * @ingroup     net_gnrc_netapi
+ * @brief       Passes bursts of received packets up the stack in one message
+ *
+ * To activate, use `USEMODULE += gnrc_netapi_batch` in your application's
+ * Makefile.
+ *
+ * @ref gnrc_netapi_dispatch_receive() sends one message per packet and
+ * receiver, so every packet of a burst pays for a message (and possibly a
+ * context switch) at every layer. With this module, a layer that works
+ * through a burst collects the packets it passes up in a
+ * @ref gnrc_netapi_batch_t and dispatches them together with
+ * @ref gnrc_netapi_batch_flush(). Receivers that set
+ * @ref gnrc_netreg_entry_t::batch get all packets of a batch in a single
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message, all other receivers get one
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV message per packet as before.
+ *
+ * A receiver handles a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message like this:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+ *     for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr); i++) {
+ *         _receive(gnrc_netapi_batch_get(msg.content.ptr, i));
+ *     }
+ *     gnrc_pktbuf_release(msg.content.ptr);
+ *     break;
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief   @ref net_gnrc_netapi_batch definitions
+ */
+
+#include <stdint.h>
+
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   @ref core_msg type for passing a batch of @ref net_gnrc_pkt up the
+ *          network stack
+ *
+ * gnrc_pktsnip_t::data of the message's snip holds the packets, see
+ * @ref gnrc_netapi_batch_numof() and @ref gnrc_netapi_batch_get(). The
+ * receiver owns one reference to each of the packets and to the snip.
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_BATCH  (0x0208)
+
+/**
+ * @defgroup net_gnrc_netapi_batch_conf  Batched packet dispatch compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Maximum number of packets in a batch
+ *
+ * A full batch is dispatched right away. Receivers still see up to one
+ * message per batch in their queue, so this should not exceed the number of
+ * packets a receiver can keep up with in one go.
+ */
+#ifndef CONFIG_GNRC_NETAPI_BATCH_SIZE
+#define CONFIG_GNRC_NETAPI_BATCH_SIZE   (8U)
+#endif
+/** @} */
+
+/**
+ * @brief   Packets collected for the same receivers
+ */
+typedef struct {
+    uint32_t demux_ctx;         /**< demultiplexing context of the packets */
+    gnrc_nettype_t type;        /**< type of the packets */
+    unsigned numof;             /**< number of packets in gnrc_netapi_batch_t::pkts */
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_NETAPI_BATCH_SIZE];  /**< the packets */
+} gnrc_netapi_batch_t;
+
+/**
+ * @brief   Initializes an empty batch
+ *
+ * @param[out] batch    The batch.
+ */
+static inline void gnrc_netapi_batch_init(gnrc_netapi_batch_t *batch)
+{
+    batch->numof = 0;
+}
+
+/**
+ * @brief   Adds a packet to be passed to all subscribers to
+ *          (@p type, @p demux_ctx)
+ *
+ * The batch is flushed before, if it holds packets for other subscribers, and
+ * after, if it is full.
+ *
+ * @param[in,out] batch     The batch.
+ * @param[in] type          Type of the packet.
+ * @param[in] demux_ctx     Demultiplexing context of the packet.
+ * @param[in] pkt           The packet. Ownership is passed to @p batch, it
+ *                          is released if there are no subscribers.
+ */
+void gnrc_netapi_batch_receive(gnrc_netapi_batch_t *batch, gnrc_nettype_t type,
+                               uint32_t demux_ctx, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Passes the packets of a batch to their subscribers
+ *
+ * Subscribers with gnrc_netreg_entry_t::batch set get a single
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message, all others a
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV message per packet. Packets without
+ * subscribers are released. @p batch is empty afterwards.
+ *
+ * @param[in,out] batch     The batch.
+ *
+ * @return  The number of subscribers to the packets of @p batch.
+ */
+int gnrc_netapi_batch_flush(gnrc_netapi_batch_t *batch);
+
+/**
+ * @brief   Gets the number of packets of a received batch
+ *
+ * @param[in] batch The snip of a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message.
+ *
+ * @return  The number of packets in @p batch.
+ */
+static inline unsigned gnrc_netapi_batch_numof(const gnrc_pktsnip_t *batch)
+{
+    return batch->size / sizeof(gnrc_pktsnip_t *);
+}
+
+/**
+ * @brief   Gets a packet of a received batch
+ *
+ * @pre `idx < gnrc_netapi_batch_numof(batch)`
+ *
+ * @param[in] batch The snip of a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message.
+ * @param[in] idx   Index of the packet.
+ *
+ * @return  The packet, the receiver owns a reference to it.
+ */
+static inline gnrc_pktsnip_t *gnrc_netapi_batch_get(const gnrc_pktsnip_t *batch,
+                                                    unsigned idx)
+{
+    return ((gnrc_pktsnip_t **)batch->data)[idx];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -34,6 +34,7 @@
 #include "event.h"
 #include "msg.h"
 #include "net/gnrc/netapi.h"
+#include "net/gnrc/netapi/batch.h"
 #include "net/gnrc/netif/conf.h"
 #include "net/gnrc/netif/flags.h"
 #include "net/gnrc/pkt.h"
@@ -181,6 +182,16 @@ typedef struct {
      */
     gnrc_pktsnip_t *tx_pkt;
 #endif
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Collects the packets received while the ISR event is handled
+     *
+     * @details Only provided with module `gnrc_netapi_batch`
+     *
+     * NULL outside of the ISR event.
+     */
+    gnrc_netapi_batch_t *rx_batch;
+#endif
 #if (GNRC_NETIF_L2ADDR_MAXLEN > 0) || DOXYGEN
     /**
      * @brief   The link-layer address currently used as the source address
@@ -143,6 +143,15 @@ enum {
  */
 #define GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE          (0x00020000U)
 
+/**
+ * @brief   The network device completes the transport layer checksums of
+ *          outgoing frames
+ *
+ * Set on initialization if the device supports
+ * @ref NETOPT_L4_CSUM_OFFLOAD.
+ */
+#define GNRC_NETIF_FLAGS_L4_CSUM_OFFLOAD           (0x00040000U)
+
 /** @} */
 
 #ifdef __cplusplus
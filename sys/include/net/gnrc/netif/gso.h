@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_netif_gso Generic segmentation offload
+ * @ingroup     net_gnrc_netif
+ * @brief       Segments TCP super-segments right before they are sent
+ *
+ * To activate, use `USEMODULE += gnrc_netif_gso` in your application's
+ * Makefile (`USEMODULE += gnrc_tcp_gso` pulls it in).
+ *
+ * A transport layer may hand down a single TCP segment with more payload than
+ * fits into the MTU of the interface (a *super-segment*) by marking it with
+ * @ref gnrc_netif_hdr_set_gso(). The network layer fills in the headers
+ * once and the interface splits the super-segment into segments of at most
+ * @ref gnrc_netif_hdr_t::gso_size bytes of payload right before they are
+ * handed to the network device. Each segment gets a copy of the headers with
+ * the sequence number and lengths adjusted and its own checksum, so the
+ * traversal of the stack above the interface is paid once per super-segment
+ * instead of once per segment.
+ *
+ * @{
+ *
+ * @file
+ * @brief   @ref net_gnrc_netif_gso definitions
+ */
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Sends a segment of a super-segment
+ *
+ * @param[in] netif The network interface the super-segment is sent over.
+ * @param[in] pkt   The segment, starting with a @ref net_gnrc_netif_hdr.
+ *                  Ownership is passed to the callee.
+ */
+typedef void (*gnrc_netif_gso_send_t)(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Splits a super-segment into segments and sends them
+ *
+ * The TCP header of each segment has its sequence number adjusted, PSH and
+ * FIN are only kept on the last segment. If @p netif has
+ * @ref GNRC_NETIF_FLAGS_L4_CSUM_OFFLOAD set, the checksum is left to the
+ * network device, otherwise it is calculated in software.
+ *
+ * @pre `(netif != NULL) && (pkt != NULL) && (pkt->type == GNRC_NETTYPE_NETIF)`
+ * @pre `gnrc_netif_hdr_get_gso(pkt->data) > 0`
+ *
+ * @param[in] netif The network interface to send over.
+ * @param[in] pkt   A super-segment: a netif header, an IPv6 header, optional
+ *                  extension headers, a TCP header and the payload. Is
+ *                  always released.
+ * @param[in] send  Function to send each segment with.
+ *
+ * @return  Number of segments passed to @p send on success.
+ * @return  -ENOTSUP, if @p pkt does not carry an IPv6 TCP segment.
+ * @return  -ENOMEM, if a segment could not be allocated. Segments before it
+ *          were sent, the remaining payload is left to be retransmitted by
+ *          TCP.
+ */
+int gnrc_netif_gso_segment(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                           gnrc_netif_gso_send_t send);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -110,6 +110,27 @@ extern "C" {
  *          can be used to check for presence of a valid timestamp.
  */
 #define GNRC_NETIF_HDR_FLAGS_TIMESTAMP  (0x08)
+
+/**
+ * @brief   Transport layer checksum is left to the network device
+ *
+ * @details Set by the network layer for outgoing packets, if the interface
+ *          has @ref GNRC_NETIF_FLAGS_L4_CSUM_OFFLOAD set. The checksum field
+ *          of the transport layer header then only holds the sum of the
+ *          pseudo-header, see @ref NETOPT_L4_CSUM_OFFLOAD.
+ */
+#define GNRC_NETIF_HDR_FLAGS_CSUM_OFFLOAD  (0x04)
+
+/**
+ * @brief   Packet is a TCP super-segment to be segmented by the interface
+ *
+ * @details Only used with module `gnrc_netif_gso`. The packet may exceed the
+ *          MTU of the interface and is split into segments of at most
+ *          @ref gnrc_netif_hdr_t::gso_size bytes of payload right before it
+ *          is handed to the network device, see @ref net_gnrc_netif_gso.
+ *          Use @ref gnrc_netif_hdr_set_gso() to set this flag.
+ */
+#define GNRC_NETIF_HDR_FLAGS_GSO    (0x02)
 /**
  * @}
  */
@@ -151,6 +172,17 @@ typedef struct {
      */
     uint64_t timestamp;
 #endif /* MODULE_GNRC_NETIF_TIMESTAMP */
+#if IS_USED(MODULE_GNRC_NETIF_GSO) || defined(DOXYGEN)
+    /**
+     * @brief   Maximum payload size of the segments of a super-segment
+     *
+     * @note    Only when @ref GNRC_NETIF_HDR_FLAGS_GSO is set, this field
+     *          contains valid info.
+     *
+     * This field is only provided if module `gnrc_netif_gso` is used.
+     */
+    uint16_t gso_size;
+#endif /* MODULE_GNRC_NETIF_GSO */
 } gnrc_netif_hdr_t;
 
 /**
@@ -292,6 +324,44 @@ static inline int gnrc_netif_hdr_get_timestamp(const gnrc_netif_hdr_t *hdr,
     return -1;
 }
 
+/**
+ * @brief   Marks a packet as super-segment to be segmented by the interface
+ * @param[out]  hdr         Header of the packet
+ * @param[in]   gso_size    Maximum payload size of each segment
+ *
+ * @details If the module gnrc_netif_gso is not used, a call to this function
+ *          becomes a non-op (and will be fully optimized out by the compiler)
+ */
+static inline void gnrc_netif_hdr_set_gso(gnrc_netif_hdr_t *hdr,
+                                          uint16_t gso_size)
+{
+    (void)hdr;
+    (void)gso_size;
+#if IS_USED(MODULE_GNRC_NETIF_GSO)
+    hdr->gso_size = gso_size;
+    hdr->flags |= GNRC_NETIF_HDR_FLAGS_GSO;
+#endif
+}
+
+/**
+ * @brief   Get the maximum payload size of the segments of a super-segment
+ * @param[in]   hdr     Header of the packet
+ *
+ * @return  The segment size, if the packet is a super-segment
+ * @return  0, if the packet is not to be segmented. If the module
+ *          gnrc_netif_gso is not used, this will always be the case.
+ */
+static inline uint16_t gnrc_netif_hdr_get_gso(const gnrc_netif_hdr_t *hdr)
+{
+    (void)hdr;
+#if IS_USED(MODULE_GNRC_NETIF_GSO)
+    if (hdr->flags & GNRC_NETIF_HDR_FLAGS_GSO) {
+        return hdr->gso_size;
+    }
+#endif
+    return 0;
+}
+
 #if defined(MODULE_GNRC_IPV6) || defined(DOXYGEN)
 /**
  * @brief   Converts the source address of a given @ref net_gnrc_netif_hdr to
@@ -9,6 +9,12 @@
  * @defgroup    net_gnrc_netreg  Network protocol registry
  * @ingroup     net_gnrc
  * @brief       Registry to receive messages of a specified protocol type by GNRC.
+ *
+ * Entries are kept in a list per @ref gnrc_nettype_t, so a lookup compares
+ * the demultiplexing context of all entries of a type. With the
+ * `gnrc_netreg_hash` module, the entries of each type are spread over
+ * 2^@ref CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP lists by demultiplexing
+ * context instead, e.g. for a server with many bound UDP sockets.
  * @{
  *
  * @file
@@ -19,6 +25,7 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 
 #include "sched.h"
 #include "net/gnrc/nettype.h"
@@ -69,6 +76,22 @@ typedef enum {
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf  GNRC netreg compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of lists per @ref gnrc_nettype_t with `gnrc_netreg_hash`
+ *          (as exponent of 2^n)
+ *
+ * The registry takes `GNRC_NETTYPE_NUMOF * 2^n` pointers of RAM.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP
+#define CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP (3U)
+#endif
+/** @} */
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
@@ -76,6 +99,17 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Initializer for gnrc_netreg_entry_t::batch
+ *
+ * @internal
+ */
+#define _GNRC_NETREG_ENTRY_INIT_BATCH   , false
+#else
+#define _GNRC_NETREG_ENTRY_INIT_BATCH
+#endif
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
@@ -93,9 +127,11 @@ typedef enum {
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
-                                                      { pid } }
+                                                      { pid } \
+                                                      _GNRC_NETREG_ENTRY_INIT_BATCH }
 #else
-#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
+#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } \
+                                                      _GNRC_NETREG_ENTRY_INIT_BATCH }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -112,7 +148,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_MBOX(demux_ctx, _mbox) { NULL, demux_ctx, \
                                                        GNRC_NETREG_TYPE_MBOX, \
-                                                       { .mbox = _mbox } }
+                                                       { .mbox = _mbox } \
+                                                       _GNRC_NETREG_ENTRY_INIT_BATCH }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
@@ -129,7 +166,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_CB(demux_ctx, _cbd)   { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_CB, \
-                                                      { .cbd = _cbd } }
+                                                      { .cbd = _cbd } \
+                                                      _GNRC_NETREG_ENTRY_INIT_BATCH }
 /** @} */
 
 /**
@@ -207,6 +245,19 @@ typedef struct gnrc_netreg_entry {
         gnrc_netreg_entry_cbd_t *cbd;
 #endif
     } target;                   /**< Target for the registry entry */
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   The registering thread handles
+     *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH messages
+     *
+     * Initialized to `false` by the initialization helpers, set it before
+     * registering. Only used for entries of type
+     * @ref GNRC_NETREG_TYPE_DEFAULT.
+     *
+     * @note    Only available with @ref net_gnrc_netapi_batch.
+     */
+    bool batch;
+#endif
 } gnrc_netreg_entry_t;
 
 /**
@@ -276,6 +327,9 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
+#if defined(MODULE_GNRC_NETAPI_BATCH)
+    entry->batch = false;
+#endif
 }
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -297,6 +351,9 @@ static inline void gnrc_netreg_entry_init_mbox(gnrc_netreg_entry_t *entry,
     entry->demux_ctx = demux_ctx;
     entry->type = GNRC_NETREG_TYPE_MBOX;
     entry->target.mbox = mbox;
+#if defined(MODULE_GNRC_NETAPI_BATCH)
+    entry->batch = false;
+#endif
 }
 #endif
 
@@ -319,6 +376,9 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
     entry->demux_ctx = demux_ctx;
     entry->type = GNRC_NETREG_TYPE_CB;
     entry->target.cbd = cbd;
+#if defined(MODULE_GNRC_NETAPI_BATCH)
+    entry->batch = false;
+#endif
 }
 #endif
 /** @} */
@@ -29,6 +29,14 @@
  * Since `gnrc_pktbuf_static` is the default, no action is required to use it:
  * Any code using `gnrc_pktbuf` will automatically pull that in as a dependency.
  *
+ * By default `gnrc_pktbuf_static` manages its pool with a first-fit free list,
+ * whose allocation cost grows with the fragmentation of the pool. Adding
+ * `USEMODULE += gnrc_pktbuf_static_tlsf` replaces it with
+ * @ref net_gnrc_pktbuf_static_tlsf "segregated free lists" that free in
+ * constant time and, unless the pool is nearly exhausted, allocate in constant
+ * time. With `DEVELHELP`, @ref gnrc_pktbuf_stats reports the free space and
+ * fragmentation of the pool for both allocators.
+ *
  * To use `gnrc_pktbuf_malloc`, it needs to be selected e.g. by adding
  * `USEMODULE += gnrc_pktbuf_malloc` to the application's `Makefile`.
  *
@@ -0,0 +1,203 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_single_thread  Single-thread stack mode
+ * @ingroup     net_gnrc
+ * @brief       Runs GNRC's layers as handlers of one shared thread
+ *
+ * To activate, use `USEMODULE += gnrc_single_thread` in your application's
+ * Makefile.
+ *
+ * By default, 6LoWPAN, IPv6 and UDP each run in a thread of their own, so a
+ * packet passes through a message queue and a context switch at every layer,
+ * and every layer needs its own stack. With this module, these layers and the
+ * first network interface created run in a single thread instead: an
+ * @ref sys_event "event" loop that also serves the thread's message queue.
+ *
+ * The layers register @ref net_gnrc_netapi_callbacks "callbacks" with
+ * @ref net_gnrc_netreg, so a packet is handled to completion with direct
+ * calls from the interface up to the application (or down from the transport
+ * layer to the interface). Packets dispatched by other threads, e.g.
+ * applications sending, are queued and handled by the stack thread.
+ * @ref net_gnrc_netapi calls the stack thread makes to itself, e.g.
+ * @ref gnrc_netapi_get() on the hosted interface, are handled in place.
+ *
+ * @ref net_gnrc_netapi and @ref net_gnrc_netreg stay as they are for
+ * applications. `gnrc_ipv6_pid`, gnrc_sixlowpan_get_pid() and the PID of the
+ * hosted interface all refer to the stack thread. Further interfaces keep a
+ * thread of their own.
+ *
+ * @note    The stack passed to gnrc_netif_create() for the hosted interface is
+ *          not used.
+ *
+ * @{
+ *
+ * @file
+ * @brief   @ref net_gnrc_single_thread definitions
+ */
+
+#include <stdbool.h>
+
+#include "event.h"
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_single_thread_conf  Single-thread stack mode compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Stack size of the stack thread
+ *
+ * A packet passes all layers on this stack.
+ */
+#ifndef GNRC_SINGLE_THREAD_STACK_SIZE
+#define GNRC_SINGLE_THREAD_STACK_SIZE   (THREAD_STACKSIZE_DEFAULT * 2)
+#endif
+
+/**
+ * @brief   Priority of the stack thread
+ */
+#ifndef GNRC_SINGLE_THREAD_PRIO
+#define GNRC_SINGLE_THREAD_PRIO         (THREAD_PRIORITY_MAIN - 5)
+#endif
+
+/**
+ * @brief   Message queue size of the stack thread (as exponent of 2^n)
+ */
+#ifndef CONFIG_GNRC_SINGLE_THREAD_MSG_QUEUE_SIZE_EXP
+#define CONFIG_GNRC_SINGLE_THREAD_MSG_QUEUE_SIZE_EXP    (4U)
+#endif
+
+/**
+ * @brief   Number of packets other threads can queue for the stack thread
+ *
+ * Packets beyond that are dropped.
+ */
+#ifndef CONFIG_GNRC_SINGLE_THREAD_QUEUE_SIZE
+#define CONFIG_GNRC_SINGLE_THREAD_QUEUE_SIZE    (16U)
+#endif
+/** @} */
+
+/**
+ * @brief   Message queue size of the stack thread
+ */
+#ifndef GNRC_SINGLE_THREAD_MSG_QUEUE_SIZE
+#define GNRC_SINGLE_THREAD_MSG_QUEUE_SIZE   (1 << CONFIG_GNRC_SINGLE_THREAD_MSG_QUEUE_SIZE_EXP)
+#endif
+
+/**
+ * @brief   A layer hosted by the stack thread
+ */
+typedef struct gnrc_single_thread_layer gnrc_single_thread_layer_t;
+
+/**
+ * @brief   Handles a @ref net_gnrc_netapi command in the stack thread
+ *
+ * @param[in] cmd   @ref GNRC_NETAPI_MSG_TYPE_RCV, @ref GNRC_NETAPI_MSG_TYPE_SND
+ *                  or @ref GNRC_NETAPI_MSG_TYPE_NOTIFY.
+ * @param[in] pkt   The packet, or the @ref gnrc_netapi_notify_t for
+ *                  @ref GNRC_NETAPI_MSG_TYPE_NOTIFY.
+ */
+typedef void (*gnrc_single_thread_netapi_cb_t)(uint16_t cmd, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Handles a message sent to the stack thread
+ *
+ * @param[in] msg       The message.
+ * @param[out] reply    The reply to @ref GNRC_NETAPI_MSG_TYPE_GET and
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SET, preset to -ENOTSUP.
+ *
+ * @return  true, if the layer handled @p msg.
+ */
+typedef bool (*gnrc_single_thread_msg_handler_t)(msg_t *msg, msg_t *reply);
+
+/**
+ * @brief   A layer hosted by the stack thread
+ */
+struct gnrc_single_thread_layer {
+    gnrc_single_thread_layer_t *next;           /**< next layer (internal) */
+    gnrc_netreg_entry_cbd_t cbd;                /**< netreg callback (internal) */
+    gnrc_single_thread_netapi_cb_t netapi_cb;   /**< netapi commands, may be NULL */
+    gnrc_single_thread_msg_handler_t msg_handler;   /**< messages, may be NULL */
+    event_queue_t *evq;                         /**< event queues, may be NULL */
+    unsigned evq_numof;                         /**< number of gnrc_single_thread_layer_t::evq */
+};
+
+/**
+ * @brief   The PID of the stack thread
+ */
+extern kernel_pid_t gnrc_single_thread_pid;
+
+/**
+ * @brief   Starts the stack thread, if it is not running yet
+ *
+ * @return  The PID of the stack thread.
+ */
+kernel_pid_t gnrc_single_thread_init(void);
+
+/**
+ * @brief   Adds a layer to the stack thread
+ *
+ * Messages no layer added before handled are passed to
+ * gnrc_single_thread_layer_t::msg_handler. Event queues of
+ * gnrc_single_thread_layer_t::evq are served in the order the layers were
+ * added and need to be claimed by the stack thread.
+ *
+ * @pre gnrc_single_thread_init() was called.
+ *
+ * @param[in] layer     The layer.
+ */
+void gnrc_single_thread_add(gnrc_single_thread_layer_t *layer);
+
+/**
+ * @brief   Initializes a netreg entry that passes @ref net_gnrc_netapi
+ *          commands to gnrc_single_thread_layer_t::netapi_cb of a layer
+ *
+ * @param[out] entry    The netreg entry.
+ * @param[in] demux_ctx The demultiplexing context of @p entry.
+ * @param[in] layer     A layer added with gnrc_single_thread_add().
+ */
+static inline void gnrc_single_thread_entry_init(gnrc_netreg_entry_t *entry,
+                                                 uint32_t demux_ctx,
+                                                 gnrc_single_thread_layer_t *layer)
+{
+    gnrc_netreg_entry_init_cb(entry, demux_ctx, &layer->cbd);
+}
+
+/**
+ * @brief   Runs an event in the stack thread
+ *
+ * @param[in] event     The event.
+ */
+void gnrc_single_thread_post(event_t *event);
+
+/**
+ * @brief   Handles a message to the stack thread in place
+ *
+ * Used by @ref net_gnrc_netapi when the stack thread sends to itself.
+ *
+ * @pre `thread_getpid() == gnrc_single_thread_pid`
+ *
+ * @param[in] msg       The message.
+ * @param[out] reply    The reply to @ref GNRC_NETAPI_MSG_TYPE_GET and
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SET.
+ */
+void gnrc_single_thread_handle_msg(msg_t *msg, msg_t *reply);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
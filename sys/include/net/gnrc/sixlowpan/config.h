@@ -122,6 +122,39 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER              (0U)
 #endif
 
+/**
+ * @brief   Number of hash buckets for the reassembly buffer
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) and the
+ *          `gnrc_sixlowpan_frag_rb_hash` module
+ *
+ * With `gnrc_sixlowpan_frag_rb_hash`, the reassembly buffer entries of a
+ * fragment are found through a hash table instead of by comparing the
+ * fragment with all @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE entries. Each
+ * bucket takes a pointer of RAM.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE  (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
+#endif
+
+/**
+ * @brief   Largest datagram the reassembly buffer accepts with a coverage
+ *          bitmap
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) and the
+ *          `gnrc_sixlowpan_frag_rb_bitmap` module
+ *
+ * With `gnrc_sixlowpan_frag_rb_bitmap`, each (virtual) reassembly buffer entry
+ * keeps one bit per 8 bytes of this size to track the received fragments.
+ * Fragments of larger datagrams are dropped. The default is the largest
+ * datagram size the fragment header can carry.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MAX_DATAGRAM_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MAX_DATAGRAM_SIZE  (2047U)
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
@@ -166,6 +199,17 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US  (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US */
 
+/**
+ * @brief   Number of hash buckets for the virtual reassembly buffer
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) and the
+ *          `gnrc_sixlowpan_frag_rb_hash` module.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE   (CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE)
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE */
+
 /**
  * @name Selective fragment recovery configuration
  * @see  [RFC 8931, section 7.1]
@@ -397,6 +441,20 @@ extern "C" {
 #endif
 /** @} */
 
+/**
+ * @brief   Number of entries in the compression cache of
+ *          @ref net_gnrc_sixlowpan_iphc
+ *
+ * @note    Only applicable with the `gnrc_sixlowpan_iphc_cache` module
+ *
+ * The cache is direct-mapped: each flow of outgoing packets (source,
+ * destination, link-layer destination, and interface) maps to one entry. More
+ * entries reduce the number of flows that evict each other.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE           (8U)
+#endif
+
 /**
  * @brief   Message queue size to use for the 6LoWPAN thread.
  */
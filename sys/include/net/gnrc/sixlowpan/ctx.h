@@ -112,6 +112,20 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
                                                 uint8_t prefix_len, uint16_t ltime,
                                                 bool comp);
 
+/**
+ * @brief   Gets the generation of the context buffer
+ *
+ * The generation changes with every call of @ref gnrc_sixlowpan_ctx_update().
+ * Users that keep results derived from the contexts, such as the compression
+ * cache of @ref net_gnrc_sixlowpan_iphc, compare it to detect new or changed
+ * prefixes. Removed contexts and contexts that are no longer used for
+ * compression still need to be checked with
+ * @ref gnrc_sixlowpan_ctx_lookup_id().
+ *
+ * @return  The current generation.
+ */
+uint16_t gnrc_sixlowpan_ctx_generation(void);
+
 /**
  * @brief   Removes context.
  *
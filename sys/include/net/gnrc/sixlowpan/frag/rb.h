@@ -22,6 +22,7 @@
 #include <stdalign.h>
 
 #include "architecture.h"
+#include "bitfield.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
@@ -70,8 +71,16 @@ typedef struct gnrc_sixlowpan_frag_rb_int {
  * @see [RFC 4944, section 5.3](https://tools.ietf.org/html/rfc4944#section-5.3)
  * @see https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01
  */
-typedef struct {
-    gnrc_sixlowpan_frag_rb_int_t *ints;         /**< intervals of already received fragments */
+typedef struct gnrc_sixlowpan_frag_rb_base {
+#if !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) || defined(DOXYGEN)
+    /**
+     * @brief   Intervals of already received fragments
+     *
+     * @note    Only available without module `gnrc_sixlowpan_frag_rb_bitmap`
+     *          compiled in.
+     */
+    gnrc_sixlowpan_frag_rb_int_t *ints;
+#endif /* !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
     uint8_t src[IEEE802154_LONG_ADDRESS_LEN];   /**< source address */
     uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];   /**< destination address */
     uint8_t src_len;                            /**< length of gnrc_sixlowpan_frag_rb_t::src */
@@ -84,6 +93,53 @@ typedef struct {
     uint16_t current_size;
     uint32_t arrival;                           /**< time in microseconds of arrival of
                                                  *   last received fragment */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) || defined(DOXYGEN)
+    /**
+     * @brief   Received 8-byte blocks of the datagram, one bit each
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rb_bitmap`
+     *          compiled in.
+     */
+    BITFIELD(covered, (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MAX_DATAGRAM_SIZE + 7) / 8);
+    /**
+     * @brief   Number of received fragments
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rb_bitmap`
+     *          compiled in.
+     */
+    uint16_t frags;
+#endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   Next entry in the same hash bucket
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rb_hash`
+     *          compiled in.
+     */
+    struct gnrc_sixlowpan_frag_rb_base *hash_next;
+    /**
+     * @brief   Pointer pointing to this entry in its hash bucket, NULL if the
+     *          entry is not indexed
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rb_hash`
+     *          compiled in.
+     */
+    struct gnrc_sixlowpan_frag_rb_base **hash_pprev;
+    /**
+     * @brief   More recently used entry of the reassembly buffer
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rb_hash`
+     *          compiled in. NULL for entries not in the reassembly buffer.
+     */
+    struct gnrc_sixlowpan_frag_rb_base *lru_prev;
+    /**
+     * @brief   Less recently used entry of the reassembly buffer
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rb_hash`
+     *          compiled in. NULL for entries not in the reassembly buffer.
+     */
+    struct gnrc_sixlowpan_frag_rb_base *lru_next;
+#endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
 } gnrc_sixlowpan_frag_rb_base_t;
 
 /**
@@ -230,10 +286,52 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void);
 /**
  * @brief   Remove base entry
  *
+ * With module `gnrc_sixlowpan_frag_rb_hash` compiled in, this also removes
+ * @p entry from its hash bucket.
+ *
  * @param[in,out] entry Entry to remove
  */
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry);
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Hashes the identifying tuple of a datagram
+ *
+ * The datagram size is not part of the hash, as not all fragments carry it
+ * with [Selective Fragment Recovery](https://tools.ietf.org/html/rfc8931).
+ *
+ * @note    Only available with module `gnrc_sixlowpan_frag_rb_hash` compiled
+ *          in.
+ *
+ * @param[in] src       Source address of the datagram.
+ * @param[in] src_len   Length of @p src.
+ * @param[in] dst       Destination address of the datagram. May be NULL if
+ *                      @p dst_len is 0.
+ * @param[in] dst_len   Length of @p dst.
+ * @param[in] tag       Tag of the datagram.
+ *
+ * @return  The hash of (@p src, @p dst, @p tag).
+ */
+uint32_t gnrc_sixlowpan_frag_rb_base_hash(const uint8_t *src, size_t src_len,
+                                          const uint8_t *dst, size_t dst_len,
+                                          uint16_t tag);
+
+/**
+ * @brief   Adds a base entry to a hash bucket
+ *
+ * The entry is removed from the bucket again by
+ * @ref gnrc_sixlowpan_frag_rb_base_rm().
+ *
+ * @note    Only available with module `gnrc_sixlowpan_frag_rb_hash` compiled
+ *          in.
+ *
+ * @param[in,out] bucket    The hash bucket.
+ * @param[in,out] entry     Entry not in any bucket.
+ */
+void gnrc_sixlowpan_frag_rb_base_link(gnrc_sixlowpan_frag_rb_base_t **bucket,
+                                      gnrc_sixlowpan_frag_rb_base_t *entry);
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+
 /**
  * @brief   Garbage collect reassembly buffer.
  */
@@ -294,6 +392,8 @@ static inline void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
  *
  * @see     @ref gnrc_sixlowpan_frag_rb_int_t
  * @note    Returns only non-true values if @ref TEST_SUITES is defined.
+ *          There is no pool with module `gnrc_sixlowpan_frag_rb_bitmap`
+ *          compiled in, so it always returns true then.
  *
  * @return  true, if pool of fragment intervals is empty
  * @return  false, if pool of fragment intervals is not empty
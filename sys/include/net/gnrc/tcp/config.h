@@ -201,6 +201,40 @@ extern "C" {
 #ifndef CONFIG_GNRC_TCP_EXPERIMENTAL_DYN_MSL_RTO_MUL
 #define CONFIG_GNRC_TCP_EXPERIMENTAL_DYN_MSL_RTO_MUL (4U)
 #endif
+
+/**
+ * @brief Maximum number of segments sent as one super-segment
+ * @note Only used with module `gnrc_tcp_gso`. The super-segment is split into
+ *       segments by @ref net_gnrc_netif_gso right before it is sent, so it
+ *       takes up this many segments in the packet buffer until it is
+ *       acknowledged. If it can not be allocated, a single segment is sent.
+ */
+#ifndef CONFIG_GNRC_TCP_GSO_SEGS
+#define CONFIG_GNRC_TCP_GSO_SEGS (4U)
+#endif
+
+/**
+ * @brief Maximum number of in-order segments acknowledged by one ACK
+ * @note Only used with module `gnrc_tcp_gro`. While further packets wait in
+ *       the eventloop's message queue, in-order segments are coalesced into
+ *       the receive buffer and their ACK and the user notification are
+ *       deferred until the queue drained or this many segments were
+ *       received.
+ */
+#ifndef CONFIG_GNRC_TCP_GRO_SEGS_MAX
+#define CONFIG_GNRC_TCP_GRO_SEGS_MAX (8U)
+#endif
+
+/**
+ * @brief Maximum number of out-of-order segments held per connection
+ * @note Only used with module `gnrc_tcp_sack`. Segments received after a gap
+ *       are held in the packet buffer until the gap is filled and reported
+ *       to the peer in SACK options. If the queue is full, the segment
+ *       farthest from the gap is dropped.
+ */
+#ifndef CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_OOO_QUEUE_SIZE (4U)
+#endif
 /** @} */
 
 #ifdef __cplusplus
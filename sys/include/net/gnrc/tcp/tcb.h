@@ -16,7 +16,9 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
+#include "kernel_defines.h"
 #include "ringbuffer.h"
 #include "mutex.h"
 #include "evtimer_msg.h"
@@ -63,10 +65,24 @@ typedef struct sock_tcp {
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+#if IS_USED(MODULE_GNRC_TCP_GRO) || defined(DOXYGEN)
+    uint8_t gro_segs;      /**< Number of in-order segments not yet acknowledged */
+#endif
+#if IS_USED(MODULE_GNRC_TCP_SACK) || defined(DOXYGEN)
+    uint8_t dup_acks;      /**< Number of duplicate ACKs received */
+#endif
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
     gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+#if IS_USED(MODULE_GNRC_TCP_SACK) || defined(DOXYGEN)
+    /**
+     * @brief Segments received out of order, in order of their arrival
+     */
+    gnrc_pktsnip_t *ooo_queue[CONFIG_GNRC_TCP_OOO_QUEUE_SIZE];
+    uint32_t ooo_fin_seq;  /**< Sequence number of a FIN received after a gap */
+    bool ooo_fin;          /**< True, if gnrc_tcp_tcb_t::ooo_fin_seq is valid */
+#endif
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
@@ -874,6 +874,22 @@ typedef enum {
      */
     NETOPT_GTS_TX,
 
+    /**
+     * @brief   (@ref netopt_enable_t) completion of transport layer checksums
+     *          of outgoing frames by the device
+     *
+     * When getting this option, a device returns @ref NETOPT_ENABLE if it
+     * is able to compute the UDP, TCP, or ICMPv6 checksum of a frame that
+     * carries an IPv6 header directly followed by the transport layer
+     * header. Devices without that capability return -ENOTSUP.
+     *
+     * Setting this option applies to the next frame sent only: with
+     * @ref NETOPT_ENABLE, the checksum field of that frame holds the
+     * one's complement sum of the IPv6 pseudo-header (not complemented) and
+     * the device completes it over the transport layer header and payload.
+     */
+    NETOPT_L4_CSUM_OFFLOAD,
+
     /**
      * @brief   maximum number of options defined here.
      *
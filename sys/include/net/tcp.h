@@ -39,6 +39,8 @@ extern "C" {
 #define TCP_OPTION_KIND_EOL (0x00)  /**< "End of List"-Option */
 #define TCP_OPTION_KIND_NOP (0x01)  /**< "No Operation"-Option */
 #define TCP_OPTION_KIND_MSS (0x02)  /**< "Maximum Segment Size"-Option */
+#define TCP_OPTION_KIND_SACK_PERMITTED (0x04) /**< "SACK-Permitted"-Option */
+#define TCP_OPTION_KIND_SACK (0x05) /**< "Selective Acknowledgment"-Option */
 /** @} */
 
 /**
@@ -47,6 +49,8 @@ extern "C" {
  */
 #define TCP_OPTION_LENGTH_MIN (2U)    /**< Minimum option field size in bytes */
 #define TCP_OPTION_LENGTH_MSS (0x04)  /**< MSS Option Size always 4 */
+#define TCP_OPTION_LENGTH_SACK_PERMITTED (0x02) /**< SACK-Permitted Option Size always 2 */
+#define TCP_OPTION_LENGTH_SACK_BLOCK (0x08) /**< Size of each block of the SACK Option */
 /** @} */
 
 /**
@@ -0,0 +1,209 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_sched_trace  Scheduler event trace
+ * @ingroup     sys
+ * @brief       Records scheduler, IPC and interrupt events in a ring buffer
+ *
+ * To activate, use `USEMODULE += sched_trace` in your application's Makefile.
+ *
+ * Unlike @ref sys_trace, which records user-chosen values, and
+ * @ref sys_schedstatistics, which sums up the runtime per thread, this module
+ * records what the kernel does, so context-switch latency, the latency from an
+ * interrupt to the thread it wakes up and the depth of message queues over
+ * time can be reconstructed afterwards. Events are recorded from:
+ *
+ * - `sched_run()`: a thread is switched in (@ref SCHED_TRACE_SWITCH)
+ * - `sched_set_status()`: a thread becomes runnable (@ref SCHED_TRACE_READY)
+ * - @ref msg_send() and friends, @ref msg_receive() and
+ *   @ref msg_try_receive() (@ref SCHED_TRACE_MSG_SEND,
+ *   @ref SCHED_TRACE_MSG_RECEIVE)
+ * - @ref mutex_lock() when the mutex is locked (@ref SCHED_TRACE_MUTEX_WAIT)
+ * - @ref thread_flags_set() (@ref SCHED_TRACE_FLAGS_SET)
+ * - interrupt service routines (@ref SCHED_TRACE_ISR_ENTER,
+ *   @ref SCHED_TRACE_ISR_EXIT), on CPUs that call
+ *   @ref sched_trace_isr_enter() and @ref sched_trace_isr_exit(). Currently,
+ *   this is `native` only.
+ *
+ * Each entry takes 8 bytes: the time since the previous entry in 16 bits, the
+ * event, a PID and a 32 bit argument. Gaps longer than 16 bits are stored
+ * as an extra @ref SCHED_TRACE_TIME entry. Recording only disables interrupts
+ * for copying the entry, so it can be called from anywhere, including
+ * interrupt context. When the ring is full, the oldest entries are
+ * overwritten.
+ *
+ * @ref sched_trace_dump() prints the ring as hex lines. The
+ * `dist/tools/sched_trace/sched_trace.py` script turns them into a Chrome
+ * trace (JSON) that can be opened in Perfetto (https://ui.perfetto.dev) or
+ * `chrome://tracing` and prints switch and wakeup latencies:
+ *
+ *     make term | tee trace.log
+ *     dist/tools/sched_trace/sched_trace.py trace.log -o trace.json
+ *
+ * @{
+ *
+ * @file
+ * @brief   @ref sys_sched_trace API
+ */
+
+#include <stdint.h>
+
+#include "sched.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_sched_trace_conf  Scheduler event trace compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of entries in the ring (as exponent of 2^n)
+ */
+#ifndef CONFIG_SCHED_TRACE_BUFSIZE_EXP
+#define CONFIG_SCHED_TRACE_BUFSIZE_EXP  (9U)
+#endif
+/** @} */
+
+/**
+ * @brief   Number of entries in the ring
+ */
+#define SCHED_TRACE_BUFSIZE             (1U << CONFIG_SCHED_TRACE_BUFSIZE_EXP)
+
+/**
+ * @brief   Recorded events
+ *
+ * The meaning of sched_trace_entry_t::pid and sched_trace_entry_t::arg
+ * depends on the event.
+ */
+typedef enum {
+    /**
+     * @brief   Time extension, `arg` is the time since the previous entry
+     */
+    SCHED_TRACE_TIME = 0,
+    /**
+     * @brief   `pid` is switched in, `arg` is the PID switched out
+     */
+    SCHED_TRACE_SWITCH,
+    /**
+     * @brief   `pid` became runnable, `arg` is its previous status
+     */
+    SCHED_TRACE_READY,
+    /**
+     * @brief   A message is sent to `pid`
+     *
+     * The lower 16 bits of `arg` are the message type, the upper 16 bits the
+     * number of messages queued at `pid` before.
+     */
+    SCHED_TRACE_MSG_SEND,
+    /**
+     * @brief   `pid` received a message
+     *
+     * The lower 16 bits of `arg` are the message type, the upper 16 bits the
+     * number of messages left in the queue of `pid`.
+     */
+    SCHED_TRACE_MSG_RECEIVE,
+    /**
+     * @brief   `pid` waits for a locked mutex, `arg` is its address
+     */
+    SCHED_TRACE_MUTEX_WAIT,
+    /**
+     * @brief   Thread flags are set for `pid`, `arg` is the mask
+     */
+    SCHED_TRACE_FLAGS_SET,
+    /**
+     * @brief   An ISR interrupts `pid`, `arg` is the interrupt number
+     */
+    SCHED_TRACE_ISR_ENTER,
+    /**
+     * @brief   An ISR returns, `arg` is the interrupt number
+     */
+    SCHED_TRACE_ISR_EXIT,
+    /**
+     * @brief   Recorded with @ref sched_trace_user(), `arg` is the value
+     */
+    SCHED_TRACE_USER,
+} sched_trace_event_t;
+
+/**
+ * @brief   An entry of the ring
+ */
+typedef struct {
+    uint16_t delta;     /**< time since the previous entry, in us */
+    uint8_t event;      /**< @ref sched_trace_event_t */
+    uint8_t pid;        /**< PID the event refers to */
+    uint32_t arg;       /**< argument of the event */
+} sched_trace_entry_t;
+
+/**
+ * @brief   Records an event
+ *
+ * Events are dropped before the module is initialized and while
+ * @ref sched_trace_dump() runs.
+ *
+ * @param[in] event     The event.
+ * @param[in] pid       PID the event refers to.
+ * @param[in] arg       Argument of the event.
+ */
+void sched_trace_record(sched_trace_event_t event, kernel_pid_t pid,
+                        uint32_t arg);
+
+/**
+ * @brief   Records a user-chosen value for the running thread
+ *
+ * @param[in] val       The value.
+ */
+static inline void sched_trace_user(uint32_t val)
+{
+    sched_trace_record(SCHED_TRACE_USER, thread_getpid(), val);
+}
+
+/**
+ * @brief   Records the entry of an interrupt service routine
+ *
+ * To be called by the CPU implementation.
+ *
+ * @param[in] irq       Interrupt number.
+ */
+static inline void sched_trace_isr_enter(unsigned irq)
+{
+    sched_trace_record(SCHED_TRACE_ISR_ENTER, thread_getpid(), irq);
+}
+
+/**
+ * @brief   Records the return of an interrupt service routine
+ *
+ * To be called by the CPU implementation.
+ *
+ * @param[in] irq       Interrupt number.
+ */
+static inline void sched_trace_isr_exit(unsigned irq)
+{
+    sched_trace_record(SCHED_TRACE_ISR_EXIT, thread_getpid(), irq);
+}
+
+/**
+ * @brief   Prints the ring for `dist/tools/sched_trace/sched_trace.py`
+ *
+ * Recording is paused while the ring is printed.
+ */
+void sched_trace_dump(void);
+
+/**
+ * @brief   Empties the ring
+ */
+void sched_trace_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
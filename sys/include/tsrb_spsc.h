@@ -0,0 +1,248 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_tsrb_spsc Lock-free single-producer/single-consumer ringbuffer
+ * @ingroup     sys_tsrb
+ * @brief       Lock-free access to a @ref sys_tsrb for exactly one producer
+ *              and one consumer
+ *
+ * The functions in this module operate on a regular @ref tsrb_t, but never
+ * disable interrupts. This is safe as long as there is at most one context
+ * (thread or ISR) adding data and at most one context taking data out of the
+ * ringbuffer at any time: the producer is the only one writing
+ * `tsrb_t::writes`, the consumer is the only one writing `tsrb_t::reads`, and
+ * both only publish their index using @ref sys_atomic_utils after the data
+ * has been copied.
+ *
+ * Data is moved using at most two `memcpy()` calls per operation (one per
+ * contiguous part of the buffer). In addition, @ref tsrb_spsc_peek_span /
+ * @ref tsrb_spsc_commit_read and @ref tsrb_spsc_write_span /
+ * @ref tsrb_spsc_commit_write give direct access to the buffer, e.g. to let a
+ * DMA transfer or a driver read directly into or out of the ringbuffer.
+ *
+ * @warning     Do not mix the `tsrb_spsc_*()` functions with the
+ *              IRQ-locking `tsrb_*()` functions on the same ringbuffer, and
+ *              never use them with more than one producer or more than one
+ *              consumer.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock-free single-producer/single-consumer ringbuffer interface
+ *              definition
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "atomic_utils.h"
+#include "tsrb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief       Get number of bytes available for reading
+ *
+ * May be called from both the producer and the consumer.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @return      nr of available bytes
+ */
+static inline unsigned int tsrb_spsc_avail(const tsrb_t *rb)
+{
+    return atomic_load_unsigned(&rb->writes) - atomic_load_unsigned(&rb->reads);
+}
+
+/**
+ * @brief       Get free space in ringbuffer
+ *
+ * May be called from both the producer and the consumer.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @return      nr of free bytes
+ */
+static inline unsigned int tsrb_spsc_free(const tsrb_t *rb)
+{
+    return rb->size - tsrb_spsc_avail(rb);
+}
+
+/**
+ * @brief       Test if the ringbuffer is empty
+ * @param[in]   rb  Ringbuffer to operate on
+ * @return      0   if not empty
+ * @return      1   otherwise
+ */
+static inline int tsrb_spsc_empty(const tsrb_t *rb)
+{
+    return tsrb_spsc_avail(rb) == 0;
+}
+
+/**
+ * @brief       Test if the ringbuffer is full
+ * @param[in]   rb  Ringbuffer to operate on
+ * @return      0   if not full
+ * @return      1   otherwise
+ */
+static inline int tsrb_spsc_full(const tsrb_t *rb)
+{
+    return tsrb_spsc_avail(rb) == rb->size;
+}
+
+/**
+ * @brief       Get the contiguous part of the readable data
+ *
+ * Must only be called by the consumer. The data stays in the ringbuffer
+ * until it is released using @ref tsrb_spsc_commit_read. If the readable data
+ * wraps around the end of the buffer, only the first part is returned and a
+ * second call after committing it returns the remainder.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the readable data
+ * @return      nr of bytes readable at @p data
+ */
+static inline size_t tsrb_spsc_peek_span(tsrb_t *rb, uint8_t **data)
+{
+    unsigned reads = rb->reads;
+    unsigned avail = atomic_load_unsigned(&rb->writes) - reads;
+    unsigned idx = reads & (rb->size - 1);
+    unsigned contiguous = rb->size - idx;
+
+    *data = &rb->buf[idx];
+    return (avail < contiguous) ? avail : contiguous;
+}
+
+/**
+ * @brief       Release data obtained by @ref tsrb_spsc_peek_span
+ *
+ * Must only be called by the consumer.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes to release, must not exceed the span
+ */
+static inline void tsrb_spsc_commit_read(tsrb_t *rb, size_t n)
+{
+    assert(n <= tsrb_spsc_avail(rb));
+    atomic_store_unsigned(&rb->reads, rb->reads + n);
+}
+
+/**
+ * @brief       Get the contiguous part of the free space
+ *
+ * Must only be called by the producer. Data written to the span becomes
+ * visible to the consumer only after @ref tsrb_spsc_commit_write.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the writable space
+ * @return      nr of bytes writable at @p data
+ */
+static inline size_t tsrb_spsc_write_span(tsrb_t *rb, uint8_t **data)
+{
+    unsigned writes = rb->writes;
+    unsigned space = rb->size - (writes - atomic_load_unsigned(&rb->reads));
+    unsigned idx = writes & (rb->size - 1);
+    unsigned contiguous = rb->size - idx;
+
+    *data = &rb->buf[idx];
+    return (space < contiguous) ? space : contiguous;
+}
+
+/**
+ * @brief       Publish data written into the span obtained by
+ *              @ref tsrb_spsc_write_span
+ *
+ * Must only be called by the producer.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes to publish, must not exceed the span
+ */
+static inline void tsrb_spsc_commit_write(tsrb_t *rb, size_t n)
+{
+    assert(n <= tsrb_spsc_free(rb));
+    atomic_store_unsigned(&rb->writes, rb->writes + n);
+}
+
+/**
+ * @brief       Get a byte from ringbuffer
+ * @param[in]   rb  Ringbuffer to operate on
+ * @return      >=0 byte that has been read
+ * @return      -1  if no byte available
+ */
+static inline int tsrb_spsc_get_one(tsrb_t *rb)
+{
+    unsigned reads = rb->reads;
+
+    if (atomic_load_unsigned(&rb->writes) == reads) {
+        return -1;
+    }
+    int retval = rb->buf[reads & (rb->size - 1)];
+    atomic_store_unsigned(&rb->reads, reads + 1);
+    return retval;
+}
+
+/**
+ * @brief       Add a byte to ringbuffer
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   c   Character to add to ringbuffer
+ * @return      0   on success
+ * @return      -1  if no space available
+ */
+static inline int tsrb_spsc_add_one(tsrb_t *rb, uint8_t c)
+{
+    unsigned writes = rb->writes;
+
+    if (writes - atomic_load_unsigned(&rb->reads) == rb->size) {
+        return -1;
+    }
+    rb->buf[writes & (rb->size - 1)] = c;
+    atomic_store_unsigned(&rb->writes, writes + 1);
+    return 0;
+}
+
+/**
+ * @brief       Get bytes from ringbuffer
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  dst buffer to write to
+ * @param[in]   n   max number of bytes to write to @p dst
+ * @return      nr of bytes written to @p dst
+ */
+int tsrb_spsc_get(tsrb_t *rb, uint8_t *dst, size_t n);
+
+/**
+ * @brief       Get bytes from ringbuffer, without removing them
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  dst buffer to write to
+ * @param[in]   n   max number of bytes to write to @p dst
+ * @return      nr of bytes written to @p dst
+ */
+int tsrb_spsc_peek(tsrb_t *rb, uint8_t *dst, size_t n);
+
+/**
+ * @brief       Drop bytes from ringbuffer
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   max number of bytes to drop
+ * @return      nr of bytes dropped
+ */
+int tsrb_spsc_drop(tsrb_t *rb, size_t n);
+
+/**
+ * @brief       Add bytes to ringbuffer
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   src buffer to read from
+ * @param[in]   n   max number of bytes to read from @p src
+ * @return      nr of bytes read from @p src
+ */
+int tsrb_spsc_add(tsrb_t *rb, const uint8_t *src, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -157,6 +157,48 @@
  * to be shown whether the increased complexity would lead to better
  * performance for any reasonable amount of active timers.
  *
+ * For applications keeping hundreds of timers active on a single clock, the
+ * optional `ztimer_wheel` module augments the list with a hierarchical
+ * timing wheel:
+ *
+ * - as long as it holds less than @ref CONFIG_ZTIMER_WHEEL_LIST_LEN timers, the
+ *   sorted list takes every timer, so clocks with only a few active timers
+ *   behave exactly as without the wheel
+ * - beyond that, the sorted list only takes timers due within the current
+ *   "near" window of 2^@ref CONFIG_ZTIMER_WHEEL_NEAR_BITS ticks
+ * - all other timers are hashed into one of @ref ZTIMER_WHEEL_SLOTS slots on
+ *   one of @ref ZTIMER_WHEEL_LEVELS levels, each level covering
+ *   @ref ZTIMER_WHEEL_SLOT_BITS more bits of the target time
+ * - a slot is cascaded to the next lower level (or into the list) once the
+ *   clock reaches the slot's start time, the backend alarm is set to the
+ *   earlier one of the list head and the earliest timer in the next
+ *   non-empty slot
+ * - insertion of timers outside of the near window is O(1), removal only
+ *   searches the few slots the timer's target maps to, at the price of
+ *   `ZTIMER_WHEEL_LEVELS * (ZTIMER_WHEEL_SLOTS + 1)` words per clock
+ *
+ * Timers still fire at exactly the requested tick, the wheel only changes how
+ * they are stored. Slots are only cascaded when a timer fires or the clock is
+ * accessed, so the wheel does not cause additional interrupts.
+ *
+ * ## Coalescing timers with slack
+ *
+ * Many timers, e.g. for periodic sensor readouts or protocol timeouts, do not
+ * need to fire at the exact tick. With the optional `ztimer_slack` module,
+ * such timers can be set with ztimer_set_with_slack(), allowing them to fire
+ * up to `slack` ticks late. The backend alarm is then not set to the first
+ * timer, but to the latest time that is still within the slack of all timers
+ * due until then, so timers set close to each other fire in one interrupt:
+ *
+ * - timers set with ztimer_set() have no slack and still fire at the exact
+ *   tick, timers with slack due before them fire along with them
+ * - the list is walked only as far as the timers fire together when the
+ *   alarm is set
+ * - each clock counts the interrupts that fired timers and the timers that
+ *   fired in an interrupt of another timer, see ztimer_slack_stats()
+ *
+ * Without the module, ztimer_set_with_slack() is the same as ztimer_set().
+ *
  *
  * ## Clock extension
  *
@@ -296,7 +338,9 @@ typedef void (*ztimer_callback_t)(void *arg);
  */
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
-    uint32_t offset;            /**< offset from last timer in list */
+    uint32_t offset;            /**< offset from last timer in list, or
+                                     absolute target if stored in a wheel
+                                     slot */
 };
 
 /**
@@ -317,6 +361,9 @@ typedef struct {
     ztimer_base_t base;             /**< clock list entry */
     ztimer_callback_t callback;     /**< timer callback function pointer */
     void *arg;                      /**< timer callback argument */
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    uint32_t slack;                 /**< ticks the timer may fire late */
+#endif
 } ztimer_t;
 
 /**
@@ -361,11 +408,83 @@ typedef struct {
 #endif
 } ztimer_ops_t;
 
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+/**
+ * @brief   Number of bits of the time value covered by the sorted timer list
+ *          (the "near" window) when using `ztimer_wheel`
+ *
+ * Once the list holds @ref CONFIG_ZTIMER_WHEEL_LIST_LEN timers, only timers
+ * due within the current window of 2^CONFIG_ZTIMER_WHEEL_NEAR_BITS ticks are
+ * inserted into the sorted list, so this bounds the length of the list walk
+ * on insertion.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_NEAR_BITS
+#define CONFIG_ZTIMER_WHEEL_NEAR_BITS   (7)
+#endif
+
+/**
+ * @brief   Number of timers the sorted list takes regardless of their target
+ *          when using `ztimer_wheel`
+ *
+ * For a few timers walking the list is cheaper than cascading wheel slots.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_LIST_LEN
+#define CONFIG_ZTIMER_WHEEL_LIST_LEN    (8)
+#endif
+
+/**
+ * @brief   Number of bits of the time value covered by one wheel level
+ */
+#define ZTIMER_WHEEL_SLOT_BITS          (5)
+
+/**
+ * @brief   Number of slots per wheel level
+ */
+#define ZTIMER_WHEEL_SLOTS              (1U << ZTIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief   Number of wheel levels needed to cover the full 32 bit range
+ */
+#define ZTIMER_WHEEL_LEVELS             ((32 - CONFIG_ZTIMER_WHEEL_NEAR_BITS + \
+                                          ZTIMER_WHEEL_SLOT_BITS - 1) / \
+                                         ZTIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief   Hierarchical timing wheel used by `ztimer_wheel`
+ */
+typedef struct {
+    ztimer_base_t *slots[ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS]; /**< slot heads */
+    uint32_t pending[ZTIMER_WHEEL_LEVELS];  /**< bitmap of non-empty slots  */
+    uint32_t now;                           /**< time the wheel was last
+                                                 advanced to                */
+    uint32_t next;                          /**< target of the earliest
+                                                 timer in the wheel         */
+    uint16_t list_len;                      /**< number of timers in the
+                                                 sorted list                */
+    bool next_valid;                        /**< true if @ref next is up to
+                                                 date                       */
+} ztimer_wheel_t;
+#endif
+
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+/**
+ * @brief   Interrupt counters of a clock used by `ztimer_slack`
+ */
+typedef struct {
+    uint32_t fired;         /**< interrupts that fired timers               */
+    uint32_t coalesced;     /**< timers fired in the interrupt of another
+                                 timer                                      */
+} ztimer_slack_stats_t;
+#endif
+
 /**
  * @brief   ztimer device structure
  */
 struct ztimer_clock {
     ztimer_base_t list;             /**< list of active timers              */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t wheel;           /**< timers outside of the near window  */
+#endif
     const ztimer_ops_t *ops;        /**< pointer to methods structure       */
     ztimer_base_t *last;            /**< last timer in queue, for _is_set() */
     uint16_t adjust_set;            /**< will be subtracted on every set()  */
@@ -383,6 +502,9 @@ struct ztimer_clock {
     uint32_t lower_last;            /**< timer value at last now() call     */
     ztimer_now_t checkpoint;        /**< cumulated time at last now() call  */
 #endif
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    ztimer_slack_stats_t slack_stats; /**< interrupt counters             */
+#endif
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND || DOXYGEN
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
@@ -457,6 +579,49 @@ static inline bool ztimer_release(ztimer_clock_t *clock)
  */
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+/**
+ * @brief   Set a timer on a clock that may fire late
+ *
+ * Same as @ref ztimer_set(), but @p timer may fire anywhere from @p val to
+ * @p val + @p slack ticks from now, so that it can fire together with other
+ * timers. Without the module `ztimer_slack`, @p slack is ignored.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         timer target (relative ticks from now)
+ * @param[in]   slack       ticks @p timer may fire after its target
+ *
+ * @return The value of @ref ztimer_now() that @p timer was set against
+ *         (`now() + @p val = earliest trigger time`).
+ */
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+uint32_t ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t val, uint32_t slack);
+#else
+static inline uint32_t ztimer_set_with_slack(ztimer_clock_t *clock,
+                                             ztimer_t *timer, uint32_t val,
+                                             uint32_t slack)
+{
+    (void)slack;
+    return ztimer_set(clock, timer, val);
+}
+#endif
+
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+/**
+ * @brief   Get the interrupt counters of a clock
+ *
+ * The number of interrupts saved by coalescing is
+ * ztimer_slack_stats_t::coalesced, the number of timers fired is the sum of
+ * both counters. Both counters also include timers that were due at the same
+ * tick without slack.
+ *
+ * @param[in]   clock       ztimer clock to get the counters of
+ * @param[out]  stats       the counters
+ */
+void ztimer_slack_stats(ztimer_clock_t *clock, ztimer_slack_stats_t *stats);
+#endif
+
 /**
  * @brief   Check if a timer is currently active
  *
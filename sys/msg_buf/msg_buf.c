@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_msg_buf
+ * @{
+ *
+ * @file
+ * @brief       Buffer message implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "msg_buf.h"
+
+static inline msg_buf_hdr_t *_hdr(const void *data)
+{
+    return (msg_buf_hdr_t *)(uintptr_t)data - 1;
+}
+
+void msg_buf_pool_init(msg_buf_pool_t *pool, void *mem, size_t size,
+                       size_t num)
+{
+    memarray_init(&pool->mem, mem, MSG_BUF_ELEM_SIZE(size), num);
+}
+
+void *msg_buf_alloc(msg_buf_pool_t *pool)
+{
+    unsigned state = irq_disable();
+    msg_buf_hdr_t *hdr = memarray_alloc(&pool->mem);
+
+    irq_restore(state);
+    if (hdr == NULL) {
+        return NULL;
+    }
+    hdr->pool = pool;
+    hdr->len = 0;
+    return hdr + 1;
+}
+
+void msg_buf_free(void *data)
+{
+    if (data == NULL) {
+        return;
+    }
+
+    msg_buf_hdr_t *hdr = _hdr(data);
+    unsigned state = irq_disable();
+
+    memarray_free(&hdr->pool->mem, hdr);
+    irq_restore(state);
+}
+
+size_t msg_buf_size(const void *data)
+{
+    return _hdr(data)->pool->mem.size - sizeof(msg_buf_hdr_t);
+}
+
+size_t msg_buf_available(msg_buf_pool_t *pool)
+{
+    unsigned state = irq_disable();
+    size_t res = memarray_available(&pool->mem);
+
+    irq_restore(state);
+    return res;
+}
+
+static inline void _attach(msg_t *m, void *data, size_t len)
+{
+    assert(len <= msg_buf_size(data));
+    _hdr(data)->len = len;
+    m->content.ptr = data;
+}
+
+int msg_buf_send(msg_t *m, kernel_pid_t target_pid, void *data, size_t len)
+{
+    _attach(m, data, len);
+
+    int res = msg_send(m, target_pid);
+
+    if (res <= 0) {
+        msg_buf_free(data);
+    }
+    return res;
+}
+
+int msg_buf_try_send(msg_t *m, kernel_pid_t target_pid, void *data,
+                     size_t len)
+{
+    _attach(m, data, len);
+
+    int res = msg_try_send(m, target_pid);
+
+    if (res <= 0) {
+        msg_buf_free(data);
+    }
+    return res;
+}
@@ -13,15 +13,134 @@
  */
 
 #include <inttypes.h>
+#include <stdint.h>
 #include <stdio.h>
 
+#include "byteorder.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* aliases of uint8_t buffers accessed word-wise */
+typedef uint16_t __attribute__((__may_alias__)) _u16_alias_t;
+typedef uint32_t __attribute__((__may_alias__)) _u32_alias_t;
+
+static inline uint16_t _fold(uint64_t sum)
+{
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return sum;
+}
+
+#if defined(__SSE2__)
+/* sums the native 16-bit words of 16-byte aligned blocks, len % 16 == 0 */
+static uint64_t _sum_blocks(const uint8_t *buf, size_t len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+
+    /* each 32-bit lane gains at most 2 * 0xffff per block, which cannot
+     * overflow for len <= UINT16_MAX */
+    for (const uint8_t *end = buf + len; buf < end; buf += 16) {
+        __m128i v = _mm_load_si128((const __m128i *)buf);
+
+        acc = _mm_add_epi32(acc, _mm_unpacklo_epi16(v, zero));
+        acc = _mm_add_epi32(acc, _mm_unpackhi_epi16(v, zero));
+    }
+
+    uint32_t lanes[4];
+
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    return (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+#define _BLOCK_SIZE     (16U)
+#elif defined(__ARM_NEON)
+/* sums the native 16-bit words of 16-byte aligned blocks, len % 16 == 0 */
+static uint64_t _sum_blocks(const uint8_t *buf, size_t len)
+{
+    uint32x4_t acc = vdupq_n_u32(0);
+
+    /* each 32-bit lane gains at most 2 * 0xffff per block, which cannot
+     * overflow for len <= UINT16_MAX */
+    for (const uint8_t *end = buf + len; buf < end; buf += 16) {
+        acc = vpadalq_u16(acc, vld1q_u16((const uint16_t *)buf));
+    }
+    uint64x2_t sum = vpaddlq_u32(acc);
+
+    return vgetq_lane_u64(sum, 0) + vgetq_lane_u64(sum, 1);
+}
+#define _BLOCK_SIZE     (16U)
+#else
+/* sums the native 16-bit words of 4-byte aligned blocks, len % 16 == 0 */
+static uint64_t _sum_blocks(const uint8_t *buf, size_t len)
+{
+    const _u32_alias_t *words = (const _u32_alias_t *)buf;
+    uint64_t sum = 0;
+
+    /* adding 32-bit words to a 64-bit accumulator defers the carries to
+     * _fold() */
+    for (; len >= 16; len -= 16, words += 4) {
+        sum += words[0];
+        sum += words[1];
+        sum += words[2];
+        sum += words[3];
+    }
+    return sum;
+}
+#define _BLOCK_SIZE     (4U)
+#endif
+
+/*
+ * Internet checksum of an even-aligned buffer, in network byte order as if
+ * the buffer started a 16-bit word. An odd trailing byte is the top half of
+ * the last word.
+ */
+static uint16_t _sum_even_aligned(const uint8_t *buf, size_t len)
+{
+    uint64_t sum = 0;
+
+    /* short buffers (e.g. addresses of the pseudo-header) are not worth
+     * aligning */
+    if (len >= 32) {
+        /* head: 16-bit words up to the block alignment */
+        while ((uintptr_t)buf & (_BLOCK_SIZE - 1)) {
+            sum += *(const _u16_alias_t *)buf;
+            buf += 2;
+            len -= 2;
+        }
+        size_t blocks = len & ~(size_t)15;
+
+        sum += _sum_blocks(buf, blocks);
+        buf += blocks;
+        len -= blocks;
+    }
+    /* tail */
+    for (; len >= 2; buf += 2, len -= 2) {
+        sum += *(const _u16_alias_t *)buf;
+    }
+    if (len) {
+        /* the top half of a word is its first byte in memory */
+        uint16_t last = 0;
+
+        *(uint8_t *)&last = *buf;
+        sum += last;
+    }
+    /* the one's complement sum of byte-swapped words is the byte-swapped
+     * sum, see RFC 1071, section 2 (B) */
+    return ntohs(_fold(sum));
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -44,22 +163,21 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
+    if ((len > 0) && ((uintptr_t)buf & 1)) {
+        /* add the first byte as top half of a 16-bit word, the remaining
+         * buffer is then shifted by one byte against the word boundaries,
+         * which swaps the bytes of its sum */
+        csum += (uint16_t)(*buf << 8);
+        csum += byteorder_swaps(_sum_even_aligned(buf + 1, len - 1));
     }
-
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
-
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
+    else {
+        csum += _sum_even_aligned(buf, len);
     }
 
+    csum = _fold(csum);
+
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
     return csum;
@@ -21,14 +21,19 @@
 #include <assert.h>
 #include <errno.h>
 
+#include "kernel_defines.h"
 #include "log.h"
 #include "mbox.h"
 #include "msg.h"
 #include "net/gnrc/netreg.h"
+#include "net/gnrc/netapi/batch.h"
 #include "net/gnrc/netapi/notify.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
 #include "sema_inv.h"
+#ifdef MODULE_GNRC_SINGLE_THREAD
+#include "net/gnrc/single_thread.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -47,6 +52,13 @@ int _gnrc_netapi_get_set(kernel_pid_t pid, netopt_t opt, uint16_t context,
     /* set outgoing message's fields */
     cmd.type = type;
     cmd.content.ptr = (void *)&o;
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+    if ((pid == gnrc_single_thread_pid) && (pid == thread_getpid())) {
+        /* the stack thread would wait for itself */
+        gnrc_single_thread_handle_msg(&cmd, &ack);
+        return (int)ack.content.value;
+    }
+#endif
     /* trigger the netapi */
     msg_send_receive(&cmd, &ack, pid);
     assert(ack.type == GNRC_NETAPI_MSG_TYPE_ACK);
@@ -61,6 +73,15 @@ int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
         .type = type,
         .content.ptr = pkt,
     };
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+    if ((pid == gnrc_single_thread_pid) && (pid == thread_getpid())) {
+        /* run to completion */
+        msg_t reply;
+
+        gnrc_single_thread_handle_msg(&msg, &reply);
+        return 1;
+    }
+#endif
     /* send message */
     int ret = msg_try_send(&msg, pid);
     if (ret < 1) {
@@ -150,6 +171,114 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
     return numof;
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+static inline bool _batch_capable(const gnrc_netreg_entry_t *entry)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+    if (entry->type != GNRC_NETREG_TYPE_DEFAULT) {
+        return false;
+    }
+#endif
+    return entry->batch;
+}
+
+static void _release_batch(gnrc_pktsnip_t **pkts, unsigned numof, int error)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_pktbuf_release_error(pkts[i], error);
+    }
+}
+
+void gnrc_netapi_batch_receive(gnrc_netapi_batch_t *batch, gnrc_nettype_t type,
+                               uint32_t demux_ctx, gnrc_pktsnip_t *pkt)
+{
+    if ((batch->numof > 0) &&
+        ((batch->type != type) || (batch->demux_ctx != demux_ctx))) {
+        gnrc_netapi_batch_flush(batch);
+    }
+    batch->type = type;
+    batch->demux_ctx = demux_ctx;
+    batch->pkts[batch->numof++] = pkt;
+    if (batch->numof == CONFIG_GNRC_NETAPI_BATCH_SIZE) {
+        gnrc_netapi_batch_flush(batch);
+    }
+}
+
+int gnrc_netapi_batch_flush(gnrc_netapi_batch_t *batch)
+{
+    unsigned pkts_numof = batch->numof;
+    int numof;
+
+    batch->numof = 0;
+    if (pkts_numof == 0) {
+        return 0;
+    }
+    if (pkts_numof == 1) {
+        /* nothing to gain from the batch snip */
+        numof = gnrc_netapi_dispatch_receive(batch->type, batch->demux_ctx,
+                                             batch->pkts[0]);
+        if (numof == 0) {
+            gnrc_pktbuf_release(batch->pkts[0]);
+        }
+        return numof;
+    }
+
+    gnrc_netreg_acquire_shared();
+
+    numof = gnrc_netreg_num(batch->type, batch->demux_ctx);
+    if (numof == 0) {
+        gnrc_netreg_release_shared();
+        _release_batch(batch->pkts, pkts_numof, 0);
+        return 0;
+    }
+
+    gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(batch->type, batch->demux_ctx);
+    gnrc_pktsnip_t *snip = NULL;
+    int batch_numof = 0;
+
+    for (gnrc_netreg_entry_t *e = sendto; e; e = gnrc_netreg_getnext(e)) {
+        batch_numof += _batch_capable(e);
+    }
+    if (batch_numof > 0) {
+        /* on allocation failure all subscribers get the packets one by one */
+        snip = gnrc_pktbuf_add(NULL, batch->pkts,
+                               pkts_numof * sizeof(gnrc_pktsnip_t *),
+                               GNRC_NETTYPE_UNDEF);
+        if (snip != NULL) {
+            gnrc_pktbuf_hold(snip, batch_numof - 1);
+        }
+    }
+    /* the packets are replicated over all subscribers */
+    for (unsigned i = 0; i < pkts_numof; i++) {
+        gnrc_pktbuf_hold(batch->pkts[i], numof - 1);
+    }
+
+    while (sendto) {
+        if ((snip != NULL) && _batch_capable(sendto)) {
+            if (_gnrc_netapi_send_recv(sendto->target.pid, snip,
+                                       GNRC_NETAPI_MSG_TYPE_RCV_BATCH) < 1) {
+                _release_batch(batch->pkts, pkts_numof, EIO);
+                gnrc_pktbuf_release(snip);
+            }
+        }
+        else {
+            for (unsigned i = 0; i < pkts_numof; i++) {
+                int status = _dispatch_single(sendto, GNRC_NETAPI_MSG_TYPE_RCV,
+                                              batch->pkts[i]);
+                if (status < 0) {
+                    gnrc_pktbuf_release_error(batch->pkts[i], status);
+                }
+            }
+        }
+        sendto = gnrc_netreg_getnext(sendto);
+    }
+
+    gnrc_netreg_release_shared();
+
+    return numof;
+}
+#endif  /* IS_USED(MODULE_GNRC_NETAPI_BATCH) */
+
 int gnrc_netapi_notify(gnrc_nettype_t type, uint32_t demux_ctx, netapi_notify_t event,
                        void *data, size_t data_len)
 {
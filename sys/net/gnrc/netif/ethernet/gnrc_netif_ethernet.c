@@ -160,6 +160,14 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         netif->stats.tx_unicast_count++;
     }
 #endif
+    if (netif->flags & GNRC_NETIF_FLAGS_L4_CSUM_OFFLOAD) {
+        netopt_enable_t csum_offload =
+            (netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_CSUM_OFFLOAD)
+            ? NETOPT_ENABLE : NETOPT_DISABLE;
+
+        dev->driver->set(dev, NETOPT_L4_CSUM_OFFLOAD, &csum_offload,
+                         sizeof(csum_offload));
+    }
     res = dev->driver->send(dev, &iolist);
 
     if (gnrc_netif_netdev_legacy_api(netif)) {
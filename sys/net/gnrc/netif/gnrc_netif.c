@@ -27,6 +27,9 @@
 #include "net/gnrc.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/ipv6.h"
+#if IS_USED(MODULE_GNRC_NETIF_GSO)
+#include "net/gnrc/netif/gso.h"
+#endif /* IS_USED(MODULE_GNRC_NETIF_GSO) */
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq.h"
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
@@ -46,6 +49,9 @@
 #include "net/gnrc/netif.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/tx_sync.h"
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+#include "net/gnrc/single_thread.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -59,8 +65,43 @@ typedef struct {
     gnrc_netif_t *netif;
     mutex_t init_done;
     int result;
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+    event_t host;       /**< sets up the interface in the stack thread */
+#endif
 } _netif_ctx_t;
 
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+/* the interface running in the stack thread */
+static gnrc_netif_t *_hosted;
+static gnrc_single_thread_layer_t _hosted_layer;
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+/* last_wakeup of _gnrc_netif_thread() for _hosted */
+static uint32_t _hosted_last_wakeup;
+#endif
+static void _host(event_t *event);
+#endif
+
+/* passes a NIB message to the IPv6 thread */
+static void _send_to_ipv6(msg_t *msg)
+{
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+    if ((gnrc_ipv6_pid == gnrc_single_thread_pid) &&
+        (gnrc_ipv6_pid == thread_getpid())) {
+        /* a message to itself is dropped once the queue is full, so it is
+         * handled in place then. It is queued otherwise, as e.g. LINK_UP
+         * during the setup of the interface must wait for the setup to
+         * finish. */
+        if (msg_send_to_self(msg) == 0) {
+            msg_t reply;
+
+            gnrc_single_thread_handle_msg(msg, &reply);
+        }
+        return;
+    }
+#endif
+    msg_send(msg, gnrc_ipv6_pid);
+}
+
 int gnrc_netif_create(gnrc_netif_t *netif, char *stack, int stacksize,
                       char priority, const char *name, netdev_t *netdev,
                       const gnrc_netif_ops_t *ops)
@@ -92,6 +133,23 @@ int gnrc_netif_create(gnrc_netif_t *netif, char *stack, int stacksize,
     mutex_init(&ctx.init_done);
     mutex_lock(&ctx.init_done);
 
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+    if (_hosted == NULL) {
+        /* the first interface runs in the stack thread */
+        (void)stack;
+        (void)stacksize;
+        (void)priority;
+        (void)name;
+        (void)res;
+        _hosted = netif;
+        gnrc_single_thread_init();
+        ctx.host = (event_t){ .handler = _host };
+        gnrc_single_thread_post(&ctx.host);
+        mutex_lock(&ctx.init_done);
+        return ctx.result;
+    }
+#endif
+
     res = thread_create(stack, stacksize, priority, 0,
                         _gnrc_netif_thread, &ctx, name);
     assert(res > 0);
@@ -705,7 +763,7 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
         msg_t msg = { .type = GNRC_IPV6_NIB_DAD,
                       .content = { .ptr = &netif->ipv6.addrs[idx] } };
 
-        msg_send(&msg, gnrc_ipv6_pid);
+        _send_to_ipv6(&msg);
     }
 #else
     (void)pfx_len;
@@ -1540,6 +1598,14 @@ static void _init_from_device(gnrc_netif_t *netif)
     netif->device_type = (uint8_t)tmp;
     gnrc_netif_ipv6_init_mtu(netif);
     _update_l2addr_from_dev(netif);
+
+    netopt_enable_t csum_offload = NETOPT_DISABLE;
+
+    res = dev->driver->get(dev, NETOPT_L4_CSUM_OFFLOAD, &csum_offload,
+                           sizeof(csum_offload));
+    if ((res == sizeof(csum_offload)) && (csum_offload == NETOPT_ENABLE)) {
+        netif->flags |= GNRC_NETIF_FLAGS_L4_CSUM_OFFLOAD;
+    }
 }
 
 static void _check_netdev_capabilities(netdev_t *dev, bool legacy)
@@ -1723,7 +1789,19 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back);
 static void _event_handler_isr(event_t *evp)
 {
     gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_isr);
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    /* a driver may signal several received frames per ISR, pass them up in
+     * as few messages as possible */
+    gnrc_netapi_batch_t batch;
+
+    gnrc_netapi_batch_init(&batch);
+    netif->rx_batch = &batch;
+#endif
     netif->dev->driver->isr(netif->dev);
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    netif->rx_batch = NULL;
+    gnrc_netapi_batch_flush(&batch);
+#endif
 }
 
 static void _process_receive_stats(gnrc_netif_t *netdev, gnrc_pktsnip_t *pkt)
@@ -1917,8 +1995,24 @@ static void _event_handler_tx_done(event_t *evp)
 }
 #endif
 
+#if IS_USED(MODULE_GNRC_NETIF_GSO)
+static void _send_segment(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    _send(netif, pkt, false);
+}
+#endif /* IS_USED(MODULE_GNRC_NETIF_GSO) */
+
 static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 {
+#if IS_USED(MODULE_GNRC_NETIF_GSO)
+    if ((pkt->type == GNRC_NETTYPE_NETIF) &&
+        (gnrc_netif_hdr_get_gso(pkt->data) > 0)) {
+        /* segments are sent one by one, so they are queued individually if
+         * the device is busy */
+        gnrc_netif_gso_segment(netif, pkt, _send_segment);
+        return;
+    }
+#endif /* IS_USED(MODULE_GNRC_NETIF_GSO) */
 #if IS_USED(MODULE_NETDEV_NEW_API)
     if (netif->tx_pkt != NULL) {
         /* Upper layer is handing out frames faster than hardware can transmit.
@@ -2004,123 +2098,203 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 #endif
 }
 
-static void *_gnrc_netif_thread(void *args)
+/**
+ * @brief   Sets up @p ctx's interface in the calling thread
+ *
+ * @return  Result of the driver initialization
+ */
+static int _setup(_netif_ctx_t *ctx)
 {
-    _netif_ctx_t *ctx = args;
-    gnrc_netapi_opt_t *opt;
-    gnrc_netif_t *netif;
+    gnrc_netif_t *netif = ctx->netif;
     int res;
-    msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
 
     DEBUG("gnrc_netif: starting thread %i\n", thread_getpid());
-    netif = ctx->netif;
     gnrc_netif_acquire(netif);
     netif->pid = thread_getpid();
 
     netif->event_isr.handler = _event_handler_isr;
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    netif->rx_batch = NULL;
+#endif
 #if IS_USED(MODULE_NETDEV_NEW_API)
     netif->event_tx_done.handler = _event_handler_tx_done;
 #endif
     /* set up the event queue */
     event_queues_init(netif->evq, GNRC_NETIF_EVQ_NUMOF);
 
-    /* setup the link-layer's message queue */
-    msg_init_queue(netif->msg_queue, ARRAY_SIZE(netif->msg_queue));
     /* initialize low-level driver */
-    ctx->result = netif->ops->init(netif);
+    res = netif->ops->init(netif);
+    ctx->result = res;
     /* signal that driver init is done */
     mutex_unlock(&ctx->init_done);
-    if (ctx->result < 0) {
-        LOG_ERROR("gnrc_netif: init %u failed: %d\n", thread_getpid(), ctx->result);
-        return NULL;
+    if (res < 0) {
+        LOG_ERROR("gnrc_netif: init %u failed: %d\n", thread_getpid(), res);
+        return res;
     }
 #ifdef MODULE_NETSTATS_L2
     memset(&netif->stats, 0, sizeof(netstats_t));
 #endif
     /* now let rest of GNRC use the interface */
     gnrc_netif_release(netif);
+    return res;
+}
+
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
-    uint32_t last_wakeup = ztimer_now(ZTIMER_USEC);
+static void _wait_after_send(uint32_t *last_wakeup)
+{
+    ztimer_periodic_wakeup(
+            ZTIMER_USEC,
+            last_wakeup,
+            CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
+        );
+    /* override last_wakeup in case last_wakeup +
+     * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
+    *last_wakeup = ztimer_now(ZTIMER_USEC);
+}
 #endif
 
-    while (1) {
-        msg_t msg;
-        /* msg will be filled by _process_events_await_msg.
-         * The function will not return until a message has been received. */
-        _process_events_await_msg(netif, &msg);
+/**
+ * @brief   Dispatches netdev, MAC and gnrc_netapi messages
+ *
+ * @return  true, if @p reply has to be sent to the sender of @p msg
+ */
+static bool _handle_msg(gnrc_netif_t *netif, msg_t *msg, msg_t *reply)
+{
+    gnrc_netapi_opt_t *opt;
+    int res;
 
-        /* dispatch netdev, MAC and gnrc_netapi messages */
-        DEBUG("gnrc_netif: message %u\n", (unsigned)msg.type);
-        switch (msg.type) {
+    DEBUG("gnrc_netif: message %u\n", (unsigned)msg->type);
+    switch (msg->type) {
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
-            case GNRC_NETIF_PKTQ_DEQUEUE_MSG:
-                DEBUG("gnrc_netif: send from packet send queue\n");
-                _send_queued_pkt(netif);
-                break;
+        case GNRC_NETIF_PKTQ_DEQUEUE_MSG:
+            DEBUG("gnrc_netif: send from packet send queue\n");
+            _send_queued_pkt(netif);
+            break;
 #endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
-                _send(netif, msg.content.ptr, false);
-#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
-                ztimer_periodic_wakeup(
-                        ZTIMER_USEC,
-                        &last_wakeup,
-                        CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
-                    );
-                /* override last_wakeup in case last_wakeup +
-                 * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
-                last_wakeup = ztimer_now(ZTIMER_USEC);
-#endif
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                opt = msg.content.ptr;
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
+            _send(netif, msg->content.ptr, false);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SET:
+            opt = msg->content.ptr;
 #ifdef MODULE_NETOPT
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%s\n",
-                      netopt2str(opt->opt));
+            DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%s\n",
+                  netopt2str(opt->opt));
 #else
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%d\n",
-                      opt->opt);
+            DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%d\n",
+                  opt->opt);
 #endif
-                /* set option for device driver */
-                res = netif->ops->set(netif, opt);
-                DEBUG("gnrc_netif: response of netif->ops->set(): %i\n", res);
-                reply.content.value = (uint32_t)res;
-                msg_reply(&msg, &reply);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_GET:
-                opt = msg.content.ptr;
+            /* set option for device driver */
+            res = netif->ops->set(netif, opt);
+            DEBUG("gnrc_netif: response of netif->ops->set(): %i\n", res);
+            reply->content.value = (uint32_t)res;
+            return true;
+        case GNRC_NETAPI_MSG_TYPE_GET:
+            opt = msg->content.ptr;
 #ifdef MODULE_NETOPT
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%s\n",
-                      netopt2str(opt->opt));
+            DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%s\n",
+                  netopt2str(opt->opt));
 #else
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%d\n",
-                      opt->opt);
+            DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%d\n",
+                  opt->opt);
 #endif
-                /* get option from device driver */
-                res = netif->ops->get(netif, opt);
-                DEBUG("gnrc_netif: response of netif->ops->get(): %i\n", res);
-                reply.content.value = (uint32_t)res;
-                msg_reply(&msg, &reply);
-                break;
-            default:
-                if (netif->ops->msg_handler) {
-                    DEBUG("gnrc_netif: delegate message of type 0x%04x to "
-                          "netif->ops->msg_handler()\n", msg.type);
-                    netif->ops->msg_handler(netif, &msg);
-                }
-                else {
-                    DEBUG("gnrc_netif: unknown message type 0x%04x"
-                          "(no message handler defined)\n", msg.type);
-                }
-                break;
+            /* get option from device driver */
+            res = netif->ops->get(netif, opt);
+            DEBUG("gnrc_netif: response of netif->ops->get(): %i\n", res);
+            reply->content.value = (uint32_t)res;
+            return true;
+        default:
+            if (netif->ops->msg_handler) {
+                DEBUG("gnrc_netif: delegate message of type 0x%04x to "
+                      "netif->ops->msg_handler()\n", msg->type);
+                netif->ops->msg_handler(netif, msg);
+            }
+            else {
+                DEBUG("gnrc_netif: unknown message type 0x%04x"
+                      "(no message handler defined)\n", msg->type);
+            }
+            break;
+    }
+    return false;
+}
+
+static void *_gnrc_netif_thread(void *args)
+{
+    _netif_ctx_t *ctx = args;
+    gnrc_netif_t *netif = ctx->netif;
+    msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
+
+    /* setup the link-layer's message queue */
+    msg_init_queue(netif->msg_queue, ARRAY_SIZE(netif->msg_queue));
+    if (_setup(ctx) < 0) {
+        return NULL;
+    }
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+    uint32_t last_wakeup = ztimer_now(ZTIMER_USEC);
+#endif
+
+    while (1) {
+        msg_t msg;
+        /* msg will be filled by _process_events_await_msg.
+         * The function will not return until a message has been received. */
+        _process_events_await_msg(netif, &msg);
+
+        if (_handle_msg(netif, &msg, &reply)) {
+            msg_reply(&msg, &reply);
         }
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_SND) {
+            _wait_after_send(&last_wakeup);
+        }
+#endif
     }
     /* never reached */
     return NULL;
 }
 
-static void _pass_on_packet(gnrc_pktsnip_t *pkt)
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+static bool _hosted_handle_msg(msg_t *msg, msg_t *reply)
+{
+    _handle_msg(_hosted, msg, reply);
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+    if (msg->type == GNRC_NETAPI_MSG_TYPE_SND) {
+        _wait_after_send(&_hosted_last_wakeup);
+    }
+#endif
+    /* the interface is added last and takes all messages left */
+    return true;
+}
+
+static void _host(event_t *event)
 {
+    _netif_ctx_t *ctx = container_of(event, _netif_ctx_t, host);
+    gnrc_netif_t *netif = ctx->netif;
+
+    /* ctx is gone once _setup() signaled that it is done */
+    if (_setup(ctx) < 0) {
+        return;
+    }
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+    _hosted_last_wakeup = ztimer_now(ZTIMER_USEC);
+#endif
+    _hosted_layer.msg_handler = _hosted_handle_msg;
+    _hosted_layer.evq = netif->evq;
+    _hosted_layer.evq_numof = GNRC_NETIF_EVQ_NUMOF;
+    gnrc_single_thread_add(&_hosted_layer);
+}
+#endif  /* IS_USED(MODULE_GNRC_SINGLE_THREAD) */
+
+static void _pass_on_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    if (netif->rx_batch != NULL) {
+        gnrc_netapi_batch_receive(netif->rx_batch, pkt->type,
+                                  GNRC_NETREG_DEMUX_CTX_ALL, pkt);
+        return;
+    }
+#else
+    (void)netif;
+#endif
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
@@ -2152,14 +2326,14 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 if (IS_USED(MODULE_GNRC_IPV6)) {
                     msg_t msg = { .type = GNRC_IPV6_NIB_IFACE_UP, .content = { .ptr = netif } };
 
-                    msg_send(&msg, gnrc_ipv6_pid);
+                    _send_to_ipv6(&msg);
                 }
                 break;
             case NETDEV_EVENT_LINK_DOWN:
                 if (IS_USED(MODULE_GNRC_IPV6)) {
                     msg_t msg = { .type = GNRC_IPV6_NIB_IFACE_DOWN, .content = { .ptr = netif } };
 
-                    msg_send(&msg, gnrc_ipv6_pid);
+                    _send_to_ipv6(&msg);
                 }
                 break;
             case NETDEV_EVENT_RX_COMPLETE:
@@ -2170,7 +2344,7 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 _send_queued_pkt(netif);
                 if (pkt) {
                     _process_receive_stats(netif, pkt);
-                    _pass_on_packet(pkt);
+                    _pass_on_packet(netif, pkt);
                 }
                 break;
 #if IS_USED(MODULE_NETDEV_LEGACY_API)
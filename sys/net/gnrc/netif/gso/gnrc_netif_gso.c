@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "net/gnrc/netif/gso.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/tcp.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _TCP_FLAGS_LAST_ONLY    (0x0009)    /* FIN | PSH */
+
+/* copies len bytes from offset off of the payload snips starting at pay */
+static void _copy_payload(uint8_t *dst, const gnrc_pktsnip_t *pay,
+                          size_t off, size_t len)
+{
+    for (; (pay != NULL) && (off >= pay->size); pay = pay->next) {
+        off -= pay->size;
+    }
+    for (; (pay != NULL) && (len > 0); pay = pay->next, off = 0) {
+        size_t chunk = pay->size - off;
+
+        if (chunk > len) {
+            chunk = len;
+        }
+        memcpy(dst, (uint8_t *)pay->data + off, chunk);
+        dst += chunk;
+        len -= chunk;
+    }
+}
+
+/* copies the headers of the super-segment up to and including the TCP
+ * header, the copy of the TCP header is returned in seg_tcp */
+static gnrc_pktsnip_t *_copy_hdrs(const gnrc_pktsnip_t *pkt,
+                                  const gnrc_pktsnip_t *tcp,
+                                  gnrc_pktsnip_t **seg_tcp)
+{
+    gnrc_pktsnip_t *seg = NULL, *tail = NULL;
+
+    for (const gnrc_pktsnip_t *snip = pkt; snip != tcp->next;
+         snip = snip->next) {
+        gnrc_pktsnip_t *copy = gnrc_pktbuf_add(NULL, snip->data, snip->size,
+                                               snip->type);
+
+        if (copy == NULL) {
+            gnrc_pktbuf_release(seg);
+            return NULL;
+        }
+        if (tail == NULL) {
+            seg = copy;
+        }
+        else {
+            tail->next = copy;
+        }
+        tail = copy;
+    }
+    *seg_tcp = tail;
+    return seg;
+}
+
+static int _csum(gnrc_netif_t *netif, gnrc_pktsnip_t *seg,
+                 gnrc_pktsnip_t *ipv6, gnrc_pktsnip_t *tcp)
+{
+    tcp_hdr_t *tcp_hdr = tcp->data;
+
+    if ((netif->flags & GNRC_NETIF_FLAGS_L4_CSUM_OFFLOAD) &&
+        (ipv6->next == tcp)) {
+        gnrc_netif_hdr_t *hdr = seg->data;
+
+        tcp_hdr->checksum = byteorder_htons(
+            ipv6_hdr_inet_csum(0, ipv6->data, PROTNUM_TCP, gnrc_pkt_len(tcp)));
+        hdr->flags |= GNRC_NETIF_HDR_FLAGS_CSUM_OFFLOAD;
+        return 0;
+    }
+    return gnrc_netreg_calc_csum(tcp, ipv6);
+}
+
+int gnrc_netif_gso_segment(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                           gnrc_netif_gso_send_t send)
+{
+    gnrc_netif_hdr_t *netif_hdr = pkt->data;
+    uint16_t gso_size = gnrc_netif_hdr_get_gso(netif_hdr);
+    gnrc_pktsnip_t *tcp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    int res = 0;
+
+    assert((pkt->type == GNRC_NETTYPE_NETIF) && (gso_size > 0));
+    if ((pkt->next == NULL) || (pkt->next->type != GNRC_NETTYPE_IPV6) ||
+        (tcp == NULL)) {
+        DEBUG("gnrc_netif_gso: super-segment is no IPv6 TCP segment\n");
+        gnrc_pktbuf_release_error(pkt, ENOTSUP);
+        return -ENOTSUP;
+    }
+
+    const tcp_hdr_t *tcp_hdr = tcp->data;
+    size_t pay_len = 0;
+    uint32_t seq = byteorder_ntohl(tcp_hdr->seq_num);
+    uint16_t off_ctl = byteorder_ntohs(tcp_hdr->off_ctl);
+
+    for (const gnrc_pktsnip_t *pay = tcp->next;
+         (pay != NULL) && (pay->type == GNRC_NETTYPE_UNDEF); pay = pay->next) {
+        pay_len += pay->size;
+    }
+
+    DEBUG("gnrc_netif_gso: segmenting %u bytes into %u byte segments\n",
+          (unsigned)pay_len, (unsigned)gso_size);
+    for (size_t off = 0; off < pay_len; off += gso_size) {
+        size_t len = ((pay_len - off) < gso_size) ? (pay_len - off) : gso_size;
+        gnrc_pktsnip_t *seg_tcp, *seg_pay;
+        gnrc_pktsnip_t *seg = _copy_hdrs(pkt, tcp, &seg_tcp);
+
+        if ((seg == NULL) ||
+            ((seg_pay = gnrc_pktbuf_add(NULL, NULL, len,
+                                        GNRC_NETTYPE_UNDEF)) == NULL)) {
+            DEBUG("gnrc_netif_gso: unable to allocate segment\n");
+            gnrc_pktbuf_release(seg);
+            res = -ENOMEM;
+            break;
+        }
+        _copy_payload(seg_pay->data, tcp->next, off, len);
+        seg_tcp->next = seg_pay;
+
+        gnrc_netif_hdr_t *seg_netif_hdr = seg->data;
+        ipv6_hdr_t *seg_ipv6_hdr = seg->next->data;
+        tcp_hdr_t *seg_tcp_hdr = seg_tcp->data;
+
+        seg_netif_hdr->flags &= ~(GNRC_NETIF_HDR_FLAGS_GSO |
+                                  GNRC_NETIF_HDR_FLAGS_CSUM_OFFLOAD);
+        seg_ipv6_hdr->len = byteorder_htons(gnrc_pkt_len(seg->next->next));
+        seg_tcp_hdr->seq_num = byteorder_htonl(seq + off);
+        if ((off + len) < pay_len) {
+            seg_tcp_hdr->off_ctl = byteorder_htons(off_ctl &
+                                                   ~_TCP_FLAGS_LAST_ONLY);
+        }
+        int csum_res = _csum(netif, seg, seg->next, seg_tcp);
+
+        /* -ENOENT: there is no checksum to calculate */
+        if ((csum_res < 0) && (csum_res != -ENOENT)) {
+            DEBUG("gnrc_netif_gso: unable to calculate checksum\n");
+            gnrc_pktbuf_release(seg);
+            res = -ENOTSUP;
+            break;
+        }
+        send(netif, seg);
+        res++;
+    }
+    gnrc_pktbuf_release(pkt);
+    return res;
+}
+
+/** @} */
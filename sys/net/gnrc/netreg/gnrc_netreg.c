@@ -17,6 +17,7 @@
 #include <limits.h>
 
 #include "assert.h"
+#include "kernel_defines.h"
 #include "log.h"
 #include "utlist.h"
 #include "net/gnrc/netreg.h"
@@ -31,8 +32,28 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
-/* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+#define _BUCKETS_EXP        CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP
+#else
+#define _BUCKETS_EXP        0
+#endif
+
+/* The registry as lookup table by gnrc_nettype_t and hash of the demux
+ * context. All entries with the same demux context are in the same list, in
+ * the order of registration (newest first). */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][1 << _BUCKETS_EXP];
+
+static inline unsigned _bucket(uint32_t demux_ctx)
+{
+#if _BUCKETS_EXP > 0
+    /* multiplicative hashing: UDP ports and protocol numbers only differ in
+     * the lower bits */
+    return (uint32_t)(demux_ctx * 2654435761U) >> (32 - _BUCKETS_EXP);
+#else
+    (void)demux_ctx;
+    return 0;
+#endif
+}
 
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
@@ -63,7 +84,7 @@ static mutex_t _lock_wait_exclusive = MUTEX_INIT;
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -155,11 +176,11 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(netreg[type][_bucket(entry->demux_ctx)], e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(netreg[type][_bucket(entry->demux_ctx)], entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -172,7 +193,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(netreg[type][_bucket(entry->demux_ctx)], entry);
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,7 +235,8 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : netreg[type][_bucket(demux_ctx)];
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
@@ -25,19 +25,29 @@
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "net/gnrc/sixlowpan/nd.h"
 #include "net/protnum.h"
+#include "net/tcp.h"
+#include "net/udp.h"
 #include "thread.h"
 #include "utlist.h"
 
 #include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netapi/batch.h"
 #include "net/gnrc/netapi/notify.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/ipv6/whitelist.h"
 #include "net/gnrc/ipv6/blacklist.h"
+#ifdef MODULE_GNRC_SINGLE_THREAD
+#include "net/gnrc/single_thread.h"
+#endif
 
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
 #include "net/gnrc/ipv6/ext/frag.h"
 #endif
 
+#if IS_USED(MODULE_GNRC_NETIF_GSO)
+#include "net/gnrc/netif/gso.h"
+#endif
+
 #ifdef MODULE_FIB
 #include "net/fib.h"
 #include "net/fib/table.h"
@@ -50,8 +60,23 @@
 
 #define _MAX_L2_ADDR_LEN    (8U)
 
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt);
+static bool _handle_msg(msg_t *msg, msg_t *reply);
+
+/* IPv6 as a layer of the stack thread */
+static gnrc_single_thread_layer_t _layer = {
+    .netapi_cb = _netapi_cb,
+    .msg_handler = _handle_msg,
+};
+static gnrc_netreg_entry_t _ipv6_reg;
+#ifdef MODULE_GNRC_NETAPI_NOTIFY
+static gnrc_netreg_entry_t _discovery_reg;
+#endif
+#else
 static char _stack[GNRC_IPV6_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 static msg_t _msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+#endif
 
 #ifdef MODULE_FIB
 /**
@@ -71,6 +96,14 @@ kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+/* collects the packets passed up while a batch is handled, NULL otherwise */
+static gnrc_netapi_batch_t *_rx_batch;
+#endif
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) && !IS_USED(MODULE_GNRC_SINGLE_THREAD)
+/* handles GNRC_NETAPI_MSG_TYPE_RCV_BATCH commands */
+static void _receive_batch(gnrc_pktsnip_t *batch);
+#endif
 /* Sends packet over the appropriate interface(s).
  * prep_hdr: prepare header for sending (call to _fill_ipv6_hdr()), otherwise
  * assume it is already prepared */
@@ -79,15 +112,34 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr);
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
 static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt);
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
+#if !IS_USED(MODULE_GNRC_SINGLE_THREAD)
 /* Main event loop for IPv6 */
 static void *_event_loop(void *args);
+#endif
 
 kernel_pid_t gnrc_ipv6_init(void)
 {
     if (gnrc_ipv6_pid == KERNEL_PID_UNDEF) {
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+        /* run IPv6 in the stack thread */
+        gnrc_ipv6_pid = gnrc_single_thread_init();
+#ifdef MODULE_GNRC_IPV6_EXT_FRAG
+        gnrc_ipv6_ext_frag_init();
+#endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
+        gnrc_single_thread_add(&_layer);
+        gnrc_single_thread_entry_init(&_ipv6_reg, GNRC_NETREG_DEMUX_CTX_ALL,
+                                      &_layer);
+        gnrc_netreg_register(GNRC_NETTYPE_IPV6, &_ipv6_reg);
+#ifdef MODULE_GNRC_NETAPI_NOTIFY
+        gnrc_single_thread_entry_init(&_discovery_reg, GNRC_NETREG_DEMUX_CTX_ALL,
+                                      &_layer);
+        gnrc_netreg_register(GNRC_NETTYPE_L2_DISCOVERY, &_discovery_reg);
+#endif /* MODULE_GNRC_NETAPI_NOTIFY */
+#else
         gnrc_ipv6_pid = thread_create(_stack, sizeof(_stack), GNRC_IPV6_PRIO,
                                       0,
                                       _event_loop, NULL, "ipv6");
+#endif
     }
 
 #ifdef MODULE_FIB
@@ -142,6 +194,20 @@ ipv6_hdr_t *gnrc_ipv6_get_header(gnrc_pktsnip_t *pkt)
 }
 
 /* internal functions */
+static void _dispatch_receive(gnrc_nettype_t type, uint32_t demux_ctx,
+                              gnrc_pktsnip_t *pkt)
+{
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    if (_rx_batch != NULL) {
+        gnrc_netapi_batch_receive(_rx_batch, type, demux_ctx, pkt);
+        return;
+    }
+#endif
+    if (gnrc_netapi_dispatch_receive(type, demux_ctx, pkt) == 0) {
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
 static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
                                   bool interested)
 {
@@ -154,11 +220,7 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
         gnrc_pktbuf_hold(pkt, 1);   /* don't remove from packet buffer in
                                      * next dispatch */
     }
-    if (gnrc_netapi_dispatch_receive(pkt->type,
-                                     GNRC_NETREG_DEMUX_CTX_ALL,
-                                     pkt) == 0) {
-        gnrc_pktbuf_release(pkt);
-    }
+    _dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL, pkt);
     if (!has_nh_subs) {
         /* we should exit early. pkt was already released above */
         return;
@@ -167,9 +229,7 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
         gnrc_pktbuf_hold(pkt, 1);   /* don't remove from packet buffer in
                                      * next dispatch */
     }
-    if (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6, nh, pkt) == 0) {
-        gnrc_pktbuf_release(pkt);
-    }
+    _dispatch_receive(GNRC_NETTYPE_IPV6, nh, pkt);
 }
 
 /**
@@ -279,6 +339,76 @@ static inline void _netapi_notify_event(gnrc_netapi_notify_t *notify)
     }
 }
 
+/* handles messages other than netapi commands */
+static bool _handle_msg(msg_t *msg, msg_t *reply)
+{
+    (void)reply;
+    switch (msg->type) {
+#ifdef MODULE_GNRC_IPV6_EXT_FRAG
+        case GNRC_IPV6_EXT_FRAG_RBUF_GC:
+            gnrc_ipv6_ext_frag_rbuf_gc();
+            break;
+        case GNRC_IPV6_EXT_FRAG_CONTINUE:
+            DEBUG("ipv6: continue fragmenting packet\n");
+            gnrc_ipv6_ext_frag_send(msg->content.ptr);
+            break;
+        case GNRC_IPV6_EXT_FRAG_SEND:
+            DEBUG("ipv6: send fragment\n");
+            _send_by_netif_hdr(msg->content.ptr);
+            break;
+#endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
+        case GNRC_IPV6_NIB_SND_UC_NS:
+        case GNRC_IPV6_NIB_SND_MC_NS:
+        case GNRC_IPV6_NIB_SND_NA:
+        case GNRC_IPV6_NIB_SEARCH_RTR:
+        case GNRC_IPV6_NIB_REPLY_RS:
+        case GNRC_IPV6_NIB_SND_MC_RA:
+        case GNRC_IPV6_NIB_REACH_TIMEOUT:
+        case GNRC_IPV6_NIB_DELAY_TIMEOUT:
+        case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
+        case GNRC_IPV6_NIB_ABR_TIMEOUT:
+        case GNRC_IPV6_NIB_PFX_TIMEOUT:
+        case GNRC_IPV6_NIB_RTR_TIMEOUT:
+        case GNRC_IPV6_NIB_RECALC_REACH_TIME:
+        case GNRC_IPV6_NIB_REREG_ADDRESS:
+        case GNRC_IPV6_NIB_DAD:
+        case GNRC_IPV6_NIB_VALID_ADDR:
+            DEBUG("ipv6: NIB timer event received\n");
+            gnrc_ipv6_nib_handle_timer_event(msg->content.ptr, msg->type);
+            break;
+        case GNRC_IPV6_NIB_IFACE_UP:
+            gnrc_ipv6_nib_iface_up(msg->content.ptr);
+            break;
+        case GNRC_IPV6_NIB_IFACE_DOWN:
+            gnrc_ipv6_nib_iface_down(msg->content.ptr, false);
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt)
+{
+    switch (cmd) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
+            _receive(pkt);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
+            _send(pkt, true);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_NOTIFY:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_NOTIFY received\n");
+            _netapi_notify_event((gnrc_netapi_notify_t *)pkt);
+            break;
+        default:
+            break;
+    }
+}
+#else
 static void *_event_loop(void *args)
 {
     msg_t msg, reply;
@@ -301,6 +431,9 @@ static void *_event_loop(void *args)
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
 
     /* Register interest in all IPv6 packets. */
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    me_ipv6_reg.batch = true;
+#endif
     gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_ipv6_reg);
 
 #ifdef MODULE_GNRC_NETAPI_NOTIFY
@@ -322,6 +455,13 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                _receive_batch(msg.content.ptr);
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr, true);
@@ -337,60 +477,34 @@ static void *_event_loop(void *args)
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_NOTIFY received\n");
                 _netapi_notify_event(msg.content.ptr);
                 break;
-#ifdef MODULE_GNRC_IPV6_EXT_FRAG
-            case GNRC_IPV6_EXT_FRAG_RBUF_GC:
-                gnrc_ipv6_ext_frag_rbuf_gc();
-                break;
-            case GNRC_IPV6_EXT_FRAG_CONTINUE:
-                DEBUG("ipv6: continue fragmenting packet\n");
-                gnrc_ipv6_ext_frag_send(msg.content.ptr);
-                break;
-            case GNRC_IPV6_EXT_FRAG_SEND:
-                DEBUG("ipv6: send fragment\n");
-                _send_by_netif_hdr(msg.content.ptr);
-                break;
-#endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
-            case GNRC_IPV6_NIB_SND_UC_NS:
-            case GNRC_IPV6_NIB_SND_MC_NS:
-            case GNRC_IPV6_NIB_SND_NA:
-            case GNRC_IPV6_NIB_SEARCH_RTR:
-            case GNRC_IPV6_NIB_REPLY_RS:
-            case GNRC_IPV6_NIB_SND_MC_RA:
-            case GNRC_IPV6_NIB_REACH_TIMEOUT:
-            case GNRC_IPV6_NIB_DELAY_TIMEOUT:
-            case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
-            case GNRC_IPV6_NIB_ABR_TIMEOUT:
-            case GNRC_IPV6_NIB_PFX_TIMEOUT:
-            case GNRC_IPV6_NIB_RTR_TIMEOUT:
-            case GNRC_IPV6_NIB_RECALC_REACH_TIME:
-            case GNRC_IPV6_NIB_REREG_ADDRESS:
-            case GNRC_IPV6_NIB_DAD:
-            case GNRC_IPV6_NIB_VALID_ADDR:
-                DEBUG("ipv6: NIB timer event received\n");
-                gnrc_ipv6_nib_handle_timer_event(msg.content.ptr, msg.type);
-                break;
-            case GNRC_IPV6_NIB_IFACE_UP:
-                gnrc_ipv6_nib_iface_up(msg.content.ptr);
-                break;
-            case GNRC_IPV6_NIB_IFACE_DOWN:
-                gnrc_ipv6_nib_iface_down(msg.content.ptr, false);
-                break;
             default:
+                _handle_msg(&msg, &reply);
                 break;
         }
     }
 
     return NULL;
 }
+#endif  /* IS_USED(MODULE_GNRC_SINGLE_THREAD) */
 
 static void _send_to_iface(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     const ipv6_hdr_t *hdr = pkt->next->data;
+    /* super-segments are segmented to the MTU by the interface */
+    bool gso = (gnrc_netif_hdr_get_gso(pkt->data) > 0);
 
     (void)hdr;  /* only used for DEBUG messages */
     assert(netif != NULL);
     gnrc_netif_hdr_set_netif(pkt->data, netif);
-    if (gnrc_pkt_len(pkt->next) > netif->ipv6.mtu) {
+#if IS_USED(MODULE_GNRC_NETIF_GSO) && defined(MODULE_GNRC_SIXLOWPAN)
+    if (gso && gnrc_netif_is_6lo(netif)) {
+        DEBUG("ipv6: segment super-segment for 6LoWPAN\n");
+        /* 6LoWPAN only takes IPv6 packets, so segment before */
+        gnrc_netif_gso_segment(netif, pkt, _send_to_iface);
+        return;
+    }
+#endif
+    if (!gso && (gnrc_pkt_len(pkt->next) > netif->ipv6.mtu)) {
         DEBUG("ipv6: packet too big\n");
         gnrc_icmpv6_error_pkt_too_big_send(netif->ipv6.mtu, pkt);
         gnrc_pktbuf_release_error(pkt, EMSGSIZE);
@@ -458,7 +572,62 @@ static bool _is_ipv6_hdr(gnrc_pktsnip_t *hdr)
 #endif
 }
 
-static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
+/* leaves the checksum of the payload header to the network device, see
+ * NETOPT_L4_CSUM_OFFLOAD */
+static bool _offload_csum(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6,
+                          gnrc_pktsnip_t *payload)
+{
+    network_uint16_t *csum;
+    uint8_t prot_num;
+
+    if (!(netif->flags & GNRC_NETIF_FLAGS_L4_CSUM_OFFLOAD) ||
+        /* the device expects the payload header right after the IPv6
+         * header */
+        (ipv6->next != payload) ||
+        /* fragments can only be checksummed as a whole */
+        (gnrc_pkt_len(ipv6) > netif->ipv6.mtu)) {
+        return false;
+    }
+    switch (payload->type) {
+#if IS_USED(MODULE_GNRC_NETTYPE_ICMPV6)
+        case GNRC_NETTYPE_ICMPV6:
+            csum = &((icmpv6_hdr_t *)payload->data)->csum;
+            prot_num = PROTNUM_ICMPV6;
+            break;
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_TCP)
+        case GNRC_NETTYPE_TCP:
+            csum = &((tcp_hdr_t *)payload->data)->checksum;
+            prot_num = PROTNUM_TCP;
+            break;
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_UDP)
+        case GNRC_NETTYPE_UDP:
+            csum = &((udp_hdr_t *)payload->data)->checksum;
+            prot_num = PROTNUM_UDP;
+            break;
+#endif
+        default:
+            return false;
+    }
+    /* the partial sum depends on the interface's source address, so the
+     * payload header must not be shared with the packet sent over another
+     * interface (see _send_multicast()) */
+    assert(payload->users == 1);
+    *csum = byteorder_htons(ipv6_hdr_inet_csum(0, ipv6->data, prot_num,
+                                               gnrc_pkt_len(payload)));
+    return true;
+}
+
+/*
+ * netif_hdr_flags: flags of the netif header to be created for the packet,
+ * GNRC_NETIF_HDR_FLAGS_CSUM_OFFLOAD is added when the checksum is left to the
+ * network device. The checksum of super-segments (GNRC_NETIF_HDR_FLAGS_GSO)
+ * is left to gnrc_netif_gso. May be NULL if the packet does not leave through
+ * netif.
+ */
+static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6,
+                          uint8_t *netif_hdr_flags)
 {
     int res;
     ipv6_hdr_t *hdr = ipv6->data;
@@ -558,6 +727,16 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
         prev->next = payload;
         prev = payload;
     }
+    if ((netif_hdr_flags != NULL) &&
+        (*netif_hdr_flags & GNRC_NETIF_HDR_FLAGS_GSO)) {
+        DEBUG("ipv6: leave checksum for upper header to segmentation.\n");
+        return 0;
+    }
+    if ((netif_hdr_flags != NULL) && _offload_csum(netif, ipv6, payload)) {
+        DEBUG("ipv6: leave checksum for upper header to device.\n");
+        *netif_hdr_flags |= GNRC_NETIF_HDR_FLAGS_CSUM_OFFLOAD;
+        return 0;
+    }
     DEBUG("ipv6: calculate checksum for upper header.\n");
     if ((res = gnrc_netreg_calc_csum(payload, ipv6)) < 0) {
         if (res != -ENOENT) {   /* if there is no checksum we are okay */
@@ -571,9 +750,9 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
 }
 
 static bool _safe_fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
-                                bool prep_hdr)
+                                bool prep_hdr, uint8_t *netif_hdr_flags)
 {
-    if (prep_hdr && (_fill_ipv6_hdr(netif, pkt) < 0)) {
+    if (prep_hdr && (_fill_ipv6_hdr(netif, pkt, netif_hdr_flags) < 0)) {
         /* error on filling up header */
         gnrc_pktbuf_release(pkt);
         return false;
@@ -590,7 +769,9 @@ static bool _fragment_pkt_if_needed(gnrc_pktsnip_t *pkt,
     /* TODO: get path MTU when PMTU discovery is implemented */
     unsigned path_mtu = netif->ipv6.mtu;
 
-    if (from_me && (gnrc_pkt_len(pkt->next) > path_mtu)) {
+    if (from_me && (gnrc_pkt_len(pkt->next) > path_mtu) &&
+        /* super-segments are segmented instead */
+        (gnrc_netif_hdr_get_gso(pkt->data) == 0)) {
         gnrc_netif_hdr_t *hdr = pkt->data;
         hdr->if_pid = netif->pid;
         gnrc_ipv6_ext_frag_send_pkt(pkt, path_mtu);
@@ -616,7 +797,7 @@ static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt)
 
 static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
-                          uint8_t netif_hdr_flags)
+                          uint8_t netif_hdr_flags, uint16_t gso_size)
 {
     gnrc_ipv6_nib_nc_t nce;
 
@@ -630,12 +811,15 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
     }
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
-    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, &netif_hdr_flags)) {
         DEBUG("ipv6: add interface header to packet\n");
         if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
                                      netif_hdr_flags)) == NULL) {
             return;
         }
+        if (netif_hdr_flags & GNRC_NETIF_HDR_FLAGS_GSO) {
+            gnrc_netif_hdr_set_gso(pkt->data, gso_size);
+        }
         /* prep_hdr => The packet is from me */
         if (_fragment_pkt_if_needed(pkt, netif, prep_hdr)) {
             DEBUG("ipv6: packet is fragmented\n");
@@ -705,13 +889,17 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
 
             while ((netif = gnrc_netif_iter(netif))) {
                 gnrc_pktsnip_t *send_pkt = pkt;
+                uint8_t send_flags = netif_hdr_flags;
                 /* for !prep_hdr just use pkt as we don't duplicate IPv6 header as
                  * it is already filled and thus isn't filled with potentially
                  * interface-specific data */
                 if (prep_hdr) {
                     DEBUG("ipv6: prepare IPv6 header for sending\n");
                     /* need to get second write access (duplication) to fill IPv6
-                     * header with interface-specific data */
+                     * header with interface-specific data. _fill_ipv6_hdr()
+                     * duplicates the payload header as well before writing
+                     * its (partial) checksum, so every interface gets its
+                     * own copy and only the last one writes to pkt */
                     send_pkt = gnrc_pktbuf_start_write(pkt);
 
                     if (send_pkt == NULL) {
@@ -720,7 +908,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                         gnrc_pktbuf_release(pkt);
                         return;
                     }
-                    if (_fill_ipv6_hdr(netif, send_pkt) < 0) {
+                    if (_fill_ipv6_hdr(netif, send_pkt, &send_flags) < 0) {
                         /* error on filling up header */
                         if (send_pkt != pkt) {
                             gnrc_pktbuf_release(send_pkt);
@@ -730,11 +918,11 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                     }
                 }
                 _send_multicast_over_iface(send_pkt, prep_hdr, netif,
-                                           netif_hdr_flags);
+                                           send_flags);
             }
         }
         else {
-            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, &netif_hdr_flags)) {
                 _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
             }
         }
@@ -749,7 +937,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                 return;
             }
         }
-        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, &netif_hdr_flags)) {
             _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
         }
     }
@@ -759,7 +947,7 @@ static void _send_to_self(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif)
 {
     /* _safe_fill_ipv6_hdr releases pkt on error */
-    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, NULL)) {
         DEBUG("ipv6: error looping packet to sender.\n");
         return;
     }
@@ -786,6 +974,7 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
     gnrc_pktsnip_t *tmp_pkt;
     ipv6_hdr_t *ipv6_hdr;
     uint8_t netif_hdr_flags = 0U;
+    uint16_t gso_size = 0U;
 
     /* get IPv6 snip and (if present) generic interface header */
     if (pkt->type == GNRC_NETTYPE_NETIF) {
@@ -800,7 +989,9 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
          * set if dst is a multicast address) */
         netif_hdr_flags = netif_hdr->flags &
                           ~(GNRC_NETIF_HDR_FLAGS_BROADCAST |
-                            GNRC_NETIF_HDR_FLAGS_MULTICAST);
+                            GNRC_NETIF_HDR_FLAGS_MULTICAST |
+                            GNRC_NETIF_HDR_FLAGS_CSUM_OFFLOAD);
+        gso_size = gnrc_netif_hdr_get_gso(netif_hdr);
 
         tmp_pkt = gnrc_pktbuf_start_write(pkt);
         if (tmp_pkt == NULL) {
@@ -837,6 +1028,8 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
     ipv6_hdr = pkt->data;
 
     if (ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
+        /* super-segments are only supported for unicast */
+        netif_hdr_flags &= ~GNRC_NETIF_HDR_FLAGS_GSO;
         _send_multicast(pkt, prep_hdr, netif, netif_hdr_flags);
     }
     else {
@@ -853,7 +1046,8 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
             _send_to_self(pkt, prep_hdr, tmp_netif);
         }
         else {
-            _send_unicast(pkt, prep_hdr, netif, ipv6_hdr, netif_hdr_flags);
+            _send_unicast(pkt, prep_hdr, netif, ipv6_hdr, netif_hdr_flags,
+                          gso_size);
         }
     }
 }
@@ -874,6 +1068,23 @@ static inline bool _pkt_not_for_me(gnrc_netif_t **netif, ipv6_hdr_t *hdr)
     }
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) && !IS_USED(MODULE_GNRC_SINGLE_THREAD)
+static void _receive_batch(gnrc_pktsnip_t *batch)
+{
+    gnrc_netapi_batch_t up;
+
+    /* pass the packets up in batches as well */
+    gnrc_netapi_batch_init(&up);
+    _rx_batch = &up;
+    for (unsigned i = 0; i < gnrc_netapi_batch_numof(batch); i++) {
+        _receive(gnrc_netapi_batch_get(batch, i));
+    }
+    _rx_batch = NULL;
+    gnrc_netapi_batch_flush(&up);
+    gnrc_pktbuf_release(batch);
+}
+#endif
+
 static void _receive(gnrc_pktsnip_t *pkt)
 {
     gnrc_netif_t *netif = NULL;
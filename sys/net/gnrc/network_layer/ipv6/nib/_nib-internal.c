@@ -29,6 +29,7 @@
 #include "random.h"
 
 #include "_nib-internal.h"
+#include "_nib-lpm.h"
 #include "_nib-router.h"
 
 #define ENABLE_DEBUG 0
@@ -67,6 +68,8 @@ void _nib_init(void)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 #endif  /* TEST_SUITES */
+    _nib_nc_hash_init();
+    _nib_lpm_init();
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
@@ -223,6 +226,14 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    _nib_onl_entry_t *node = _nib_nc_hash_get(addr, iface);
+
+    if (node != NULL) {
+        DEBUG("  Found %p\n", (void *)node);
+        return node;
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -236,6 +247,7 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
             return node;
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     DEBUG("  No suitable entry found\n");
     return NULL;
 }
@@ -510,7 +522,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                 DEBUG("  %p is an exact match\n", (void *)tmp);
                 if (next_hop != NULL) {
                     /* sets next_hop if it was previously unspecified */
+                    _nib_nc_hash_remove(tmp_node);
                     memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                    _nib_nc_hash_add(tmp_node);
                 }
                 /*mark that this NCE is used by an offl_entry*/
                 tmp->next_hop->mode |= _DST;
@@ -528,6 +542,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _nib_lpm_add(dst);
     }
     return dst;
 }
@@ -566,6 +581,16 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
                 _nib_onl_clear(dst->next_hop);
             }
         }
+        if (_nib_lpm_remove(dst)) {
+            /* let the next entry with the same prefix take over */
+            for (_nib_offl_entry_t *ptr = _dsts; _in_dsts(ptr); ptr++) {
+                if ((dst != ptr) && (dst->pfx_len == ptr->pfx_len) &&
+                    ipv6_addr_equal(&dst->pfx, &ptr->pfx)) {
+                    _nib_lpm_add(ptr);
+                    break;
+                }
+            }
+        }
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
     else {
@@ -597,10 +622,17 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
     _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
 
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_LPM)
+    res = _nib_lpm_get(dst);
+    if (res != NULL) {
+        DEBUG("nib: best match %s/%u\n",
+              ipv6_addr_to_str(addr_str, &res->pfx, sizeof(addr_str)),
+              res->pfx_len);
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_LPM */
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -613,13 +645,16 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
                   ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
                                    sizeof(addr_str)),
                   _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
-                DEBUG("nib: best match (%u bits)\n", match);
+            /* bits after the prefix may match, too, so compare by prefix
+             * length */
+            if ((match >= entry->pfx_len) &&
+                ((res == NULL) || (entry->pfx_len > res->pfx_len))) {
+                DEBUG("nib: best match (%u bits)\n", entry->pfx_len);
                 res = entry;
-                best_match = match;
             }
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_LPM */
     return res;
 }
 
@@ -879,10 +914,12 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
     _nib_onl_clear(node);
+    _nib_nc_hash_remove(node);
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+    _nib_nc_hash_add(node);
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
@@ -899,17 +936,24 @@ static inline bool _node_unreachable(_nib_onl_entry_t *node)
 
 uint32_t _evtimer_lookup(const void *ctx, uint16_t type)
 {
-    evtimer_msg_event_t *event = (evtimer_msg_event_t *)_nib_evtimer.events;
+    evtimer_msg_event_t *event =
+        (evtimer_msg_event_t *)evtimer_first_event(&_nib_evtimer);
     uint32_t offset = 0;
 
     DEBUG("nib: lookup ctx = %p, type = %04x\n", (void *)ctx, type);
     while (event != NULL) {
-        offset += event->event.offset;
+        if (IS_USED(MODULE_EVTIMER_HEAP)) {
+            /* events hold their absolute time */
+            offset = event->event.offset - _nib_evtimer.base;
+        }
+        else {
+            offset += event->event.offset;
+        }
         if ((event->msg.type == type) &&
             ((ctx == NULL) || (event->msg.content.ptr == ctx))) {
             return offset;
         }
-        event = (evtimer_msg_event_t *)event->event.next;
+        event = (evtimer_msg_event_t *)evtimer_next_event(&event->event);
     }
     return UINT32_MAX;
 }
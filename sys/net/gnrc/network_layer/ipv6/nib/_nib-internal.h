@@ -43,6 +43,8 @@
 #include "random.h"
 #include "timex.h"
 
+#include "_nib-nc-hash.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -370,6 +372,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+        _nib_nc_hash_remove(node);
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
@@ -0,0 +1,188 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <kernel_defines.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "_nib-lpm.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_LPM)
+
+/**
+ * @brief   Trie node
+ */
+typedef struct _lpm_node {
+    struct _lpm_node *child[2];     /**< sub-tries by the bit after the prefix */
+    _nib_offl_entry_t *entry;       /**< entry for the prefix, NULL for nodes
+                                     *   only used for branching */
+    ipv6_addr_t pfx;                /**< prefix, all bits after _lpm_node::len
+                                     *   are 0 */
+    uint8_t len;                    /**< length of _lpm_node::pfx in bits */
+} _lpm_node_t;
+
+/* a trie with n leaves has at most n - 1 branching nodes */
+static _lpm_node_t _nodes[2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static _lpm_node_t *_root;
+/* free nodes, linked through child[0] */
+static _lpm_node_t *_free;
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned idx)
+{
+    return (addr->u8[idx >> 3] >> (7 - (idx & 0x7))) & 0x1;
+}
+
+static inline bool _matches(const _lpm_node_t *node, const ipv6_addr_t *addr)
+{
+    return ipv6_addr_match_prefix(&node->pfx, addr) >= node->len;
+}
+
+static _lpm_node_t *_node_alloc(const ipv6_addr_t *pfx, unsigned len)
+{
+    _lpm_node_t *node = _free;
+
+    /* pool is sized for the worst case */
+    assert(node != NULL);
+    _free = node->child[0];
+    memset(node, 0, sizeof(*node));
+    ipv6_addr_init_prefix(&node->pfx, pfx, len);
+    node->len = len;
+    return node;
+}
+
+static void _node_free(_lpm_node_t *node)
+{
+    node->entry = NULL;
+    node->child[0] = _free;
+    _free = node;
+}
+
+void _nib_lpm_init(void)
+{
+    _root = NULL;
+    _free = NULL;
+    for (unsigned i = 0; i < ARRAY_SIZE(_nodes); i++) {
+        _node_free(&_nodes[i]);
+    }
+}
+
+void _nib_lpm_add(_nib_offl_entry_t *entry)
+{
+    const ipv6_addr_t *pfx = &entry->pfx;
+    unsigned len = entry->pfx_len;
+    _lpm_node_t **link = &_root;
+
+    assert((len > 0) && (len <= IPV6_ADDR_BIT_LEN));
+    while (*link != NULL) {
+        _lpm_node_t *node = *link;
+        unsigned common = ipv6_addr_match_prefix(&node->pfx, pfx);
+
+        if (common > len) {
+            common = len;
+        }
+        if (common >= node->len) {
+            if (node->len == len) {
+                /* prefer the first entry in the off-link entry array */
+                if ((node->entry == NULL) || (entry < node->entry)) {
+                    node->entry = entry;
+                }
+                return;
+            }
+            link = &node->child[_bit(pfx, node->len)];
+            continue;
+        }
+        /* prefixes diverge within node's prefix => insert new node above */
+        _lpm_node_t *leaf = _node_alloc(pfx, len);
+
+        leaf->entry = entry;
+        if (common == len) {
+            /* new prefix is a prefix of node's prefix */
+            leaf->child[_bit(&node->pfx, len)] = node;
+            *link = leaf;
+        }
+        else {
+            _lpm_node_t *branch = _node_alloc(pfx, common);
+
+            branch->child[_bit(pfx, common)] = leaf;
+            branch->child[_bit(&node->pfx, common)] = node;
+            *link = branch;
+        }
+        DEBUG("nib: added %p to LPM index\n", (void *)entry);
+        return;
+    }
+    *link = _node_alloc(pfx, len);
+    (*link)->entry = entry;
+    DEBUG("nib: added %p to LPM index\n", (void *)entry);
+}
+
+bool _nib_lpm_remove(const _nib_offl_entry_t *entry)
+{
+    _lpm_node_t **parent_link = NULL;
+    _lpm_node_t **link = &_root;
+
+    while ((*link != NULL) && ((*link)->len < entry->pfx_len) &&
+           _matches(*link, &entry->pfx)) {
+        parent_link = link;
+        link = &(*link)->child[_bit(&entry->pfx, (*link)->len)];
+    }
+
+    _lpm_node_t *node = *link;
+
+    if ((node == NULL) || (node->entry != entry)) {
+        return false;
+    }
+    DEBUG("nib: removing %p from LPM index\n", (void *)entry);
+    node->entry = NULL;
+    if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        /* still needed for branching */
+        return true;
+    }
+    /* splice node out, at most one child remains */
+    *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    _node_free(node);
+    if ((*link == NULL) && (parent_link != NULL)) {
+        /* parent may now be a branching node with only one child */
+        _lpm_node_t *parent = *parent_link;
+
+        if (parent->entry == NULL) {
+            *parent_link = (parent->child[0] != NULL) ? parent->child[0]
+                                                      : parent->child[1];
+            _node_free(parent);
+        }
+    }
+    return true;
+}
+
+_nib_offl_entry_t *_nib_lpm_get(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+
+    for (const _lpm_node_t *node = _root; (node != NULL) && _matches(node, dst);
+         node = node->child[_bit(dst, node->len)]) {
+        if (node->entry != NULL) {
+            res = node->entry;
+        }
+        if (node->len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+    }
+    return res;
+}
+
+#else  /* CONFIG_GNRC_IPV6_NIB_OFFL_LPM */
+typedef int dont_be_pedantic;
+#endif /* CONFIG_GNRC_IPV6_NIB_OFFL_LPM */
+
+/** @} */
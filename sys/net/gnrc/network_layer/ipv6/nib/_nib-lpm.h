@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @brief
+ * @{
+ *
+ * @file
+ * @brief   Longest-prefix-match index for the off-link entries of the NIB
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_OFFL_LPM
+ * @internal
+ *
+ * The index is a path-compressed binary (PATRICIA) trie over the prefixes of
+ * the off-link entries. Every trie node stores a prefix; a node that is not
+ * only used for branching refers to the off-link entry with that prefix that
+ * comes first in the off-link entry array.
+ */
+
+#include <kernel_defines.h>
+#include <stdbool.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_LPM) || defined(DOXYGEN)
+/**
+ * @brief   Empties the index
+ */
+void _nib_lpm_init(void);
+
+/**
+ * @brief   Adds an off-link entry to the index
+ *
+ * If an entry with the same prefix is already in the index, @p entry only
+ * replaces it if it comes first in the off-link entry array.
+ *
+ * @pre `(entry != NULL) && (entry->pfx_len > 0)`
+ *
+ * @param[in] entry An off-link entry with _nib_offl_entry_t::pfx and
+ *                  _nib_offl_entry_t::pfx_len set.
+ */
+void _nib_lpm_add(_nib_offl_entry_t *entry);
+
+/**
+ * @brief   Removes an off-link entry from the index
+ *
+ * @param[in] entry An off-link entry.
+ *
+ * @return  true, if @p entry was the entry referred to for its prefix. Other
+ *          entries with the same prefix must then be re-added using
+ *          @ref _nib_lpm_add().
+ * @return  false, if @p entry was not in the index.
+ */
+bool _nib_lpm_remove(const _nib_offl_entry_t *entry);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The off-link entry with the longest prefix matching @p dst.
+ * @return  NULL, if no prefix in the index matches @p dst.
+ */
+_nib_offl_entry_t *_nib_lpm_get(const ipv6_addr_t *dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_LPM */
+#define _nib_lpm_init()             (void)0
+#define _nib_lpm_add(entry)         (void)entry
+#define _nib_lpm_remove(entry)      ((void)entry, false)
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_LPM */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
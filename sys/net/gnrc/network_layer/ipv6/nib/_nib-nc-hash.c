@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <kernel_defines.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "_nib-internal.h"
+#include "_nib-nc-hash.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+
+/* keep the load factor at 50% at most so probe sequences stay short */
+#define _SLOTS  (2 * CONFIG_GNRC_IPV6_NIB_NUMOF)
+
+static _nib_onl_entry_t *_slots[_SLOTS];
+
+static unsigned _home(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* Fibonacci hashing, then map to [0, _SLOTS) without a division */
+    hash *= 0x9e3779b1;
+    return ((uint64_t)hash * _SLOTS) >> 32;
+}
+
+static inline unsigned _next(unsigned slot)
+{
+    return (slot + 1 < _SLOTS) ? (slot + 1) : 0;
+}
+
+void _nib_nc_hash_init(void)
+{
+    memset(_slots, 0, sizeof(_slots));
+}
+
+void _nib_nc_hash_add(_nib_onl_entry_t *node)
+{
+    unsigned slot = _home(&node->ipv6);
+
+    /* there are more slots than nodes, so there is always a free one */
+    while (_slots[slot] != NULL) {
+        assert(_slots[slot] != node);
+        slot = _next(slot);
+    }
+    _slots[slot] = node;
+}
+
+void _nib_nc_hash_remove(const _nib_onl_entry_t *node)
+{
+    unsigned slot = _home(&node->ipv6);
+
+    while (_slots[slot] != node) {
+        if (_slots[slot] == NULL) {
+            /* not in the index */
+            return;
+        }
+        slot = _next(slot);
+    }
+    /* backward-shift deletion: move up later entries of the probe sequence
+     * so no lookup stops early at the freed slot */
+    unsigned hole = slot;
+
+    _slots[hole] = NULL;
+    for (slot = _next(hole); _slots[slot] != NULL; slot = _next(slot)) {
+        unsigned home = _home(&_slots[slot]->ipv6);
+
+        /* move the entry if its home is not cyclically in (hole, slot] */
+        if ((hole <= slot) ? ((home <= hole) || (home > slot))
+                           : ((home <= hole) && (home > slot))) {
+            _slots[hole] = _slots[slot];
+            _slots[slot] = NULL;
+            hole = slot;
+        }
+    }
+}
+
+_nib_onl_entry_t *_nib_nc_hash_get(const ipv6_addr_t *addr, unsigned iface)
+{
+    _nib_onl_entry_t *res = NULL;
+
+    for (unsigned slot = _home(addr); _slots[slot] != NULL;
+         slot = _next(slot)) {
+        _nib_onl_entry_t *node = _slots[slot];
+
+        if ((node->mode != _EMPTY) &&
+            /* either requested or current interface undefined or
+             * interfaces equal */
+            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+             (_nib_onl_get_if(node) == iface)) &&
+            ipv6_addr_equal(&node->ipv6, addr) &&
+            /* same result as the linear scan for duplicate addresses */
+            ((res == NULL) || (node < res))) {
+            res = node;
+        }
+    }
+    return res;
+}
+
+#else  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+typedef int dont_be_pedantic;
+#endif /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
+/** @} */
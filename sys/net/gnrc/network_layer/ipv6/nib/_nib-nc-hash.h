@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @brief
+ * @{
+ *
+ * @file
+ * @brief   Hash index for the on-link entries of the NIB
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_NC_HASH
+ * @internal
+ *
+ * The index is an open-addressing hash table with linear probing over the
+ * IPv6 addresses of the on-link entries. The interface is not part of the
+ * key, so lookups for any interface (`iface == 0`) stay possible.
+ */
+
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* forward declaration to avoid cyclic include with _nib-internal.h */
+struct _nib_onl_entry;
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Empties the index
+ */
+void _nib_nc_hash_init(void);
+
+/**
+ * @brief   Adds an on-link entry to the index by its current address
+ *
+ * @pre     @p node is not in the index.
+ *
+ * @param[in] node  An on-link entry.
+ */
+void _nib_nc_hash_add(struct _nib_onl_entry *node);
+
+/**
+ * @brief   Removes an on-link entry from the index
+ *
+ * Must be called before the address of @p node changes.
+ *
+ * @param[in] node  An on-link entry. May not be in the index.
+ */
+void _nib_nc_hash_remove(const struct _nib_onl_entry *node);
+
+/**
+ * @brief   Gets a node by IPv6 address and interface from the index
+ *
+ * Same semantics as @ref _nib_onl_get().
+ *
+ * @param[in] addr  The address of a node. Must not be NULL.
+ * @param[in] iface The interface to the node. May be 0 for any interface.
+ *
+ * @return  The NIB entry for node with @p addr and @p iface on success.
+ * @return  NULL, if there is no such entry.
+ */
+struct _nib_onl_entry *_nib_nc_hash_get(const ipv6_addr_t *addr,
+                                        unsigned iface);
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+#define _nib_nc_hash_init()         (void)0
+#define _nib_nc_hash_add(node)      (void)node
+#define _nib_nc_hash_remove(node)   (void)node
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -120,12 +120,10 @@ static inline bool _should_search_rtr(const gnrc_netif_t *netif)
 
 void gnrc_ipv6_nib_init(void)
 {
-    evtimer_event_t *tmp;
+    evtimer_event_t *ptr;
 
     _nib_acquire();
-    for (evtimer_event_t *ptr = _nib_evtimer.events;
-         (ptr != NULL) && (tmp = (ptr->next), 1);
-         ptr = tmp) {
+    while ((ptr = evtimer_first_event(&_nib_evtimer))) {
         evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
     }
     _nib_init();
@@ -17,6 +17,7 @@
 #include <inttypes.h>
 #include <stdbool.h>
 
+#include "container.h"
 #include "net/ieee802154.h"
 #include "net/ipv6.h"
 #include "net/ipv6/hdr.h"
@@ -39,6 +40,7 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
 /* estimated fragment payload size to determinate RBUF_INT_SIZE, default to
  * MAC payload size - fragment header. */
 #ifndef GNRC_SIXLOWPAN_FRAG_SIZE
@@ -60,6 +62,11 @@
 #endif
 
 static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
+#else   /* !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
+/* granularity of gnrc_sixlowpan_frag_rb_base_t::covered, fragment offsets are
+ * multiples of 8 */
+#define RBUF_BLOCK_SIZE     (8U)
+#endif  /* !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
@@ -68,14 +75,31 @@ static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 static xtimer_t _gc_timer;
 static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_FRAG_RB_GC_MSG };
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+/* entries in use, indexed by (src, dst, tag) */
+static gnrc_sixlowpan_frag_rb_base_t *_buckets[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE];
+/* entries in use from the most recently used at _lru.lru_next to the least
+ * recently used at _lru.lru_prev, i.e. ordered by arrival */
+static gnrc_sixlowpan_frag_rb_base_t _lru = {
+    .lru_prev = &_lru,
+    .lru_next = &_lru,
+};
+/* removed entries, linked by hash_next */
+static gnrc_sixlowpan_frag_rb_base_t *_free;
+/* entries from rbuf[_fresh] on were never used */
+static unsigned _fresh;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
+#if !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
 /* checks whether start and end overlaps, but not identical to, given interval i */
 static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
                                                uint16_t start, uint16_t end);
 /* gets a free entry from interval buffer */
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void);
+#endif  /* !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
 /* update interval buffer of entry */
 static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
                               uint16_t offset, size_t frag_size);
@@ -110,6 +134,164 @@ static int _forward_uncomp(gnrc_pktsnip_t *pkt,
                            unsigned page);
 static int _rbuf_resize_for_reassembly(gnrc_sixlowpan_frag_rb_t *rbuf);
 
+static inline bool _rbuf_match(const gnrc_sixlowpan_frag_rb_t *e,
+                               const void *src, size_t src_len,
+                               const void *dst, size_t dst_len,
+                               uint16_t tag)
+{
+    return (e->pkt != NULL) && (e->super.tag == tag) &&
+           (e->super.src_len == src_len) &&
+           (e->super.dst_len == dst_len) &&
+           (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
+static inline bool _rbuf_match_size(const gnrc_sixlowpan_frag_rb_t *e,
+                                    size_t size)
+{
+    return (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
+            /* not all SFR fragments carry the datagram size, so make 0 a
+             * legal value to not compare datagram size */
+            ((size == 0) || (e->super.datagram_size == size))) ||
+           (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
+            (e->super.datagram_size == size));
+}
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+static inline gnrc_sixlowpan_frag_rb_t *_entry(gnrc_sixlowpan_frag_rb_base_t *base)
+{
+    return container_of(base, gnrc_sixlowpan_frag_rb_t, super);
+}
+
+static gnrc_sixlowpan_frag_rb_base_t **_bucket(const void *src, size_t src_len,
+                                               const void *dst, size_t dst_len,
+                                               uint16_t tag)
+{
+    return &_buckets[gnrc_sixlowpan_frag_rb_base_hash(src, src_len,
+                                                      dst, dst_len, tag) %
+                     CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE];
+}
+
+static void _lru_unlink(gnrc_sixlowpan_frag_rb_base_t *base)
+{
+    base->lru_prev->lru_next = base->lru_next;
+    base->lru_next->lru_prev = base->lru_prev;
+    base->lru_prev = NULL;
+    base->lru_next = NULL;
+}
+
+static void _lru_insert_after(gnrc_sixlowpan_frag_rb_base_t *pos,
+                              gnrc_sixlowpan_frag_rb_base_t *base)
+{
+    base->lru_prev = pos;
+    base->lru_next = pos->lru_next;
+    pos->lru_next->lru_prev = base;
+    pos->lru_next = base;
+}
+
+/* returns an entry not in use without taking it, NULL if all are in use */
+static gnrc_sixlowpan_frag_rb_t *_index_free(void)
+{
+    if (_free != NULL) {
+        return _entry(_free);
+    }
+    if (_fresh < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE) {
+        return &rbuf[_fresh];
+    }
+    return NULL;
+}
+
+static gnrc_sixlowpan_frag_rb_t *_index_oldest(void)
+{
+    assert(_lru.lru_prev != &_lru);
+    return _entry(_lru.lru_prev);
+}
+
+/* takes the entry returned by _index_free() and indexes it */
+static void _index_add(gnrc_sixlowpan_frag_rb_t *e)
+{
+    if (&e->super == _free) {
+        _free = _free->hash_next;
+    }
+    else {
+        assert(e == &rbuf[_fresh]);
+        _fresh++;
+    }
+    gnrc_sixlowpan_frag_rb_base_link(_bucket(e->super.src, e->super.src_len,
+                                             e->super.dst, e->super.dst_len,
+                                             e->super.tag),
+                                     &e->super);
+    _lru_insert_after(&_lru, &e->super);
+}
+
+static void _index_touch(gnrc_sixlowpan_frag_rb_t *e)
+{
+    _lru_unlink(&e->super);
+    _lru_insert_after(&_lru, &e->super);
+}
+
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0U
+/* moves an entry with an arrival time in the past to its place in the LRU */
+static void _index_age(gnrc_sixlowpan_frag_rb_t *e)
+{
+    gnrc_sixlowpan_frag_rb_base_t *pos;
+
+    _lru_unlink(&e->super);
+    pos = _lru.lru_prev;
+    while ((pos != &_lru) &&
+           ((int32_t)(pos->arrival - e->super.arrival) <= 0)) {
+        pos = pos->lru_prev;
+    }
+    _lru_insert_after(pos, &e->super);
+}
+#endif
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+static inline void _index_add(gnrc_sixlowpan_frag_rb_t *e)
+{
+    (void)e;
+}
+
+static inline void _index_touch(gnrc_sixlowpan_frag_rb_t *e)
+{
+    (void)e;
+}
+
+static inline void _index_age(gnrc_sixlowpan_frag_rb_t *e)
+{
+    (void)e;
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
+                            size_t frag_size, size_t offset)
+{
+    unsigned first = offset / RBUF_BLOCK_SIZE;
+    unsigned last = (offset + frag_size - 1) / RBUF_BLOCK_SIZE;
+    unsigned covered = 0;
+
+    if ((offset + frag_size) > entry->datagram_size) {
+        /* also keeps fragments for the virtual reassembly buffer within
+         * entry->covered */
+        DEBUG("6lo rbuf: fragment exceeds datagram\n");
+        return RBUF_ADD_REPEAT;
+    }
+    for (unsigned i = first; i <= last; i++) {
+        covered += bf_isset(entry->covered, i);
+    }
+    if (covered == 0) {
+        return RBUF_ADD_SUCCESS;
+    }
+    /* Without the fragment limits, a fragment within the already received
+     * blocks is taken as a duplicate. Any other overlap discards the datagram
+     * https://tools.ietf.org/html/rfc4944#section-5.3 */
+    if (covered == (last - first + 1)) {
+        DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
+        return RBUF_ADD_DUPLICATE;
+    }
+    return RBUF_ADD_REPEAT;
+}
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
 static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
                             size_t frag_size, size_t offset)
 {
@@ -135,6 +317,7 @@ static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
     }
     return RBUF_ADD_SUCCESS;
 }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
 
 gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_add(gnrc_netif_hdr_t *netif_hdr,
                                                      gnrc_pktsnip_t *pkt,
@@ -189,14 +372,17 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    for (gnrc_sixlowpan_frag_rb_base_t *base = *_bucket(src, src_len,
+                                                         dst, dst_len, tag);
+         base != NULL; base = base->hash_next) {
+        gnrc_sixlowpan_frag_rb_t *e = _entry(base);
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
+        if (_rbuf_match(e, src, src_len, dst, dst_len, tag)) {
             return e;
         }
     }
@@ -504,6 +690,35 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     return res;
 }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+#ifdef TEST_SUITES
+bool gnrc_sixlowpan_frag_rb_ints_empty(void)
+{
+    return true;
+}
+#endif  /* TEST_SUITES */
+
+static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
+                              uint16_t offset, size_t frag_size)
+{
+    unsigned last = (offset + frag_size - 1) / RBUF_BLOCK_SIZE;
+
+    /* checked by _check_fragments() */
+    assert((offset + frag_size) <= entry->datagram_size);
+    for (unsigned i = offset / RBUF_BLOCK_SIZE; i <= last; i++) {
+        bf_set(entry->covered, i);
+    }
+    entry->frags++;
+    DEBUG("6lo rfrag: add blocks (%u, %u) to entry (%s, ",
+          offset / RBUF_BLOCK_SIZE, last,
+          gnrc_netif_addr_to_str(entry->src, entry->src_len, l2addr_str));
+    DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->dst,
+                                                  entry->dst_len,
+                                                  l2addr_str),
+          entry->datagram_size, entry->tag);
+    return true;
+}
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
 static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
                                                uint16_t start, uint16_t end)
 {
@@ -564,6 +779,7 @@ static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
 
     return true;
 }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
 
 static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
 {
@@ -577,30 +793,41 @@ static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
     gnrc_pktbuf_release(rbuf->pkt);
 }
 
+static void _gc_entry(gnrc_sixlowpan_frag_rb_t *rbuf)
+{
+    DEBUG("6lo rfrag: entry (%s, ",
+          gnrc_netif_addr_to_str(rbuf->super.src, rbuf->super.src_len,
+                                 l2addr_str));
+    DEBUG("%s, %u, %u) timed out\n",
+          gnrc_netif_addr_to_str(rbuf->super.dst, rbuf->super.dst_len,
+                                 l2addr_str),
+          (unsigned)rbuf->super.datagram_size, rbuf->super.tag);
+
+    _gc_pkt(rbuf);
+    gnrc_sixlowpan_frag_rb_remove(rbuf);
+}
+
 void gnrc_sixlowpan_frag_rb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
-    unsigned int i;
 
-    for (i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    /* the LRU is ordered by arrival, so stop at the first entry not timed out */
+    while ((_lru.lru_prev != &_lru) &&
+           ((now_usec - _lru.lru_prev->arrival) >
+            CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
+        _gc_entry(_index_oldest());
+    }
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* since pkt occupies pktbuf, aggressively collect garbage */
         if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i]) &&
               ((now_usec - rbuf[i].super.arrival) >
                CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
-            DEBUG("6lo rfrag: entry (%s, ",
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) timed out\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
-
-            _gc_pkt(&rbuf[i]);
-            gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
+            _gc_entry(&rbuf[i]);
         }
     }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     gnrc_sixlowpan_frag_vrb_gc();
 #endif
@@ -612,6 +839,29 @@ static inline void _set_rbuf_timeout(void)
                    &_gc_timer_msg, thread_getpid());
 }
 
+static int _rbuf_found(gnrc_sixlowpan_frag_rb_t *e, uint32_t now_usec)
+{
+    DEBUG("6lo rfrag: entry %p (%s, ", (void *)e,
+          gnrc_netif_addr_to_str(e->super.src, e->super.src_len,
+                                 l2addr_str));
+    DEBUG("%s, %u, %u) found\n",
+          gnrc_netif_addr_to_str(e->super.dst, e->super.dst_len,
+                                 l2addr_str),
+          (unsigned)e->super.datagram_size, e->super.tag);
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
+    if (e->super.current_size == 0) {
+        /* ensure that only empty reassembly buffer entries and entries
+         * scheduled for deletion have `current_size == 0` */
+        DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+        return -1;
+    }
+#endif
+    e->super.arrival = now_usec;
+    _index_touch(e);
+    _set_rbuf_timeout();
+    return e - &(rbuf[0]);
+}
+
 static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
@@ -620,39 +870,32 @@ static int _rbuf_get(const void *src, size_t src_len,
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+    if (size > CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MAX_DATAGRAM_SIZE) {
+        DEBUG("6lo rfrag: datagram too big for reassembly\n");
+        return -1;
+    }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    for (gnrc_sixlowpan_frag_rb_base_t *base = *_bucket(src, src_len,
+                                                         dst, dst_len, tag);
+         base != NULL; base = base->hash_next) {
+        gnrc_sixlowpan_frag_rb_t *e = _entry(base);
+
+        if (_rbuf_match(e, src, src_len, dst, dst_len, tag) &&
+            _rbuf_match_size(e, size)) {
+            return _rbuf_found(e, now_usec);
+        }
+    }
+    if ((res = _index_free()) == NULL) {
+        oldest = _index_oldest();
+    }
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
-#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (_rbuf_match(&rbuf[i], src, src_len, dst, dst_len, tag) &&
+            _rbuf_match_size(&rbuf[i], size)) {
+            return _rbuf_found(&rbuf[i], now_usec);
         }
 
         /* if there is a free spot: remember it */
@@ -667,6 +910,7 @@ static int _rbuf_get(const void *src, size_t src_len,
             oldest = &(rbuf[i]);
         }
     }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
 
     /* entry not in buffer and no empty spot found */
     if (res == NULL) {
@@ -681,6 +925,10 @@ static int _rbuf_get(const void *src, size_t src_len,
             gnrc_pktbuf_release(oldest->pkt);
             gnrc_sixlowpan_frag_rb_remove(oldest);
             res = oldest;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+            /* removing oldest made it the next free entry */
+            assert(_index_free() == oldest);
+#endif
 #if !IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DO_NOT_OVERRIDE) && \
     IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
             gnrc_sixlowpan_frag_stats_get()->rbuf_full++;
@@ -746,6 +994,7 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+    _index_add(res);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -764,7 +1013,9 @@ static int _rbuf_get(const void *src, size_t src_len,
 void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
+#if !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
     memset(rbuf_int, 0, sizeof(rbuf_int));
+#endif  /* !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -772,6 +1023,13 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    memset(_buckets, 0, sizeof(_buckets));
+    _lru.lru_prev = &_lru;
+    _lru.lru_next = &_lru;
+    _free = NULL;
+    _fresh = 0;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -782,6 +1040,10 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+    memset(entry->covered, 0, sizeof(entry->covered));
+    entry->frags = 0;
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
     while (entry->ints != NULL) {
         gnrc_sixlowpan_frag_rb_int_t *next = entry->ints->next;
 
@@ -790,8 +1052,57 @@ void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
         entry->ints->next = NULL;
         entry->ints = next;
     }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
     entry->datagram_size = 0;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    if (entry->hash_pprev != NULL) {
+        *entry->hash_pprev = entry->hash_next;
+        if (entry->hash_next != NULL) {
+            entry->hash_next->hash_pprev = entry->hash_pprev;
+        }
+        entry->hash_pprev = NULL;
+    }
+    /* only entries of the reassembly buffer are in the LRU, so this is not
+     * done for entries of the virtual reassembly buffer */
+    if (entry->lru_next != NULL) {
+        _lru_unlink(entry);
+        entry->hash_next = _free;
+        _free = entry;
+    }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+}
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+uint32_t gnrc_sixlowpan_frag_rb_base_hash(const uint8_t *src, size_t src_len,
+                                          const uint8_t *dst, size_t dst_len,
+                                          uint16_t tag)
+{
+    /* FNV-1a */
+    uint32_t hash = 2166136261U;
+
+    for (size_t i = 0; i < src_len; i++) {
+        hash = (hash ^ src[i]) * 16777619U;
+    }
+    for (size_t i = 0; i < dst_len; i++) {
+        hash = (hash ^ dst[i]) * 16777619U;
+    }
+    hash = (hash ^ (tag & 0xff)) * 16777619U;
+    hash = (hash ^ (tag >> 8)) * 16777619U;
+    return hash;
+}
+
+void gnrc_sixlowpan_frag_rb_base_link(gnrc_sixlowpan_frag_rb_base_t **bucket,
+                                      gnrc_sixlowpan_frag_rb_base_t *entry)
+{
+    assert(entry->hash_pprev == NULL);
+    entry->hash_next = *bucket;
+    if (*bucket != NULL) {
+        (*bucket)->hash_pprev = &entry->hash_next;
+    }
+    entry->hash_pprev = bucket;
+    *bucket = entry;
 }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
 
 static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 {
@@ -804,6 +1115,7 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
         rbuf->super.arrival = xtimer_now_usec() -
                               (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US -
                                CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER);
+        _index_age(rbuf);
         /* reset current size to prevent late duplicates to trigger another
          * dispatch */
         rbuf->super.current_size = 0;
@@ -815,6 +1127,9 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
 static inline unsigned _count_frags(gnrc_sixlowpan_frag_rb_t *rbuf)
 {
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+    return rbuf->super.frags;
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
     unsigned frags = 0;
     gnrc_sixlowpan_frag_rb_int_t *frag = rbuf->super.ints;
 
@@ -823,6 +1138,7 @@ static inline unsigned _count_frags(gnrc_sixlowpan_frag_rb_t *rbuf)
         frags++;
     }
     return frags;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
 }
 #endif
 
@@ -939,9 +1255,11 @@ static int _forward_uncomp(gnrc_pktsnip_t *pkt,
     int res = _forward_frag(pkt, sizeof(sixlowpan_frag_t),
                             vrbe, page);
 
+#if !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
     /* prevent intervals from being deleted (they are in the
      * VRB now) */
     rbuf->super.ints = NULL;
+#endif  /* !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
     gnrc_pktbuf_release(rbuf->pkt);
     gnrc_sixlowpan_frag_rb_remove(rbuf);
     return (res == 0) ? RBUF_ADD_SUCCESS : RBUF_ADD_ERROR;
@@ -1722,13 +1722,13 @@ static void _sched_next_frame(gnrc_sixlowpan_frag_fb_t *fbuf)
 
 static inline bool _arq_scheduled(gnrc_sixlowpan_frag_fb_t *fbuf)
 {
-    evtimer_event_t *ptr = _arq_timer.events;
+    evtimer_event_t *ptr = evtimer_first_event(&_arq_timer);
     evtimer_event_t *event = &fbuf->sfr.arq_timeout_event.event;
     while (ptr) {
         if (ptr == event) {
             return true;
         }
-        ptr = ptr->next;
+        ptr = evtimer_next_event(ptr);
     }
     return false;
 }
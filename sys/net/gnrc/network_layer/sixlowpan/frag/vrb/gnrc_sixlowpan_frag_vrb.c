@@ -31,6 +31,10 @@
 #include "debug.h"
 
 static gnrc_sixlowpan_frag_vrb_t _vrb[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+/* entries in use, indexed by (src, tag) */
+static gnrc_sixlowpan_frag_rb_base_t *_buckets[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE];
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
 #ifdef MODULE_GNRC_IPV6_NIB
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #else   /* MODULE_GNRC_IPV6_NIB */
@@ -46,6 +50,49 @@ static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
             (memcmp(vrbe->super.src, src, src_len) == 0));
 }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+static gnrc_sixlowpan_frag_rb_base_t **_bucket(const uint8_t *src,
+                                               size_t src_len, unsigned tag)
+{
+    return &_buckets[gnrc_sixlowpan_frag_rb_base_hash(src, src_len, NULL, 0,
+                                                      tag) %
+                     CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE];
+}
+
+static gnrc_sixlowpan_frag_vrb_t *_index_get(const uint8_t *src,
+                                             size_t src_len, unsigned tag)
+{
+    for (gnrc_sixlowpan_frag_rb_base_t *base = *_bucket(src, src_len, tag);
+         base != NULL; base = base->hash_next) {
+        gnrc_sixlowpan_frag_vrb_t *vrbe = container_of(base,
+                                                       gnrc_sixlowpan_frag_vrb_t,
+                                                       super);
+
+        if (_equal_index(vrbe, src, src_len, tag)) {
+            return vrbe;
+        }
+    }
+    return NULL;
+}
+
+static void _index_add(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    /* the links were copied from the reassembly buffer entry */
+    vrbe->super.hash_pprev = NULL;
+    vrbe->super.lru_prev = NULL;
+    vrbe->super.lru_next = NULL;
+    gnrc_sixlowpan_frag_rb_base_link(_bucket(vrbe->super.src,
+                                             vrbe->super.src_len,
+                                             vrbe->super.tag),
+                                     &vrbe->super);
+}
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+static inline void _index_add(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    (void)vrbe;
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
         const gnrc_sixlowpan_frag_rb_base_t *base,
         gnrc_netif_t *out_netif, const uint8_t *out_dst, size_t out_dst_len)
@@ -69,6 +116,7 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
                 memcpy(vrbe->super.dst, out_dst, out_dst_len);
                 vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
                 vrbe->super.dst_len = out_dst_len;
+                _index_add(vrbe);
                 DEBUG("6lo vrb: creating entry (%s, ",
                       gnrc_netif_addr_to_str(vrbe->super.src,
                                              vrbe->super.src_len,
@@ -83,6 +131,15 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
                                              vrbe->super.dst_len,
                                              addr_str), vrbe->out_tag);
             }
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+            /* _equal_index() => merge received blocks and fragment count of
+             * `base`, so they don't get lost */
+            else {
+                bf_or(vrbe->super.covered, vrbe->super.covered, base->covered,
+                      sizeof(base->covered) * 8);
+                vrbe->super.frags += base->frags;
+            }
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
             /* _equal_index() => append intervals of `base`, so they don't get
              * lost. We use append, so we don't need to change base! */
             else if (base->ints != NULL) {
@@ -109,6 +166,7 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
                     }
                 }
             }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
             break;
         }
     }
@@ -170,6 +228,16 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
     DEBUG("6lo vrb: trying to get entry for (%s, %u)\n",
           gnrc_netif_addr_to_str(src, src_len, addr_str), src_tag);
     assert(src_len != 0);
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _index_get(src, src_len, src_tag);
+
+    if (vrbe != NULL) {
+        DEBUG("6lo vrb: got VRB to (%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst, vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+        return vrbe;
+    }
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
         gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
 
@@ -181,6 +249,7 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
             return vrbe;
         }
     }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
     DEBUG("6lo vrb: no entry found\n");
     return NULL;
 }
@@ -234,6 +303,9 @@ void gnrc_sixlowpan_frag_vrb_gc(void)
 void gnrc_sixlowpan_frag_vrb_reset(void)
 {
     memset(_vrb, 0, sizeof(_vrb));
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    memset(_buckets, 0, sizeof(_buckets));
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
 }
 #endif
 
@@ -14,8 +14,10 @@
 
 #include <assert.h>
 
+#include "kernel_defines.h"
 #include "sched.h"
 #include "net/gnrc.h"
+#include "net/gnrc/netapi/batch.h"
 #include "thread.h"
 #include "utlist.h"
 
@@ -29,21 +31,46 @@
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/netif.h"
 #include "net/sixlowpan.h"
+#ifdef MODULE_GNRC_SINGLE_THREAD
+#include "net/gnrc/single_thread.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt);
+static bool _handle_msg(msg_t *msg, msg_t *reply);
+
+/* 6LoWPAN as a layer of the stack thread */
+static gnrc_single_thread_layer_t _layer = {
+    .netapi_cb = _netapi_cb,
+    .msg_handler = _handle_msg,
+};
+static gnrc_netreg_entry_t _reg;
+#else
 static char _stack[GNRC_SIXLOWPAN_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 static msg_t _msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
+#endif
 
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+/* collects the packets passed up while a batch is handled, NULL otherwise */
+static gnrc_netapi_batch_t *_rx_batch;
+#endif
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) && !IS_USED(MODULE_GNRC_SINGLE_THREAD)
+/* handles GNRC_NETAPI_MSG_TYPE_RCV_BATCH commands */
+static void _receive_batch(gnrc_pktsnip_t *batch);
+#endif
 /* handles GNRC_NETAPI_MSG_TYPE_SND commands */
 static void _send(gnrc_pktsnip_t *pkt);
+#if !IS_USED(MODULE_GNRC_SINGLE_THREAD)
 /* Main event loop for 6LoWPAN */
 static void *_event_loop(void *args);
+#endif
 
 kernel_pid_t gnrc_sixlowpan_init(void)
 {
@@ -51,8 +78,19 @@ kernel_pid_t gnrc_sixlowpan_init(void)
         return _pid;
     }
 
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+    /* run 6LoWPAN in the stack thread */
+    _pid = gnrc_single_thread_init();
+    gnrc_single_thread_add(&_layer);
+    gnrc_single_thread_entry_init(&_reg, GNRC_NETREG_DEMUX_CTX_ALL, &_layer);
+    gnrc_netreg_register(GNRC_NETTYPE_SIXLOWPAN, &_reg);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    gnrc_sixlowpan_frag_sfr_init();
+#endif
+#else
     _pid = thread_create(_stack, sizeof(_stack), GNRC_SIXLOWPAN_PRIO,
                          0, _event_loop, NULL, "6lo");
+#endif
 
     return _pid;
 }
@@ -81,6 +119,14 @@ void gnrc_sixlowpan_dispatch_recv(gnrc_pktsnip_t *pkt, void *context,
     /* just assume normal IPv6 traffic */
     type = GNRC_NETTYPE_IPV6;
 #endif  /* MODULE_GNRC_IPV6 */
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    /* only the 6LoWPAN thread itself handles batches */
+    if ((_rx_batch != NULL) && (thread_getpid() == _pid)) {
+        gnrc_netapi_batch_receive(_rx_batch, type, GNRC_NETREG_DEMUX_CTX_ALL,
+                                  pkt);
+        return;
+    }
+#endif
     if (!gnrc_netapi_dispatch_receive(type,
                                       GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
         DEBUG("6lo: No receivers for this packet found\n");
@@ -166,6 +212,23 @@ void gnrc_sixlowpan_multiplex_by_size(gnrc_pktsnip_t *pkt,
     }
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) && !IS_USED(MODULE_GNRC_SINGLE_THREAD)
+static void _receive_batch(gnrc_pktsnip_t *batch)
+{
+    gnrc_netapi_batch_t up;
+
+    /* pass the decompressed and reassembled datagrams up in batches */
+    gnrc_netapi_batch_init(&up);
+    _rx_batch = &up;
+    for (unsigned i = 0; i < gnrc_netapi_batch_numof(batch); i++) {
+        _receive(gnrc_netapi_batch_get(batch, i));
+    }
+    _rx_batch = NULL;
+    gnrc_netapi_batch_flush(&up);
+    gnrc_pktbuf_release(batch);
+}
+#endif
+
 static void _receive(gnrc_pktsnip_t *pkt)
 {
     gnrc_pktsnip_t *payload;
@@ -383,6 +446,57 @@ static void _continue_fragmenting(gnrc_sixlowpan_frag_fb_t *fbuf)
 }
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_FB */
 
+/* handles messages other than netapi commands */
+static bool _handle_msg(msg_t *msg, msg_t *reply)
+{
+    (void)reply;
+    switch (msg->type) {
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_FB
+        case GNRC_SIXLOWPAN_FRAG_FB_SND_MSG:
+            DEBUG("6lo: send fragmented event received\n");
+            _continue_fragmenting(msg->content.ptr);
+            break;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_FB */
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RB
+        case GNRC_SIXLOWPAN_FRAG_RB_GC_MSG:
+            DEBUG("6lo: garbage collect reassembly buffer event received\n");
+            gnrc_sixlowpan_frag_rb_gc();
+            break;
+#endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+        case GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG:
+            DEBUG("6lo sfr: ARQ timeout received\n");
+            gnrc_sixlowpan_frag_sfr_arq_timeout(msg->content.ptr);
+            break;
+        case GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAG_GAP_MSG:
+            DEBUG("6lo sfr: sending next scheduled frame\n");
+            gnrc_sixlowpan_frag_sfr_inter_frame_gap(msg->content.ptr);
+            break;
+#endif
+
+        default:
+            return false;
+    }
+    return true;
+}
+
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt)
+{
+    switch (cmd) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
+            _receive(pkt);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
+            _send(pkt);
+            break;
+        default:
+            break;
+    }
+}
+#else
 static void *_event_loop(void *args)
 {
     msg_t msg, reply;
@@ -393,6 +507,9 @@ static void *_event_loop(void *args)
     msg_init_queue(_msg_q, GNRC_SIXLOWPAN_MSG_QUEUE_SIZE);
 
     /* register interest in all 6LoWPAN packets */
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    me_reg.batch = true;
+#endif
     gnrc_netreg_register(GNRC_NETTYPE_SIXLOWPAN, &me_reg);
 
     /* preinitialize ACK */
@@ -413,6 +530,13 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("6lo: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                _receive_batch(msg.content.ptr);
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr);
@@ -424,36 +548,16 @@ static void *_event_loop(void *args)
                 reply.content.value = -ENOTSUP;
                 msg_reply(&msg, &reply);
                 break;
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_FB
-            case GNRC_SIXLOWPAN_FRAG_FB_SND_MSG:
-                DEBUG("6lo: send fragmented event received\n");
-                _continue_fragmenting(msg.content.ptr);
-                break;
-#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_FB */
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RB
-            case GNRC_SIXLOWPAN_FRAG_RB_GC_MSG:
-                DEBUG("6lo: garbage collect reassembly buffer event received\n");
-                gnrc_sixlowpan_frag_rb_gc();
-                break;
-#endif
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
-            case GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG:
-                DEBUG("6lo sfr: ARQ timeout received\n");
-                gnrc_sixlowpan_frag_sfr_arq_timeout(msg.content.ptr);
-                break;
-            case GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAG_GAP_MSG:
-                DEBUG("6lo sfr: sending next scheduled frame\n");
-                gnrc_sixlowpan_frag_sfr_inter_frame_gap(msg.content.ptr);
-                break;
-#endif
-
             default:
-                DEBUG("6lo: operation not supported\n");
+                if (!_handle_msg(&msg, &reply)) {
+                    DEBUG("6lo: operation not supported\n");
+                }
                 break;
         }
     }
 
     return NULL;
 }
+#endif  /* IS_USED(MODULE_GNRC_SINGLE_THREAD) */
 
 /** @} */
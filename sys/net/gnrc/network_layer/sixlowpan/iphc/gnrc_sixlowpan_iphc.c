@@ -945,8 +945,10 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
                 if ((res = _forward_frag(ipv6, sixlo->next, vrbe, page)) == 0) {
                     DEBUG("6lo iphc: successfully recompressed and forwarded "
                           "1st fragment\n");
+#if !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
                     /* empty list, as it should be in VRB now */
                     rbuf->super.ints = NULL;
+#endif  /* !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
                 }
             }
             if ((ipv6 == NULL) || (res < 0)) {
@@ -1073,6 +1075,204 @@ static inline bool _compressible_nh(uint8_t nh)
     }
 }
 
+static uint16_t _iphc_tf_nh_hl_encode(const ipv6_hdr_t *ipv6_hdr,
+                                      uint8_t *iphc_hdr, uint16_t inline_pos)
+{
+    /* compress flow label and traffic class */
+    if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
+        if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
+            /* elide both traffic class and flow label */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_ELIDE;
+        }
+        else {
+            /* elide flow label, traffic class (ECN + DSCP) inline (1 byte) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP;
+            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
+        }
+    }
+    else {
+        if (ipv6_hdr_get_tc_dscp(ipv6_hdr) == 0) {
+            /* elide DSCP, ECN + 2-bit pad + flow label inline (3 byte) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_FL;
+            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_tc_ecn(ipv6_hdr) << 6) |
+                                               ((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16));
+        }
+        else {
+            /* ECN + DSCP + 4-bit pad + flow label (4 bytes) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP_FL;
+            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
+            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16);
+        }
+
+        /* copy remaining bytes of flow label */
+        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x0000ff00) >> 8);
+        iphc_hdr[inline_pos++] = (uint8_t)(ipv6_hdr_get_fl(ipv6_hdr) & 0x000000ff);
+    }
+
+    /* check for compressible next header */
+    if (_compressible_nh(ipv6_hdr->nh)) {
+        iphc_hdr[IPHC1_IDX] |= SIXLOWPAN_IPHC1_NH;
+    }
+    else {
+        iphc_hdr[inline_pos++] = ipv6_hdr->nh;
+    }
+
+    /* compress hop limit */
+    switch (ipv6_hdr->hl) {
+        case 1:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_1;
+            break;
+
+        case 64:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_64;
+            break;
+
+        case 255:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_255;
+            break;
+
+        default:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_INLINE;
+            iphc_hdr[inline_pos++] = ipv6_hdr->hl;
+            break;
+    }
+
+    return inline_pos;
+}
+
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+#define IPHC_CACHE_NO_CTX           (0xff)
+
+/* Compressed addresses of the last packet of a flow. The next header is not
+ * part of the key: it only decides the NH bit or the inline next header byte,
+ * which _iphc_tf_nh_hl_encode() recomputes for every packet anyway. */
+typedef struct {
+    ipv6_addr_t src;
+    ipv6_addr_t dst;
+    gnrc_netif_t *iface;        /* NULL if the entry is empty */
+    eui64_t src_iid;            /* interface IID the source was compressed with */
+    uint16_t ctx_gen;           /* gnrc_sixlowpan_ctx_generation() when set */
+    uint8_t l2dst[GNRC_NETIF_L2ADDR_MAXLEN];
+    uint8_t l2dst_len;
+    uint8_t src_cid;            /* IPHC_CACHE_NO_CTX if no context was used */
+    uint8_t dst_cid;            /* IPHC_CACHE_NO_CTX if no context was used */
+    bool uses_src_iid;
+    uint8_t iphc2;
+    uint8_t cid_ext;
+    uint8_t addr_len;
+    uint8_t addr[2 * sizeof(ipv6_addr_t)];
+} _iphc_cache_t;
+
+/* only accessed by the 6LoWPAN thread, so no locking needed */
+static _iphc_cache_t _iphc_cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+
+static _iphc_cache_t *_iphc_cache_entry(const ipv6_hdr_t *ipv6_hdr,
+                                        const gnrc_netif_hdr_t *netif_hdr,
+                                        const gnrc_netif_t *iface)
+{
+    uint32_t hash = iface->pid;
+
+    if (netif_hdr->dst_l2addr_len > GNRC_NETIF_L2ADDR_MAXLEN) {
+        return NULL;
+    }
+    /* the interface identifiers differ the most between flows */
+    hash ^= ipv6_hdr->src.u32[2].u32 ^ ipv6_hdr->src.u32[3].u32;
+    hash ^= ipv6_hdr->dst.u32[2].u32 ^ ipv6_hdr->dst.u32[3].u32;
+    hash ^= ipv6_hdr->dst.u32[0].u32;
+    /* Fibonacci hashing, the upper bits of the product depend on all bits */
+    hash *= 2654435769U;
+    return &_iphc_cache[((uint64_t)hash * CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE) >> 32];
+}
+
+static bool _iphc_cache_ctx_usable(uint8_t cid)
+{
+    gnrc_sixlowpan_ctx_t *ctx;
+
+    if (cid == IPHC_CACHE_NO_CTX) {
+        return true;
+    }
+    /* also updates the lifetime of the context */
+    ctx = gnrc_sixlowpan_ctx_lookup_id(cid);
+    return (ctx != NULL) && (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP);
+}
+
+static bool _iphc_cache_hit(const _iphc_cache_t *entry,
+                            const ipv6_hdr_t *ipv6_hdr,
+                            const gnrc_netif_hdr_t *netif_hdr,
+                            gnrc_netif_t *iface)
+{
+    if ((entry->iface != iface) ||
+        (entry->l2dst_len != netif_hdr->dst_l2addr_len) ||
+        !ipv6_addr_equal(&entry->src, &ipv6_hdr->src) ||
+        !ipv6_addr_equal(&entry->dst, &ipv6_hdr->dst) ||
+        (memcmp(entry->l2dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                entry->l2dst_len) != 0)) {
+        return false;
+    }
+    /* contexts may have been added, changed, removed, or expired */
+    if ((entry->ctx_gen != gnrc_sixlowpan_ctx_generation()) ||
+        !_iphc_cache_ctx_usable(entry->src_cid) ||
+        ((entry->dst_cid != entry->src_cid) &&
+         !_iphc_cache_ctx_usable(entry->dst_cid))) {
+        return false;
+    }
+    if (entry->uses_src_iid) {
+        /* the link-layer address of the interface may have changed */
+        eui64_t iid;
+        int res;
+
+        gnrc_netif_acquire(iface);
+        res = gnrc_netif_ipv6_get_iid(iface, &iid);
+        gnrc_netif_release(iface);
+        if ((res < 0) || (iid.uint64.u64 != entry->src_iid.uint64.u64)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static size_t _iphc_cache_encode(const _iphc_cache_t *entry,
+                                 const ipv6_hdr_t *ipv6_hdr,
+                                 uint8_t *iphc_hdr)
+{
+    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
+
+    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
+    iphc_hdr[IPHC2_IDX] = entry->iphc2;
+    if (entry->iphc2 & SIXLOWPAN_IPHC2_CID_EXT) {
+        iphc_hdr[CID_EXT_IDX] = entry->cid_ext;
+        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+    inline_pos = _iphc_tf_nh_hl_encode(ipv6_hdr, iphc_hdr, inline_pos);
+    memcpy(&iphc_hdr[inline_pos], entry->addr, entry->addr_len);
+    return inline_pos + entry->addr_len;
+}
+
+static inline uint8_t _iphc_cache_cid(const gnrc_sixlowpan_ctx_t *ctx)
+{
+    return (ctx == NULL) ? IPHC_CACHE_NO_CTX
+                         : (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
+}
+
+static void _iphc_cache_set(_iphc_cache_t *entry, const ipv6_hdr_t *ipv6_hdr,
+                            const gnrc_netif_hdr_t *netif_hdr,
+                            gnrc_netif_t *iface, const uint8_t *iphc_hdr,
+                            uint16_t addr_pos, uint16_t inline_pos)
+{
+    entry->src = ipv6_hdr->src;
+    entry->dst = ipv6_hdr->dst;
+    entry->ctx_gen = gnrc_sixlowpan_ctx_generation();
+    entry->l2dst_len = netif_hdr->dst_l2addr_len;
+    memcpy(entry->l2dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           entry->l2dst_len);
+    entry->iphc2 = iphc_hdr[IPHC2_IDX];
+    entry->cid_ext = iphc_hdr[CID_EXT_IDX];
+    entry->addr_len = inline_pos - addr_pos;
+    memcpy(entry->addr, &iphc_hdr[addr_pos], entry->addr_len);
+    entry->iface = iface;
+}
+#endif  /* MODULE_GNRC_SIXLOWPAN_IPHC_CACHE */
+
 static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                                 const gnrc_netif_hdr_t *netif_hdr,
                                 gnrc_netif_t *iface,
@@ -1082,6 +1282,10 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
     ipv6_hdr_t *ipv6_hdr;
     bool addr_comp = false;
     uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
+    uint16_t addr_pos;
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    _iphc_cache_t *entry;
+#endif  /* MODULE_GNRC_SIXLOWPAN_IPHC_CACHE */
 
     assert(iface != NULL);
 
@@ -1091,6 +1295,18 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
     }
     ipv6_hdr = pkt->next->data;
 
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    entry = _iphc_cache_entry(ipv6_hdr, netif_hdr, iface);
+    if (entry != NULL) {
+        if (_iphc_cache_hit(entry, ipv6_hdr, netif_hdr, iface)) {
+            return _iphc_cache_encode(entry, ipv6_hdr, iphc_hdr);
+        }
+        /* refilled below on success */
+        entry->iface = NULL;
+        entry->uses_src_iid = false;
+    }
+#endif  /* MODULE_GNRC_SIXLOWPAN_IPHC_CACHE */
+
     /* set initial dispatch value*/
     iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
     iphc_hdr[IPHC2_IDX] = 0;
@@ -1138,64 +1354,9 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
     }
 
-    /* compress flow label and traffic class */
-    if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
-        if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
-            /* elide both traffic class and flow label */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_ELIDE;
-        }
-        else {
-            /* elide flow label, traffic class (ECN + DSCP) inline (1 byte) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP;
-            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
-        }
-    }
-    else {
-        if (ipv6_hdr_get_tc_dscp(ipv6_hdr) == 0) {
-            /* elide DSCP, ECN + 2-bit pad + flow label inline (3 byte) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_FL;
-            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_tc_ecn(ipv6_hdr) << 6) |
-                                               ((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16));
-        }
-        else {
-            /* ECN + DSCP + 4-bit pad + flow label (4 bytes) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP_FL;
-            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
-            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16);
-        }
-
-        /* copy remaining bytes of flow label */
-        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x0000ff00) >> 8);
-        iphc_hdr[inline_pos++] = (uint8_t)(ipv6_hdr_get_fl(ipv6_hdr) & 0x000000ff);
-    }
-
-    /* check for compressible next header */
-    if (_compressible_nh(ipv6_hdr->nh)) {
-        iphc_hdr[IPHC1_IDX] |= SIXLOWPAN_IPHC1_NH;
-    }
-    else {
-        iphc_hdr[inline_pos++] = ipv6_hdr->nh;
-    }
-
-    /* compress hop limit */
-    switch (ipv6_hdr->hl) {
-        case 1:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_1;
-            break;
-
-        case 64:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_64;
-            break;
-
-        case 255:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_255;
-            break;
-
-        default:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_INLINE;
-            iphc_hdr[inline_pos++] = ipv6_hdr->hl;
-            break;
-    }
+    inline_pos = _iphc_tf_nh_hl_encode(ipv6_hdr, iphc_hdr, inline_pos);
+    /* everything from here on only depends on the addresses */
+    addr_pos = inline_pos;
 
     if (ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
         iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_UNSPEC;
@@ -1221,6 +1382,12 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                 return 0;
             }
             gnrc_netif_release(iface);
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+            if (entry != NULL) {
+                entry->src_iid = iid;
+                entry->uses_src_iid = true;
+            }
+#endif  /* MODULE_GNRC_SIXLOWPAN_IPHC_CACHE */
 
             if ((ipv6_hdr->src.u64[1].u64 == iid.uint64.u64) ||
                 _context_overlaps_iid(src_ctx, &ipv6_hdr->src, &iid)) {
@@ -1310,6 +1477,7 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                  * (https://tools.ietf.org/html/rfc3306) with given context
                  * for unicast prefix -> context based compression */
                 iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_DAC;
+                dst_ctx = ctx;
                 if ((ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0) {
                     iphc_hdr[CID_EXT_IDX] |= (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
                 }
@@ -1369,6 +1537,17 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         inline_pos += 16;
     }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_CACHE
+    if (entry != NULL) {
+        entry->src_cid = _iphc_cache_cid(src_ctx);
+        entry->dst_cid = _iphc_cache_cid(dst_ctx);
+        _iphc_cache_set(entry, ipv6_hdr, netif_hdr, iface, iphc_hdr,
+                        addr_pos, inline_pos);
+    }
+#else   /* MODULE_GNRC_SIXLOWPAN_IPHC_CACHE */
+    (void)addr_pos;
+#endif  /* MODULE_GNRC_SIXLOWPAN_IPHC_CACHE */
+
     return inline_pos;
 }
 
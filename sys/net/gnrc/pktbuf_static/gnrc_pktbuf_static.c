@@ -72,6 +72,11 @@ void gnrc_pktbuf_init(void)
     if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
         memset(_static_buf, GNRC_PKTBUF_CANARY, sizeof(_static_buf));
     }
+    if (IS_USED(MODULE_GNRC_PKTBUF_STATIC_TLSF)) {
+        gnrc_pktbuf_tlsf_init(_static_buf);
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return;
+    }
     /* Silence false -Wcast-align: _static_buf has qualifier
      * `alignas(_unused_t)`, so it is guaranteed to be safe */
     _first_unused = (_unused_t *)(uintptr_t)_static_buf;
@@ -272,6 +277,12 @@ void gnrc_pktbuf_stats(void)
     _unused_t *ptr = _first_unused;
     uint8_t *chunk = &_static_buf[0];
     int count = 0;
+    size_t free_bytes = 0, largest = 0;
+
+    if (IS_USED(MODULE_GNRC_PKTBUF_STATIC_TLSF)) {
+        gnrc_pktbuf_tlsf_stats();
+        return;
+    }
 
     printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
            (void *)&_static_buf[0],
@@ -304,12 +315,28 @@ void gnrc_pktbuf_stats(void)
     if (chunk <= &_static_buf[CONFIG_GNRC_PKTBUF_SIZE - 1]) {
         _print_chunk(chunk, &_static_buf[CONFIG_GNRC_PKTBUF_SIZE] - chunk, count);
     }
+
+    count = 0;
+    for (ptr = _first_unused; ptr; ptr = ptr->next) {
+        free_bytes += ptr->size;
+        if (ptr->size > largest) {
+            largest = ptr->size;
+        }
+        count++;
+    }
+    printf("  free: %" PRIuSIZE " bytes in %i blocks, largest: %" PRIuSIZE " bytes\n",
+           free_bytes, count, largest);
+    printf("  fragmentation: %u%%\n",
+           free_bytes ? (unsigned)(100 - (largest * 100) / free_bytes) : 0);
 }
 #endif
 
 #ifdef TEST_SUITES
 bool gnrc_pktbuf_is_empty(void)
 {
+    if (IS_USED(MODULE_GNRC_PKTBUF_STATIC_TLSF)) {
+        return gnrc_pktbuf_tlsf_is_empty();
+    }
     return ((uintptr_t)_first_unused == (uintptr_t)_static_buf) &&
            (_first_unused->size == sizeof(_static_buf));
 }
@@ -318,6 +345,10 @@ bool gnrc_pktbuf_is_sane(void)
 {
     _unused_t *ptr = _first_unused;
 
+    if (IS_USED(MODULE_GNRC_PKTBUF_STATIC_TLSF)) {
+        return gnrc_pktbuf_tlsf_is_sane();
+    }
+
     /* Invariants of this implementation:
      *  - the head of _unused_t list is _first_unused
      *  - if _unused_t list is empty the packet buffer is full and _first_unused is NULL
@@ -378,6 +409,10 @@ static void *_pktbuf_alloc(size_t size)
 {
     _unused_t *prev = NULL, *ptr = _first_unused;
 
+    if (IS_USED(MODULE_GNRC_PKTBUF_STATIC_TLSF)) {
+        return gnrc_pktbuf_tlsf_alloc(size);
+    }
+
     size = _align(size);
     while (ptr && (size > ptr->size)) {
         prev = ptr;
@@ -472,6 +507,11 @@ void gnrc_pktbuf_free_internal(void *data, size_t size)
         return;
     }
 
+    if (IS_USED(MODULE_GNRC_PKTBUF_STATIC_TLSF)) {
+        gnrc_pktbuf_tlsf_free(data, size);
+        return;
+    }
+
     if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
         /* check if the data has already been marked as free */
         size_t chk_len = _align(size) - sizeof(*new);
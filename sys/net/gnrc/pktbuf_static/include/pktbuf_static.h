@@ -21,6 +21,8 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <sys/types.h>
 
 #ifdef __cplusplus
@@ -50,6 +52,62 @@ static inline size_t _align(size_t size)
           ~(GNRC_PKTBUF_STATIC_ALIGN_MASK);
 }
 
+/**
+ * @name    Segregated-fit allocator (module `gnrc_pktbuf_static_tlsf`)
+ *
+ * Replacement for the first-fit free list of the static packet buffer. All
+ * functions expect @ref gnrc_pktbuf_mutex to be held by the caller and work
+ * in multiples of @ref _align().
+ * @{
+ */
+/**
+ * @brief   Initializes the allocator with the whole packet buffer as a
+ *          single free block
+ *
+ * @param[in] buf   The packet buffer arena of size
+ *                  @ref CONFIG_GNRC_PKTBUF_SIZE, aligned to @ref _unused_t
+ */
+void gnrc_pktbuf_tlsf_init(uint8_t *buf);
+
+/**
+ * @brief   Allocates @p size bytes from the packet buffer
+ *
+ * Takes constant time if a free block of a larger size class than @p size
+ * exists. Otherwise the free blocks of the size class of @p size are searched
+ * linearly.
+ *
+ * @param[in] size  Number of bytes to allocate
+ *
+ * @return  The allocated section, NULL if no free block is large enough
+ */
+void *gnrc_pktbuf_tlsf_alloc(size_t size);
+
+/**
+ * @brief   Returns a section of the packet buffer in O(1)
+ *
+ * The section is coalesced with its free neighbors immediately.
+ *
+ * @param[in] data  Start of the section (not NULL, within the packet buffer)
+ * @param[in] size  Size of the section
+ */
+void gnrc_pktbuf_tlsf_free(void *data, size_t size);
+
+/**
+ * @brief   Prints usage and fragmentation statistics of the allocator
+ */
+void gnrc_pktbuf_tlsf_stats(void);
+
+/**
+ * @brief   Checks if the whole packet buffer is a single free block
+ */
+bool gnrc_pktbuf_tlsf_is_empty(void);
+
+/**
+ * @brief   Checks the consistency of the free lists and their bitmaps
+ */
+bool gnrc_pktbuf_tlsf_is_sane(void);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
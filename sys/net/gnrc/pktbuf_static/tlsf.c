@@ -0,0 +1,458 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Segregated-fit allocator for the static packet buffer
+ *
+ * Free blocks are kept in two-level segregated lists: the first level
+ * splits by powers of two, the second level splits every power of two into
+ * `SL_NUMOF` linear classes. A bitmap per level allows to find a non-empty
+ * list that is guaranteed to fit a request with two find-first-set
+ * operations. Only if there is no such list, the list of the request's own
+ * class is searched for a block that is large enough.
+ *
+ * Every free block of at least two allocation units carries a header
+ * (@ref _block_t) and a footer holding its size. Free blocks of a single unit
+ * only consist of the size header and footer and are not listed: they are
+ * recovered once a neighbor is freed. The first and the last unit of every
+ * free block are marked in @ref _edges, so both neighbors of a freed section
+ * are found and coalesced in constant time.
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "architecture.h"
+#include "bitarithm.h"
+#include "bitfield.h"
+#include "net/gnrc/pktbuf.h"
+#include "od.h"
+#include "string_utils.h"
+
+#include "pktbuf_internal.h"
+#include "pktbuf_static.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Allocation unit, the same alignment as for the first-fit allocator
+ */
+#define UNIT            sizeof(_unused_t)
+
+/**
+ * @brief   Size of the size footer at the end of each free block
+ */
+#define WORD            sizeof(size_t)
+
+/**
+ * @brief   Number of allocation units in the packet buffer
+ */
+#define UNITS           (CONFIG_GNRC_PKTBUF_SIZE / UNIT)
+
+/**
+ * @brief   log2 of the number of second-level classes per power of two
+ */
+#define SL_BITS         (2U)
+#define SL_NUMOF        (1U << SL_BITS)
+
+#define _LOG2_2(x)      (((x) & 0x2UL) ? 1 : 0)
+#define _LOG2_4(x)      (((x) & 0xcUL) ? 2 + _LOG2_2((x) >> 2) : _LOG2_2(x))
+#define _LOG2_8(x)      (((x) & 0xf0UL) ? 4 + _LOG2_4((x) >> 4) : _LOG2_4(x))
+#define _LOG2_16(x)     (((x) & 0xff00UL) ? 8 + _LOG2_8((x) >> 8) : _LOG2_8(x))
+#define _LOG2(x)        (((x) & 0xffff0000UL) ? 16 + _LOG2_16((x) >> 16) \
+                                              : _LOG2_16(x))
+
+/**
+ * @brief   Number of first-level classes needed to hold the whole buffer
+ */
+#define FL_NUMOF        (_LOG2((unsigned long)UNITS) - SL_BITS + 2)
+
+/**
+ * @brief   Header of a free block of at least two units
+ */
+typedef struct _block {
+    size_t size;            /**< size of the free block in bytes */
+    struct _block *next;    /**< next free block of the same class */
+    struct _block *prev;    /**< previous free block of the same class */
+} _block_t;
+
+static_assert(UNIT == 2 * WORD,
+              "allocation unit must hold a size header and a size footer");
+static_assert(sizeof(_block_t) + WORD <= 2 * UNIT,
+              "a free block of two units must hold its header and footer");
+static_assert(FL_NUMOF <= 8 * sizeof(unsigned),
+              "CONFIG_GNRC_PKTBUF_SIZE too large for first-level bitmap");
+
+static uint8_t *_buf;
+static unsigned _fl_map;
+static unsigned _sl_map[FL_NUMOF];
+static _block_t *_heads[FL_NUMOF][SL_NUMOF];
+static BITFIELD(_edges, UNITS);
+static size_t _free_bytes;
+
+#ifdef DEVELHELP
+/* maximum number of bytes allocated at the same time */
+static size_t _max_used;
+#endif
+
+static inline size_t _unit(const void *ptr)
+{
+    return ((const uint8_t *)ptr - _buf) / UNIT;
+}
+
+static inline size_t *_footer(uint8_t *start, size_t size)
+{
+    /* Silence false -Wcast-align: blocks start and end on a unit boundary */
+    return (size_t *)(uintptr_t)(start + size - WORD);
+}
+
+static inline size_t _header_size(size_t size)
+{
+    return (size < 2 * UNIT) ? WORD : sizeof(_block_t);
+}
+
+static inline void _mapping(unsigned units, unsigned *fl, unsigned *sl)
+{
+    if (units < SL_NUMOF) {
+        *fl = 0;
+        *sl = units;
+    }
+    else {
+        unsigned msb = bitarithm_msb(units);
+
+        *fl = msb - SL_BITS + 1;
+        *sl = (units >> (msb - SL_BITS)) - SL_NUMOF;
+    }
+}
+
+static void _insert(uint8_t *start, size_t size)
+{
+    /* Silence false -Wcast-align: blocks start on a unit boundary */
+    _block_t *block = (_block_t *)(uintptr_t)start;
+    unsigned units = size / UNIT;
+
+    block->size = size;
+    *_footer(start, size) = size;
+    bf_set(_edges, _unit(start));
+    bf_set(_edges, _unit(start) + units - 1);
+    _free_bytes += size;
+
+    if (units >= 2) {
+        unsigned fl, sl;
+
+        _mapping(units, &fl, &sl);
+        block->prev = NULL;
+        block->next = _heads[fl][sl];
+        if (block->next) {
+            block->next->prev = block;
+        }
+        _heads[fl][sl] = block;
+        _sl_map[fl] |= 1U << sl;
+        _fl_map |= 1U << fl;
+    }
+}
+
+static void _remove(_block_t *block)
+{
+    unsigned units = block->size / UNIT;
+
+    bf_unset(_edges, _unit(block));
+    bf_unset(_edges, _unit(block) + units - 1);
+    _free_bytes -= block->size;
+
+    if (units >= 2) {
+        unsigned fl, sl;
+
+        _mapping(units, &fl, &sl);
+        if (block->prev) {
+            block->prev->next = block->next;
+        }
+        else {
+            _heads[fl][sl] = block->next;
+        }
+        if (block->next) {
+            block->next->prev = block->prev;
+        }
+        if (_heads[fl][sl] == NULL) {
+            _sl_map[fl] &= ~(1U << sl);
+            if (_sl_map[fl] == 0) {
+                _fl_map &= ~(1U << fl);
+            }
+        }
+    }
+}
+
+static _block_t *_find(unsigned units)
+{
+    unsigned fl, sl, req = units;
+
+    /* round up to the next class boundary, so that every block of the
+     * class found is large enough */
+    if (req >= SL_NUMOF) {
+        req += (1U << (bitarithm_msb(req) - SL_BITS)) - 1;
+    }
+    _mapping(req, &fl, &sl);
+    if (fl < FL_NUMOF) {
+        unsigned map = _sl_map[fl] & (~0U << sl);
+
+        if (map == 0) {
+            map = (fl + 1 < FL_NUMOF) ? (_fl_map & (~0U << (fl + 1))) : 0;
+            if (map) {
+                fl = bitarithm_lsb(map);
+                map = _sl_map[fl];
+            }
+        }
+        if (map) {
+            return _heads[fl][bitarithm_lsb(map)];
+        }
+    }
+    /* no larger class left: a block in the request's own class may still
+     * fit, so rather search it than fail while there is space */
+    _mapping(units, &fl, &sl);
+    if (fl < FL_NUMOF) {
+        for (_block_t *block = _heads[fl][sl]; block; block = block->next) {
+            if (block->size >= units * UNIT) {
+                return block;
+            }
+        }
+    }
+    return NULL;
+}
+
+void gnrc_pktbuf_tlsf_init(uint8_t *buf)
+{
+    _buf = buf;
+    _fl_map = 0;
+    memset(_sl_map, 0, sizeof(_sl_map));
+    memset(_heads, 0, sizeof(_heads));
+    memset(_edges, 0, sizeof(_edges));
+    _free_bytes = 0;
+    _insert(buf, CONFIG_GNRC_PKTBUF_SIZE);
+}
+
+void *gnrc_pktbuf_tlsf_alloc(size_t size)
+{
+    _block_t *block;
+    uint8_t *start;
+    size_t block_size;
+
+    size = _align(size);
+    if ((size == 0) || (size > _free_bytes)) {
+        DEBUG("pktbuf: no space left in packet buffer\n");
+        return NULL;
+    }
+    /* a single unit can only be served from a listed block */
+    block = _find((size < 2 * UNIT) ? 2 : size / UNIT);
+    if (block == NULL) {
+        DEBUG("pktbuf: no free block of %" PRIuSIZE " bytes\n", size);
+        return NULL;
+    }
+    start = (uint8_t *)block;
+    block_size = block->size;
+    _remove(block);
+
+    const void *mismatch;
+    size_t chk_start = _header_size(block_size);
+    size_t chk_end = (size == block_size) ? size - WORD : size;
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE && (chk_end > chk_start) &&
+        (mismatch = memchk(start + chk_start, GNRC_PKTBUF_CANARY,
+                           chk_end - chk_start))) {
+        printf("[%p] mismatch at offset %" PRIuPTR "/%" PRIuSIZE
+               " (ignoring %" PRIuSIZE " initial bytes that were repurposed)\n",
+               (void *)start, (uintptr_t)mismatch - (uintptr_t)start, size,
+               chk_start);
+#ifdef MODULE_OD
+        od_hex_dump(start, size, 0);
+#endif
+        assert(0);
+    }
+    if (block_size > size) {
+        _insert(start + size, block_size - size);
+    }
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        /* clear out canary */
+        memset(start, ~GNRC_PKTBUF_CANARY, size);
+    }
+#ifdef DEVELHELP
+    if (CONFIG_GNRC_PKTBUF_SIZE - _free_bytes > _max_used) {
+        _max_used = CONFIG_GNRC_PKTBUF_SIZE - _free_bytes;
+    }
+#endif
+
+    return start;
+}
+
+void gnrc_pktbuf_tlsf_free(void *data, size_t size)
+{
+    uint8_t *start = data;
+    uint8_t *end;
+
+    size = _align(size);
+    if (size == 0) {
+        return;
+    }
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        /* check if the data has already been marked as free */
+        size_t chk_len = (size > sizeof(_block_t) + WORD)
+                       ? size - sizeof(_block_t) - WORD : 0;
+        if (bf_isset(_edges, _unit(start)) ||
+            (chk_len && !memchk(start + sizeof(_block_t), GNRC_PKTBUF_CANARY,
+                                chk_len))) {
+            printf("pktbuf: double free detected! (at %p, len=%u)\n",
+                   data, (unsigned)size);
+            DEBUG_BREAKPOINT(2);
+        }
+        memset(start, GNRC_PKTBUF_CANARY, size);
+    }
+
+    /* the unit in front is the last one of a free block */
+    if ((start != _buf) && bf_isset(_edges, _unit(start) - 1)) {
+        size_t prev_size = *_footer(_buf, (start - _buf));
+        /* Silence false -Wcast-align: blocks start on a unit boundary */
+        _remove((_block_t *)(uintptr_t)(start - prev_size));
+        if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+            memset(start - WORD, GNRC_PKTBUF_CANARY, WORD);
+        }
+        start -= prev_size;
+        size += prev_size;
+    }
+    /* the unit behind is the first one of a free block */
+    end = start + size;
+    if ((end != _buf + CONFIG_GNRC_PKTBUF_SIZE) && bf_isset(_edges, _unit(end))) {
+        /* Silence false -Wcast-align: blocks start on a unit boundary */
+        _block_t *next = (_block_t *)(uintptr_t)end;
+        size_t next_size = next->size;
+
+        _remove(next);
+        if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+            memset(next, GNRC_PKTBUF_CANARY, _header_size(next_size));
+        }
+        size += next_size;
+    }
+    _insert(start, size);
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_tlsf_stats(void)
+{
+    size_t listed = 0, largest = 0;
+    unsigned blocks = 0;
+
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_buf[0], (void *)&_buf[CONFIG_GNRC_PKTBUF_SIZE],
+           CONFIG_GNRC_PKTBUF_SIZE);
+    printf("  bytes in use: %" PRIuSIZE " (max: %" PRIuSIZE ")\n",
+           CONFIG_GNRC_PKTBUF_SIZE - _free_bytes, _max_used);
+    for (unsigned fl = 0; fl < FL_NUMOF; fl++) {
+        for (unsigned sl = 0; sl < SL_NUMOF; sl++) {
+            unsigned num = 0;
+
+            for (_block_t *block = _heads[fl][sl]; block; block = block->next) {
+                listed += block->size;
+                if (block->size > largest) {
+                    largest = block->size;
+                }
+                num++;
+            }
+            if (num) {
+                unsigned min = (fl == 0) ? sl : (SL_NUMOF + sl) << (fl - 1);
+                printf("  class %2u/%u (>= %5" PRIuSIZE " bytes): %u free blocks\n",
+                       fl, sl, (size_t)min * UNIT, num);
+                blocks += num;
+            }
+        }
+    }
+    printf("  free: %" PRIuSIZE " bytes in %u blocks (+ %" PRIuSIZE
+           " bytes in single units), largest: %" PRIuSIZE " bytes\n",
+           listed, blocks, _free_bytes - listed, largest);
+    printf("  fragmentation: %u%%\n",
+           _free_bytes ? (unsigned)(100 - (largest * 100) / _free_bytes) : 0);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_tlsf_is_empty(void)
+{
+    return _free_bytes == CONFIG_GNRC_PKTBUF_SIZE;
+}
+
+bool gnrc_pktbuf_tlsf_is_sane(void)
+{
+    size_t free_bytes = 0;
+
+    /* Invariants of this implementation:
+     *  - the blocks marked in _edges are disjoint, their size header equals
+     *    their footer and they add up to _free_bytes
+     *  - no two free blocks are adjacent (they are coalesced on free)
+     *  - every free block of >= 2 units is listed in the class its size maps
+     *    to, and the bitmaps flag exactly the non-empty lists
+     */
+    for (size_t i = 0; i < UNITS; i++) {
+        if (!bf_isset(_edges, i)) {
+            continue;
+        }
+        /* Silence false -Wcast-align: blocks start on a unit boundary */
+        _block_t *block = (_block_t *)(uintptr_t)&_buf[i * UNIT];
+        size_t units = block->size / UNIT;
+
+        if ((block->size == 0) || (block->size % UNIT) || (i + units > UNITS) ||
+            (*_footer(&_buf[i * UNIT], block->size) != block->size) ||
+            !bf_isset(_edges, i + units - 1)) {
+            return false;
+        }
+        for (size_t j = i + 1; j + 1 < i + units; j++) {
+            if (bf_isset(_edges, j)) {
+                return false;
+            }
+        }
+        if ((i + units < UNITS) && bf_isset(_edges, i + units)) {
+            return false;
+        }
+        free_bytes += block->size;
+        i += units - 1;
+    }
+    if (free_bytes != _free_bytes) {
+        return false;
+    }
+
+    for (unsigned fl = 0; fl < FL_NUMOF; fl++) {
+        if (!(_fl_map & (1U << fl)) != !_sl_map[fl]) {
+            return false;
+        }
+        for (unsigned sl = 0; sl < SL_NUMOF; sl++) {
+            _block_t *prev = NULL;
+
+            if (!(_sl_map[fl] & (1U << sl)) != !_heads[fl][sl]) {
+                return false;
+            }
+            for (_block_t *block = _heads[fl][sl]; block; block = block->next) {
+                unsigned bfl, bsl;
+
+                if (!gnrc_pktbuf_contains(block) || (block->prev != prev) ||
+                    !bf_isset(_edges, _unit(block)) || (block->size < 2 * UNIT)) {
+                    return false;
+                }
+                _mapping(block->size / UNIT, &bfl, &bsl);
+                if ((bfl != fl) || (bsl != sl)) {
+                    return false;
+                }
+                prev = block;
+            }
+        }
+    }
+
+    return true;
+}
+#endif
+
+/** @} */
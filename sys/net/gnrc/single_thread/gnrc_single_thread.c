@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ * @ingroup     net_gnrc_single_thread
+ * @file
+ * @brief       Shared thread of the GNRC layers
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "container.h"
+#include "irq.h"
+#include "net/gnrc/netapi.h"
+#ifdef MODULE_GNRC_NETAPI_NOTIFY
+#include "net/gnrc/netapi/notify.h"
+#endif
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/single_thread.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "utlist.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   A netapi command dispatched by another thread
+ */
+typedef struct {
+    gnrc_single_thread_layer_t *layer;  /**< the receiving layer */
+    gnrc_pktsnip_t *pkt;                /**< the packet */
+    uint16_t cmd;                       /**< the command */
+} _post_t;
+
+static void _handle_post(event_t *event);
+
+kernel_pid_t gnrc_single_thread_pid = KERNEL_PID_UNDEF;
+
+static char _stack[GNRC_SINGLE_THREAD_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
+static msg_t _msg_queue[GNRC_SINGLE_THREAD_MSG_QUEUE_SIZE];
+static event_queue_t _evq;
+static gnrc_single_thread_layer_t *_layers;
+
+/* ring buffer of commands from other threads, guarded by disabling IRQs */
+static _post_t _posts[CONFIG_GNRC_SINGLE_THREAD_QUEUE_SIZE];
+static unsigned _posts_first;
+static unsigned _posts_numof;
+static event_t _post_event = { .handler = _handle_post };
+
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    gnrc_single_thread_layer_t *layer = ctx;
+
+    if (thread_getpid() == gnrc_single_thread_pid) {
+        /* run to completion */
+        layer->netapi_cb(cmd, pkt);
+        return;
+    }
+
+    unsigned state = irq_disable();
+
+    if (_posts_numof == ARRAY_SIZE(_posts)) {
+        irq_restore(state);
+        DEBUG("gnrc_single_thread: queue full, dropping command 0x%04x\n", cmd);
+#ifdef MODULE_GNRC_NETAPI_NOTIFY
+        if (cmd == GNRC_NETAPI_MSG_TYPE_NOTIFY) {
+            /* the notifying thread waits for all receivers */
+            gnrc_netapi_notify_ack(&((gnrc_netapi_notify_t *)pkt)->ack);
+        }
+        else
+#endif
+        {
+            gnrc_pktbuf_release_error(pkt, ENOBUFS);
+        }
+        return;
+    }
+
+    _post_t *post = &_posts[(_posts_first + _posts_numof) % ARRAY_SIZE(_posts)];
+
+    post->layer = layer;
+    post->pkt = pkt;
+    post->cmd = cmd;
+    _posts_numof++;
+    irq_restore(state);
+    event_post(&_evq, &_post_event);
+}
+
+static void _handle_post(event_t *event)
+{
+    unsigned state = irq_disable();
+    _post_t post = _posts[_posts_first];
+
+    _posts_first = (_posts_first + 1) % ARRAY_SIZE(_posts);
+    if (--_posts_numof > 0) {
+        /* one at a time, so interface events are not held up */
+        event_post(&_evq, event);
+    }
+    irq_restore(state);
+    post.layer->netapi_cb(post.cmd, post.pkt);
+}
+
+static event_t *_fetch_event(void)
+{
+    event_t *event;
+
+    /* the layers' queues (i.e. the interface's) come first */
+    for (gnrc_single_thread_layer_t *layer = _layers; layer; layer = layer->next) {
+        for (unsigned i = 0; i < layer->evq_numof; i++) {
+            if ((event = event_get(&layer->evq[i]))) {
+                return event;
+            }
+        }
+    }
+    return event_get(&_evq);
+}
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    event_queue_claim(&_evq);
+
+    while (1) {
+        event_t *event;
+        msg_t msg, reply;
+
+        while ((event = _fetch_event())) {
+            event->handler(event);
+        }
+        if (msg_try_receive(&msg) > 0) {
+            gnrc_single_thread_handle_msg(&msg, &reply);
+            if ((msg.type == GNRC_NETAPI_MSG_TYPE_GET) ||
+                (msg.type == GNRC_NETAPI_MSG_TYPE_SET)) {
+                msg_reply(&msg, &reply);
+            }
+            continue;
+        }
+        thread_flags_wait_any(THREAD_FLAG_MSG_WAITING | THREAD_FLAG_EVENT);
+    }
+
+    return NULL;
+}
+
+kernel_pid_t gnrc_single_thread_init(void)
+{
+    if (gnrc_single_thread_pid == KERNEL_PID_UNDEF) {
+        event_queue_init_detached(&_evq);
+        gnrc_single_thread_pid = thread_create(_stack, sizeof(_stack),
+                                               GNRC_SINGLE_THREAD_PRIO, 0,
+                                               _thread, NULL, "gnrc");
+    }
+    return gnrc_single_thread_pid;
+}
+
+void gnrc_single_thread_add(gnrc_single_thread_layer_t *layer)
+{
+    assert(gnrc_single_thread_pid != KERNEL_PID_UNDEF);
+    layer->cbd.cb = _netapi_cb;
+    layer->cbd.ctx = layer;
+    LL_APPEND(_layers, layer);
+}
+
+void gnrc_single_thread_post(event_t *event)
+{
+    event_post(&_evq, event);
+}
+
+void gnrc_single_thread_handle_msg(msg_t *msg, msg_t *reply)
+{
+    assert(thread_getpid() == gnrc_single_thread_pid);
+    reply->type = GNRC_NETAPI_MSG_TYPE_ACK;
+    reply->content.value = (uint32_t)-ENOTSUP;
+    for (gnrc_single_thread_layer_t *layer = _layers; layer; layer = layer->next) {
+        if ((layer->msg_handler != NULL) && layer->msg_handler(msg, reply)) {
+            return;
+        }
+    }
+    DEBUG("gnrc_single_thread: unhandled message type 0x%04x\n", msg->type);
+    if ((msg->type == GNRC_NETAPI_MSG_TYPE_RCV) ||
+        (msg->type == GNRC_NETAPI_MSG_TYPE_SND)) {
+        gnrc_pktbuf_release(msg->content.ptr);
+    }
+}
@@ -23,6 +23,7 @@
 #include "net/af.h"
 #include "net/tcp.h"
 #include "net/gnrc.h"
+#include "net/gnrc/netapi/batch.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_fsm.h"
@@ -54,6 +55,13 @@ static evtimer_t _tcp_msg_timer;
  */
 static kernel_pid_t _tcp_eventloop_pid = KERNEL_PID_UNDEF;
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+/**
+ * @brief Number of segments of the current batch that are not processed yet
+ */
+static unsigned _batch_left;
+#endif
+
 /**
  * @brief Send function, pass packet down the network stack.
  *
@@ -273,6 +281,33 @@ static int _receive(gnrc_pktsnip_t *pkt)
     return 0;
 }
 
+#if IS_USED(MODULE_GNRC_TCP_GRO)
+/**
+ * @brief Sends the ACKs deferred while packets were waiting in the message queue.
+ */
+static void _send_deferred_acks(void)
+{
+    TCP_DEBUG_ENTER;
+    _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+    gnrc_tcp_tcb_t *tcb = NULL;
+
+    do {
+        /* The FSM can't be called with the list locked, sending the ACK clears the status */
+        mutex_lock(&list->lock);
+        tcb = list->head;
+        while (tcb && !(tcb->status & STATUS_ACK_PENDING)) {
+            tcb = tcb->next;
+        }
+        mutex_unlock(&list->lock);
+
+        if (tcb != NULL) {
+            _gnrc_tcp_fsm(tcb, FSM_EVENT_SEND_ACK, NULL, NULL, 0);
+        }
+    } while (tcb != NULL);
+    TCP_DEBUG_LEAVE;
+}
+#endif
+
 static void *_eventloop(__attribute__((unused)) void *arg)
 {
     TCP_DEBUG_ENTER;
@@ -292,6 +327,9 @@ static void *_eventloop(__attribute__((unused)) void *arg)
     /* Register GNRC TCPs handling thread in netreg */
     gnrc_netreg_entry_t entry;
     gnrc_netreg_entry_init_pid(&entry, GNRC_NETREG_DEMUX_CTX_ALL, _tcp_eventloop_pid);
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    entry.batch = true;
+#endif
     gnrc_netreg_register(GNRC_NETTYPE_TCP, &entry);
 
     /* dispatch NETAPI messages */
@@ -304,6 +342,19 @@ static void *_eventloop(__attribute__((unused)) void *arg)
                 _receive((gnrc_pktsnip_t *)msg.content.ptr);
                 break;
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+            /* Pass a batch of messages up the network stack */
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                TCP_DEBUG_INFO("Received GNRC_NETAPI_MSG_TYPE_RCV_BATCH.");
+                _batch_left = gnrc_netapi_batch_numof(msg.content.ptr);
+                for (unsigned i = 0; _batch_left > 0; i++) {
+                    _batch_left--;
+                    _receive(gnrc_netapi_batch_get(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+#endif
+
             /* Pass message down the network stack */
             case GNRC_NETAPI_MSG_TYPE_SND:
                 TCP_DEBUG_INFO("Received GNRC_NETAPI_MSG_TYPE_SND.");
@@ -343,6 +394,12 @@ static void *_eventloop(__attribute__((unused)) void *arg)
             default:
                 TCP_DEBUG_ERROR("Received unexpected message.");
         }
+#if IS_USED(MODULE_GNRC_TCP_GRO)
+        /* Queue drained: acknowledge the coalesced segments */
+        if (!_gnrc_tcp_eventloop_pending()) {
+            _send_deferred_acks();
+        }
+#endif
     }
     /* Never reached */
     TCP_DEBUG_ERROR("This function should never exit.");
@@ -368,6 +425,16 @@ void _gnrc_tcp_eventloop_unsched(evtimer_msg_event_t *event)
     TCP_DEBUG_LEAVE;
 }
 
+bool _gnrc_tcp_eventloop_pending(void)
+{
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    if (_batch_left > 0) {
+        return true;
+    }
+#endif
+    return (msg_avail() > 0);
+}
+
 int _gnrc_tcp_eventloop_init(void)
 {
     TCP_DEBUG_ENTER;
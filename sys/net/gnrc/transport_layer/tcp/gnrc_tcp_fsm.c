@@ -97,6 +97,7 @@ static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
         gnrc_pktbuf_release(tcb->pkt_retransmit);
         tcb->pkt_retransmit = NULL;
     }
+    tcb->status &= ~STATUS_FAST_RECOVERY;
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -148,8 +149,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit queue and out-of-order queue */
             _clear_retransmit(tcb);
+            _gnrc_tcp_rcvbuf_ooo_clear(tcb);
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -174,8 +176,8 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             break;
 
         case FSM_STATE_LISTEN:
-            /* Clear Accepted Status */
-            tcb->status &= ~(STATUS_ACCEPTED);
+            /* Clear Accepted Status and options of the previous connection */
+            tcb->status &= ~(STATUS_ACCEPTED | STATUS_SACK_PERMITTED);
 
             /* Clear address info */
 #ifdef MODULE_GNRC_IPV6
@@ -198,6 +200,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             break;
 
         case FSM_STATE_SYN_SENT:
+            /* Clear options of a previous connection */
+            tcb->status &= ~STATUS_SACK_PERMITTED;
+
             /* Add connection to active connections (if not already active) */
             mutex_lock(&list->lock);
             LL_SEARCH(list->head, iter, tcb, TCB_EQUAL);
@@ -322,8 +327,18 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     /* Check if window is open and all packets were transmitted */
     if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
+        size_t seg_size = (tcb->mss < CONFIG_GNRC_TCP_MSS) ? tcb->mss : CONFIG_GNRC_TCP_MSS;
+        size_t max_payload = seg_size;
+
+        /* Send up to CONFIG_GNRC_TCP_GSO_SEGS segments as one super-segment,
+         * its length must fit into the IPv6 payload length */
+        if (IS_USED(MODULE_GNRC_TCP_GSO)) {
+            max_payload *= CONFIG_GNRC_TCP_GSO_SEGS;
+            if (max_payload > UINT16_MAX - sizeof(tcp_hdr_t)) {
+                max_payload = UINT16_MAX - sizeof(tcp_hdr_t);
+            }
+        }
+        payload = (payload < max_payload) ? payload : max_payload;
         payload = (payload < len) ? payload : len;
 
         /* Calculate payload size for this segment */
@@ -331,6 +346,15 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
         uint16_t seq_con = 0;
         _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
                             tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (IS_USED(MODULE_GNRC_TCP_GSO) && (payload > seg_size) &&
+            ((out_pkt == NULL) || (_gnrc_tcp_pkt_set_gso(&out_pkt, seg_size) < 0))) {
+            /* Not enough space for the super-segment: send a single segment */
+            gnrc_pktbuf_release(out_pkt);
+            out_pkt = NULL;
+            payload = seg_size;
+            _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
         TCP_DEBUG_LEAVE;
@@ -340,6 +364,146 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     return 0;
 }
 
+#if IS_USED(MODULE_GNRC_TCP_GRO)
+/**
+ * @brief Decides whether the ACK for an in-order data segment is deferred.
+ *
+ * While further packets wait in the eventloop's message queue, the ACK and
+ * the user notification are deferred, so that a burst of in-order segments
+ * is coalesced into the receive buffer under a single ACK. The eventloop
+ * sends the ACK with FSM_EVENT_SEND_ACK once its queue drained.
+ *
+ * @note Only called from the eventloop on FSM_EVENT_RCVD_PKT.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   True, if the ACK is deferred.
+ */
+static bool _gro_defer_ack(gnrc_tcp_tcb_t *tcb)
+{
+    if ((++tcb->gro_segs < CONFIG_GNRC_TCP_GRO_SEGS_MAX) &&
+        _gnrc_tcp_eventloop_pending()) {
+        tcb->status |= STATUS_ACK_PENDING;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Clears a deferred ACK, after an ACK was sent.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _gro_ack_sent(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->gro_segs = 0;
+    tcb->status &= ~STATUS_ACK_PENDING;
+}
+#else
+static inline bool _gro_defer_ack(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+    return false;
+}
+
+static inline void _gro_ack_sent(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+#endif
+
+#if IS_USED(MODULE_GNRC_TCP_SACK)
+/**
+ * @brief Calculates the number of duplicate ACKs that trigger a fast retransmit.
+ *
+ * With less than four segments in flight, less than three duplicate ACKs can
+ * arrive. The threshold is then lowered to the number of segments in flight
+ * minus one (Early Retransmit, RFC 5827).
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of duplicate ACKs that trigger a fast retransmit.
+ *            Zero, if a single segment is in flight.
+ */
+static uint8_t _dupack_threshold(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t seg_size = (tcb->mss < CONFIG_GNRC_TCP_MSS) ? tcb->mss : CONFIG_GNRC_TCP_MSS;
+    uint32_t segs = ((tcb->snd_nxt - tcb->snd_una) + seg_size - 1) / seg_size;
+
+    if (segs > DUPACK_THRESHOLD) {
+        return DUPACK_THRESHOLD;
+    }
+    return (segs > 0) ? (segs - 1) : 0;
+}
+
+/**
+ * @brief Counts a duplicate ACK, retransmits on reaching the threshold.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _sack_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    uint8_t threshold = _dupack_threshold(tcb);
+
+    if ((tcb->status & STATUS_FAST_RECOVERY) || (threshold == 0)) {
+        return;
+    }
+    if (++tcb->dup_acks >= threshold) {
+        TCP_DEBUG_INFO("Duplicate ACKs received. Fast retransmit.");
+        tcb->status |= STATUS_FAST_RECOVERY;
+        _gnrc_tcp_pkt_fast_retransmit(tcb);
+    }
+}
+
+/**
+ * @brief Handles an ACK that acknowledged new data.
+ *
+ * During fast recovery, a partial ACK means that the data following it was
+ * lost as well, it is retransmitted right away (RFC 6582). Fast recovery ends
+ * when all data is acknowledged.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _sack_new_ack(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->dup_acks = 0;
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        if (tcb->pkt_retransmit != NULL) {
+            _gnrc_tcp_pkt_fast_retransmit(tcb);
+        }
+        else {
+            tcb->status &= ~STATUS_FAST_RECOVERY;
+        }
+    }
+}
+
+/**
+ * @brief Resets duplicate ACK counting after a retransmission timeout.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _sack_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->dup_acks = 0;
+    tcb->status &= ~STATUS_FAST_RECOVERY;
+}
+#else
+static inline void _sack_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline void _sack_new_ack(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline void _sack_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+#endif
+
 /**
  * @brief FSM handling function for receiving data.
  *
@@ -714,6 +878,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     tcb->snd_una = seg_ack;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _sack_new_ack(tcb);
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -723,6 +888,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                     TCP_DEBUG_LEAVE;
                     return 0;
                 }
+                /* Duplicate ACK: the peer received data after a gap (RFC 5681) */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && !(ctl & MSK_FIN) &&
+                         seg_wnd == tcb->snd_wnd && tcb->pkt_retransmit != NULL) {
+                    _sack_dup_ack(tcb);
+                }
                 /* Update receive window */
                 if (LEQ_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     if (LSS_32_BIT(tcb->snd_wl1, seg_seq) || (tcb->snd_wl1 == seg_seq &&
@@ -767,32 +937,59 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
         /* 5) Check URG */
         /* NOTE: Add urgent pointer processing here ... */
 
+        /* RCV.NXT after the FIN */
+        uint32_t fin_end = seg_seq + seg_len;
+
+        /* A FIN is only processed after all data before it was received,
+         * which may be held in the out-of-order queue. Keep it until then. */
+        if (IS_USED(MODULE_GNRC_TCP_SACK) &&
+            (ctl & MSK_FIN) && LSS_32_BIT(tcb->rcv_nxt, seg_seq)) {
+            _gnrc_tcp_rcvbuf_ooo_fin(tcb, seg_seq + pay_len);
+            ctl &= ~MSK_FIN;
+        }
         /* 6) Process payload, if existing */
         if (pay_len > 0) {
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
-                /* Search for begin of payload */
-                snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
-
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
+                /* Accept only data that is expected, to be received. With the
+                 * out-of-order queue, accept data that continues at rcv_nxt,
+                 * even if it overlaps with data received before */
+                if ((tcb->rcv_nxt == seg_seq) ||
+                    (IS_USED(MODULE_GNRC_TCP_SACK) &&
+                     LSS_32_BIT(seg_seq, tcb->rcv_nxt) &&
+                     LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len))) {
                     /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
+                    _gnrc_tcp_rcvbuf_add(tcb, in_pkt, seg_seq);
+                    /* Continue with data that arrived out-of-order */
+                    _gnrc_tcp_rcvbuf_ooo_drain(tcb);
+                    /* ... up to a FIN that arrived out-of-order */
+                    if (_gnrc_tcp_rcvbuf_ooo_fin_due(tcb)) {
+                        ctl |= MSK_FIN;
+                        fin_end = tcb->rcv_nxt + 1;
                     }
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+                    /* Coalesce with the following segments, unless a gap is left */
+                    if (!(ctl & MSK_FIN) && _gnrc_tcp_rcvbuf_ooo_empty(tcb) &&
+                        _gro_defer_ack(tcb)) {
+                        TCP_DEBUG_LEAVE;
+                        return 0;
+                    }
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+                /* Hold data after a gap, until the gap is filled */
+                else if (LSS_32_BIT(tcb->rcv_nxt, seg_seq)) {
+                    _gnrc_tcp_rcvbuf_ooo_insert(tcb, in_pkt, seg_seq);
+                }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
                 if (!(ctl & MSK_FIN)) {
                     _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
                                         tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
                     _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                    _gro_ack_sent(tcb);
                 }
             }
         }
@@ -804,10 +1001,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 return 0;
             }
             /* Advance rcv_nxt over FIN bit */
-            tcb->rcv_nxt = seg_seq + seg_len;
+            tcb->rcv_nxt = fin_end;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
                                 tcb->rcv_nxt, NULL, 0);
             _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+            _gro_ack_sent(tcb);
 
             if (tcb->state == FSM_STATE_SYN_RCVD || tcb->state == FSM_STATE_ESTABLISHED) {
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
@@ -858,6 +1056,7 @@ static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
     if (tcb->pkt_retransmit != NULL) {
+        _sack_timeout(tcb);
         _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
         _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
     }
@@ -919,6 +1118,33 @@ static int _fsm_clear_retransmit(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief FSM Handling Function for sending a deferred ACK.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ */
+static int _fsm_send_ack(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if ((tcb->status & STATUS_ACK_PENDING) &&
+        (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
+         tcb->state == FSM_STATE_FIN_WAIT_2)) {
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint16_t seq_con = 0;
+        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                            tcb->rcv_nxt, NULL, 0);
+        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+
+        /* Notify owner because new data is available */
+        tcb->status |= STATUS_NOTIFY_USER;
+    }
+    _gro_ack_sent(tcb);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
 /**
  * @brief FSM function (not synchronized).
  *
@@ -973,6 +1199,9 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_CLEAR_RETRANSMIT :
             ret = _fsm_clear_retransmit(tcb);
             break;
+        case FSM_EVENT_SEND_ACK :
+            ret = _fsm_send_ack(tcb);
+            break;
     }
     TCP_DEBUG_LEAVE;
     return ret;
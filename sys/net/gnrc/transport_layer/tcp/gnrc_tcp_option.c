@@ -16,8 +16,10 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <string.h>
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_option.h"
+#include "include/gnrc_tcp_rcvbuf.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -64,6 +66,21 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_SACK_PERMITTED:
+                if (opt_left < TCP_OPTION_LENGTH_MIN ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERMITTED) {
+                    TCP_DEBUG_ERROR("Invalid SACK-Permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                /* Only valid in a SYN, see RFC 2018 section 2 */
+                if (IS_USED(MODULE_GNRC_TCP_SACK) &&
+                    (byteorder_ntohs(hdr->off_ctl) & MSK_SYN)) {
+                    TCP_DEBUG_INFO("SACK-Permitted option found.");
+                    tcb->status |= STATUS_SACK_PERMITTED;
+                }
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
@@ -83,3 +100,50 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     TCP_DEBUG_LEAVE;
     return 0;
 }
+
+uint8_t _gnrc_tcp_option_sack_size(const gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t blocks[2 * TCP_OPTION_SACK_BLOCKS_MAX];
+    unsigned numof = 0;
+
+    if (tcb->status & STATUS_SACK_PERMITTED) {
+        numof = _gnrc_tcp_rcvbuf_ooo_sack_blocks(tcb, blocks, TCP_OPTION_SACK_BLOCKS_MAX);
+    }
+    TCP_DEBUG_LEAVE;
+    /* Two NOPs, kind and length take up one word, each block two words */
+    return (numof > 0) ? (1 + (2 * numof)) : 0;
+}
+
+uint8_t _gnrc_tcp_option_build_sack(const gnrc_tcp_tcb_t *tcb, uint8_t *opt_ptr,
+                                    uint8_t opt_left)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t blocks[2 * TCP_OPTION_SACK_BLOCKS_MAX];
+    unsigned numof = 0;
+
+    if ((tcb->status & STATUS_SACK_PERMITTED) && (opt_left >= 4 + TCP_OPTION_LENGTH_SACK_BLOCK)) {
+        unsigned max = (opt_left - 4) / TCP_OPTION_LENGTH_SACK_BLOCK;
+
+        if (max > TCP_OPTION_SACK_BLOCKS_MAX) {
+            max = TCP_OPTION_SACK_BLOCKS_MAX;
+        }
+        numof = _gnrc_tcp_rcvbuf_ooo_sack_blocks(tcb, blocks, max);
+    }
+    if (numof == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    opt_ptr[0] = TCP_OPTION_KIND_NOP;
+    opt_ptr[1] = TCP_OPTION_KIND_NOP;
+    opt_ptr[2] = TCP_OPTION_KIND_SACK;
+    opt_ptr[3] = TCP_OPTION_LENGTH_MIN + (numof * TCP_OPTION_LENGTH_SACK_BLOCK);
+    for (unsigned i = 0; i < (2 * numof); i++) {
+        network_uint32_t edge = byteorder_htonl(blocks[i]);
+
+        memcpy(&opt_ptr[4 + (i * sizeof(edge))], &edge, sizeof(edge));
+    }
+    TCP_DEBUG_LEAVE;
+    return 4 + (numof * TCP_OPTION_LENGTH_SACK_BLOCK);
+}
@@ -180,6 +180,15 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     /* Add MSS option if SYN is sent */
     if (ctl & MSK_SYN) {
         offset += 1;
+        /* Add SACK-Permitted option, in a SYN+ACK only if the peer sent it */
+        if (IS_USED(MODULE_GNRC_TCP_SACK) &&
+            (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED))) {
+            offset += 1;
+        }
+    }
+    /* Add SACK option if an ACK is sent and out-of-order data is held */
+    else if (ctl & MSK_ACK) {
+        offset += _gnrc_tcp_option_sack_size(tcb);
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
@@ -217,6 +226,25 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+                opt_left -= sizeof(mss_option);
+
+                /* If there is space left: Add SACK-Permitted option */
+                if (opt_left >= sizeof(network_uint32_t)) {
+                    network_uint32_t sack_perm_option = byteorder_htonl(
+                        _gnrc_tcp_option_build_sack_permitted());
+
+                    memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+                    opt_ptr += sizeof(sack_perm_option);
+                    opt_left -= sizeof(sack_perm_option);
+                }
+            }
+            /* Otherwise it is an ACK: Add SACK option */
+            else {
+                uint8_t len = _gnrc_tcp_option_build_sack(tcb, opt_ptr, opt_left);
+
+                opt_ptr += len;
+                opt_left -= len;
             }
             /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
@@ -275,6 +303,68 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     return 0;
 }
 
+int _gnrc_tcp_pkt_set_gso(gnrc_pktsnip_t **out_pkt, uint16_t seg_size)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *net_snp = *out_pkt;
+
+    if (net_snp->type != GNRC_NETTYPE_NETIF) {
+        net_snp = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+        if (net_snp == NULL) {
+            TCP_DEBUG_ERROR("-ENOMEM: Can't allocate buffer for netif header.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
+        }
+        *out_pkt = gnrc_pkt_prepend(*out_pkt, net_snp);
+    }
+    gnrc_netif_hdr_set_gso(net_snp->data, seg_size);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+#if IS_USED(MODULE_GNRC_TCP_GSO)
+/**
+ * @brief Replaces a partially acknowledged super-segment in the retransmission
+ *        queue by its unacknowledged remainder.
+ *
+ * Otherwise a retransmission would repeat the acknowledged part, which the
+ * peer does not accept if it only takes segments starting at RCV.NXT.
+ *
+ * @param[in,out] tcb   TCB holding the retransmission queue.
+ * @param[in]     snp   TCP header of the super-segment.
+ * @param[in]     ack   Acknowledgment number within the super-segment.
+ */
+static void _trim_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *snp,
+                             uint32_t ack)
+{
+    tcp_hdr_t *hdr = (tcp_hdr_t *) snp->data;
+    gnrc_pktsnip_t *pay = snp->next;
+    uint32_t acked = ack - byteorder_ntohl(hdr->seq_num);
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl) & MSK_CTL;
+    uint16_t seg_size = 0;
+    gnrc_pktsnip_t *out_pkt = NULL;
+
+    /* Only data segments sent by _fsm_call_send() are trimmed */
+    if ((ctl & (MSK_SYN | MSK_FIN)) || (pay == NULL) || (pay->next != NULL) ||
+        (acked >= pay->size)) {
+        return;
+    }
+    if (tcb->pkt_retransmit->type == GNRC_NETTYPE_NETIF) {
+        seg_size = gnrc_netif_hdr_get_gso(tcb->pkt_retransmit->data);
+    }
+    _gnrc_tcp_pkt_build(tcb, &out_pkt, NULL, ctl, ack, tcb->rcv_nxt,
+                        (uint8_t *) pay->data + acked, pay->size - acked);
+    if ((out_pkt == NULL) || ((seg_size > 0) && (seg_size < pay->size - acked) &&
+                              (_gnrc_tcp_pkt_set_gso(&out_pkt, seg_size) < 0))) {
+        /* Keep the whole super-segment, if there is no space for the remainder */
+        gnrc_pktbuf_release(out_pkt);
+        return;
+    }
+    gnrc_pktbuf_release(tcb->pkt_retransmit);
+    tcb->pkt_retransmit = out_pkt;
+}
+#endif
+
 int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
                        const uint16_t seq_con, const bool retransmit)
 {
@@ -305,6 +395,28 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
     return 0;
 }
 
+#if IS_USED(MODULE_GNRC_TCP_SACK)
+int _gnrc_tcp_pkt_fast_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->pkt_retransmit == NULL) {
+        TCP_DEBUG_ERROR("-ENODATA: No packet to retransmit.");
+        TCP_DEBUG_LEAVE;
+        return -ENODATA;
+    }
+
+    /* Restart the retransmission timer without backoff */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+
+    /* Every send attempt consumes a user */
+    gnrc_pktbuf_hold(tcb->pkt_retransmit, 1);
+    TCP_DEBUG_LEAVE;
+    return _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+}
+#endif
+
 int _gnrc_tcp_pkt_chk_seq_num(const gnrc_tcp_tcb_t *tcb, const uint32_t seq_num,
                               const uint32_t seg_len)
 {
@@ -509,6 +621,12 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+#if IS_USED(MODULE_GNRC_TCP_GSO)
+    /* Super-segment was acknowledged in parts */
+    else if (LSS_32_BIT(byteorder_ntohl(hdr->seq_num), ack)) {
+        _trim_retransmit(tcb, snp, ack);
+    }
+#endif
     TCP_DEBUG_LEAVE;
     return 0;
 }
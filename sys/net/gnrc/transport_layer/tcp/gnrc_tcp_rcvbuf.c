@@ -19,7 +19,10 @@
 #include <mutex.h>
 #include <stdint.h>
 #include "net/gnrc/tcp/config.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/tcp.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_rcvbuf.h"
 
 #define ENABLE_DEBUG 0
@@ -124,3 +127,198 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seq)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UNDEF);
+    size_t skip = tcb->rcv_nxt - seq;
+    size_t added = 0;
+
+    /* Skip payload received before, copy the rest */
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        if (skip >= snp->size) {
+            skip -= snp->size;
+        }
+        else {
+            size_t len = snp->size - skip;
+            size_t res = ringbuffer_add(&(tcb->rcv_buf), (char *) snp->data + skip, len);
+
+            added += res;
+            skip = 0;
+            if (res < len) {
+                TCP_DEBUG_INFO("Receive buffer is full.");
+                break;
+            }
+        }
+        snp = snp->next;
+    }
+    tcb->rcv_nxt += added;
+    TCP_DEBUG_LEAVE;
+    return added;
+}
+
+#if IS_USED(MODULE_GNRC_TCP_SACK)
+/**
+ * @brief Extracts the sequence number of a segment.
+ *
+ * @param[in] pkt   Segment to extract the sequence number from.
+ *
+ * @returns   Sequence number of @p pkt.
+ */
+static uint32_t _ooo_seq(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+
+    return byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+}
+
+/**
+ * @brief Removes a segment from the out-of-order queue, keeping the order of
+ *        the remaining segments.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ * @param[in]     idx   Index of the segment to remove.
+ */
+static void _ooo_remove(gnrc_tcp_tcb_t *tcb, unsigned idx)
+{
+    gnrc_pktbuf_release(tcb->ooo_queue[idx]);
+    for (; idx < CONFIG_GNRC_TCP_OOO_QUEUE_SIZE - 1; idx++) {
+        tcb->ooo_queue[idx] = tcb->ooo_queue[idx + 1];
+    }
+    tcb->ooo_queue[CONFIG_GNRC_TCP_OOO_QUEUE_SIZE - 1] = NULL;
+}
+
+void _gnrc_tcp_rcvbuf_ooo_insert(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seq)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t len = _gnrc_tcp_pkt_get_pay_len(pkt);
+    unsigned numof = 0;
+    unsigned farthest = 0;
+
+    for (; numof < CONFIG_GNRC_TCP_OOO_QUEUE_SIZE && tcb->ooo_queue[numof]; numof++) {
+        gnrc_pktsnip_t *queued = tcb->ooo_queue[numof];
+        uint32_t queued_seq = _ooo_seq(queued);
+
+        /* Segment is already held */
+        if ((queued_seq == seq) && (_gnrc_tcp_pkt_get_pay_len(queued) >= len)) {
+            TCP_DEBUG_LEAVE;
+            return;
+        }
+        if (LSS_32_BIT(_ooo_seq(tcb->ooo_queue[farthest]), queued_seq)) {
+            farthest = numof;
+        }
+    }
+    if (numof == CONFIG_GNRC_TCP_OOO_QUEUE_SIZE) {
+        /* Queue is full: keep the segments closer to the gap */
+        if (!LSS_32_BIT(seq, _ooo_seq(tcb->ooo_queue[farthest]))) {
+            TCP_DEBUG_INFO("Out-of-order queue is full.");
+            TCP_DEBUG_LEAVE;
+            return;
+        }
+        _ooo_remove(tcb, farthest);
+        numof--;
+    }
+    gnrc_pktbuf_hold(pkt, 1);
+    tcb->ooo_queue[numof] = pkt;
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_rcvbuf_ooo_drain(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    unsigned i = 0;
+
+    while (i < CONFIG_GNRC_TCP_OOO_QUEUE_SIZE && tcb->ooo_queue[i]) {
+        gnrc_pktsnip_t *pkt = tcb->ooo_queue[i];
+        uint32_t seq = _ooo_seq(pkt);
+
+        if (LSS_32_BIT(tcb->rcv_nxt, seq)) {
+            i++;
+            continue;
+        }
+        if (LSS_32_BIT(tcb->rcv_nxt, seq + _gnrc_tcp_pkt_get_pay_len(pkt))) {
+            _gnrc_tcp_rcvbuf_add(tcb, pkt, seq);
+        }
+        _ooo_remove(tcb, i);
+        /* RCV.NXT advanced, earlier segments may continue at it now */
+        i = 0;
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_rcvbuf_ooo_clear(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    while (tcb->ooo_queue[0]) {
+        _ooo_remove(tcb, 0);
+    }
+    tcb->ooo_fin = false;
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_rcvbuf_ooo_fin(gnrc_tcp_tcb_t *tcb, uint32_t seq)
+{
+    TCP_DEBUG_ENTER;
+    tcb->ooo_fin_seq = seq;
+    tcb->ooo_fin = true;
+    TCP_DEBUG_LEAVE;
+}
+
+bool _gnrc_tcp_rcvbuf_ooo_fin_due(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    bool due = tcb->ooo_fin && (tcb->rcv_nxt == tcb->ooo_fin_seq);
+
+    if (due) {
+        tcb->ooo_fin = false;
+    }
+    TCP_DEBUG_LEAVE;
+    return due;
+}
+
+unsigned _gnrc_tcp_rcvbuf_ooo_sack_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t *blocks,
+                                          unsigned max)
+{
+    TCP_DEBUG_ENTER;
+    unsigned numof = 0;
+    int last = CONFIG_GNRC_TCP_OOO_QUEUE_SIZE - 1;
+
+    while (last >= 0 && tcb->ooo_queue[last] == NULL) {
+        last--;
+    }
+    /* Start a block at each segment, most recent first */
+    for (int i = last; i >= 0 && numof < max; i--) {
+        uint32_t left = _ooo_seq(tcb->ooo_queue[i]);
+        uint32_t right = left + _gnrc_tcp_pkt_get_pay_len(tcb->ooo_queue[i]);
+        bool grown = true;
+        bool covered = false;
+
+        /* Grow the block by all segments overlapping or adjoining it */
+        while (grown) {
+            grown = false;
+            for (int j = 0; j <= last; j++) {
+                uint32_t seq = _ooo_seq(tcb->ooo_queue[j]);
+                uint32_t end = seq + _gnrc_tcp_pkt_get_pay_len(tcb->ooo_queue[j]);
+
+                if (LEQ_32_BIT(seq, right) && LEQ_32_BIT(left, end) &&
+                    (LSS_32_BIT(seq, left) || LSS_32_BIT(right, end))) {
+                    left = LSS_32_BIT(seq, left) ? seq : left;
+                    right = LSS_32_BIT(right, end) ? end : right;
+                    grown = true;
+                }
+            }
+        }
+        for (unsigned j = 0; j < numof; j++) {
+            covered |= (blocks[2 * j] == left);
+        }
+        if (!covered) {
+            blocks[2 * numof] = left;
+            blocks[(2 * numof) + 1] = right;
+            numof++;
+        }
+    }
+    TCP_DEBUG_LEAVE;
+    return numof;
+}
+#endif
@@ -44,8 +44,16 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_ACK_PENDING    (1 << 5) /**< Internal: Status bitmask ACK_PENDING */
+#define STATUS_SACK_PERMITTED (1 << 6) /**< Internal: Status bitmask SACK_PERMITTED */
+#define STATUS_FAST_RECOVERY  (1 << 7) /**< Internal: Status bitmask FAST_RECOVERY */
 /** @} */
 
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit (RFC 5681).
+ */
+#define DUPACK_THRESHOLD (3U)
+
 /**
  * @brief Defines for "eventloop" thread settings.
  * @{
@@ -19,6 +19,7 @@
 * @author       Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "evtimer_msg.h"
@@ -57,6 +58,17 @@ void _gnrc_tcp_eventloop_sched(evtimer_msg_event_t *event, uint32_t offset,
  */
 void _gnrc_tcp_eventloop_unsched(evtimer_msg_event_t *event);
 
+/**
+ * @brief   Checks if more messages wait for the event loop
+ *
+ * Counts the received segments of a batch that are not processed yet as well.
+ *
+ * @note Only called from the eventloop.
+ *
+ * @returns True, if more messages or segments are queued.
+ */
+bool _gnrc_tcp_eventloop_pending(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,6 +41,27 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Maximum number of blocks in a SACK option.
+ *
+ * Four blocks fill the 40 bytes of option space, if no other option is sent.
+ */
+#define TCP_OPTION_SACK_BLOCKS_MAX (4U)
+
+/**
+ * @brief Helper function to build the SACK-Permitted option, preceded by two
+ *        NOP options for alignment.
+ *
+ * @returns   SACK-Permitted option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_permitted(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERMITTED << 8) |
+            TCP_OPTION_LENGTH_SACK_PERMITTED);
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -66,6 +87,31 @@ static inline uint16_t _gnrc_tcp_option_build_offset_control(uint16_t nopts, uin
  */
 int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
 
+/**
+ * @brief Calculates the size of the SACK option for the next ACK.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Size of the SACK option in multiples of 4 bytes.
+ *            Zero, if no SACK option is sent.
+ */
+uint8_t _gnrc_tcp_option_sack_size(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Writes the SACK option, preceded by two NOP options for alignment.
+ *
+ * The first block covers the most recently received out-of-order segment
+ * (RFC 2018, section 4).
+ *
+ * @param[in]  tcb       TCB holding the connection information.
+ * @param[out] opt_ptr   Option field to write to.
+ * @param[in]  opt_left  Size of @p opt_ptr in bytes.
+ *
+ * @returns   Number of bytes written.
+ */
+uint8_t _gnrc_tcp_option_build_sack(const gnrc_tcp_tcb_t *tcb, uint8_t *opt_ptr,
+                                    uint8_t opt_left);
+
 #ifdef __cplusplus
 }
 #endif
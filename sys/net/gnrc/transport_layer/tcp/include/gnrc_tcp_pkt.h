@@ -62,6 +62,20 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                         const uint32_t seq_num, const uint32_t ack_num,
                         void *payload, const size_t payload_len);
 
+/**
+ * @brief Marks a packet as super-segment, to be segmented by the network interface.
+ *
+ * @note Only effective with module gnrc_tcp_gso.
+ *
+ * @param[in,out] out_pkt    Packet built by _gnrc_tcp_pkt_build(). A network
+ *                           interface header is prepended, if missing.
+ * @param[in]     seg_size   Maximum payload size of each segment.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if pktbuf is full.
+ */
+int _gnrc_tcp_pkt_set_gso(gnrc_pktsnip_t **out_pkt, uint16_t seg_size);
+
 /**
  * @brief Sends packet to peer.
  *
@@ -76,6 +90,21 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
 int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
                        const uint16_t seq_con, const bool retransmit);
 
+/**
+ * @brief Retransmits the packet in the retransmit queue right away.
+ *
+ * Used on duplicate ACKs, the retransmission timer is restarted without
+ * backoff.
+ *
+ * @note Only available with module gnrc_tcp_sack.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ *            -ENODATA if the retransmit queue is empty.
+ */
+int _gnrc_tcp_pkt_fast_retransmit(gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Verify sequence number.
  *
@@ -14,11 +14,16 @@
  * @{
  *
  * @file
- * @brief       Functions for allocating and freeing the receive buffer.
+ * @brief       Functions for allocating, freeing and filling the receive buffer.
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "kernel_defines.h"
+#include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
@@ -47,6 +52,141 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Copies the payload of a segment, starting at RCV.NXT, into the
+ *        receive buffer and advances RCV.NXT accordingly.
+ *
+ * @pre `seq <= tcb->rcv_nxt`
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[in]     pkt   Received segment.
+ * @param[in]     seq   Sequence number of the segment.
+ *
+ * @returns   Number of bytes copied into the receive buffer.
+ */
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seq);
+
+#if IS_USED(MODULE_GNRC_TCP_SACK) || defined(DOXYGEN)
+/**
+ * @brief Holds a segment received after a gap in the out-of-order queue.
+ *
+ * If the queue is full, the segment farthest from RCV.NXT is dropped.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ * @param[in]     pkt   Received segment, a reference to it is held.
+ * @param[in]     seq   Sequence number of the segment.
+ */
+void _gnrc_tcp_rcvbuf_ooo_insert(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seq);
+
+/**
+ * @brief Moves segments from the out-of-order queue into the receive buffer,
+ *        as far as they continue at RCV.NXT.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ */
+void _gnrc_tcp_rcvbuf_ooo_drain(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Releases all segments in the out-of-order queue and forgets a FIN
+ *        received after a gap.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ */
+void _gnrc_tcp_rcvbuf_ooo_clear(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Keeps the sequence number of a FIN received after a gap.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ * @param[in]     seq   Sequence number of the FIN.
+ */
+void _gnrc_tcp_rcvbuf_ooo_fin(gnrc_tcp_tcb_t *tcb, uint32_t seq);
+
+/**
+ * @brief Checks if all data before a FIN received after a gap arrived.
+ *
+ * The FIN is forgotten then, so it is processed only once.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ *
+ * @returns   True, if RCV.NXT reached the FIN.
+ */
+bool _gnrc_tcp_rcvbuf_ooo_fin_due(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Checks if the out-of-order queue is empty.
+ *
+ * @param[in] tcb   TCB holding the out-of-order queue.
+ *
+ * @returns   True, if no segment is held.
+ */
+static inline bool _gnrc_tcp_rcvbuf_ooo_empty(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->ooo_queue[0] == NULL;
+}
+
+/**
+ * @brief Calculates the blocks of contiguous data in the out-of-order queue.
+ *
+ * The first block contains the most recently received segment, the
+ * following ones the next recently received segments not yet covered.
+ *
+ * @param[in]  tcb      TCB holding the out-of-order queue.
+ * @param[out] blocks   Left and right edge of each block.
+ * @param[in]  max      Maximum number of blocks, @p blocks holds 2 * @p max
+ *                      sequence numbers.
+ *
+ * @returns   Number of blocks.
+ */
+unsigned _gnrc_tcp_rcvbuf_ooo_sack_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t *blocks,
+                                          unsigned max);
+#else
+static inline void _gnrc_tcp_rcvbuf_ooo_insert(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
+                                               uint32_t seq)
+{
+    (void)tcb;
+    (void)pkt;
+    (void)seq;
+}
+
+static inline void _gnrc_tcp_rcvbuf_ooo_drain(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline void _gnrc_tcp_rcvbuf_ooo_clear(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline void _gnrc_tcp_rcvbuf_ooo_fin(gnrc_tcp_tcb_t *tcb, uint32_t seq)
+{
+    (void)tcb;
+    (void)seq;
+}
+
+static inline bool _gnrc_tcp_rcvbuf_ooo_fin_due(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+    return false;
+}
+
+static inline bool _gnrc_tcp_rcvbuf_ooo_empty(const gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+    return true;
+}
+
+static inline unsigned _gnrc_tcp_rcvbuf_ooo_sack_blocks(const gnrc_tcp_tcb_t *tcb,
+                                                        uint32_t *blocks, unsigned max)
+{
+    (void)tcb;
+    (void)blocks;
+    (void)max;
+    return 0;
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,14 +22,19 @@
 #include <errno.h>
 
 #include "byteorder.h"
+#include "kernel_defines.h"
 #include "msg.h"
 #include "thread.h"
 #include "utlist.h"
 #include "net/ipv6/hdr.h"
 #include "net/gnrc/udp.h"
 #include "net/gnrc.h"
+#include "net/gnrc/netapi/batch.h"
 #include "net/gnrc/icmpv6/error.h"
 #include "net/inet_csum.h"
+#ifdef MODULE_GNRC_SINGLE_THREAD
+#include "net/gnrc/single_thread.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -39,11 +44,21 @@
  */
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   UDP as a layer of the stack thread
+ */
+static gnrc_single_thread_layer_t _layer = { .netapi_cb = _netapi_cb };
+static gnrc_netreg_entry_t _netreg;
+#else
 /**
  * @brief   Allocate memory for the UDP thread's stack
  */
 static char _stack[GNRC_UDP_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 static msg_t _msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
+#endif
 
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
@@ -217,6 +232,21 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt)
+{
+    switch (cmd) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            _receive(pkt);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            _send(pkt);
+            break;
+        default:
+            break;
+    }
+}
+#else
 static void *_event_loop(void *arg)
 {
     (void)arg;
@@ -229,6 +259,9 @@ static void *_event_loop(void *arg)
     /* initialize message queue */
     msg_init_queue(_msg_queue, GNRC_UDP_MSG_QUEUE_SIZE);
     /* register UPD at netreg */
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    netreg.batch = true;
+#endif
     gnrc_netreg_register(GNRC_NETTYPE_UDP, &netreg);
 
     /* dispatch NETAPI messages */
@@ -239,6 +272,15 @@ static void *_event_loop(void *arg)
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
                 _receive(msg.content.ptr);
                 break;
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV_BATCH\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr); i++) {
+                    _receive(gnrc_netapi_batch_get(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
                 _send(msg.content.ptr);
@@ -256,6 +298,7 @@ static void *_event_loop(void *arg)
     /* never reached */
     return NULL;
 }
+#endif
 
 int gnrc_udp_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr)
 {
@@ -301,9 +344,18 @@ int gnrc_udp_init(void)
 {
     /* check if thread is already running */
     if (_pid == KERNEL_PID_UNDEF) {
+#if IS_USED(MODULE_GNRC_SINGLE_THREAD)
+        /* run UDP in the stack thread */
+        _pid = gnrc_single_thread_init();
+        gnrc_single_thread_add(&_layer);
+        gnrc_single_thread_entry_init(&_netreg, GNRC_NETREG_DEMUX_CTX_ALL,
+                                      &_layer);
+        gnrc_netreg_register(GNRC_NETTYPE_UDP, &_netreg);
+#else
         /* start UDP thread */
         _pid = thread_create(_stack, sizeof(_stack), GNRC_UDP_PRIO,
                              0, _event_loop, NULL, "udp");
+#endif
     }
     return _pid;
 }
@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_sched_trace
+ * @{
+ *
+ * @file
+ * @brief       Scheduler event trace implementation
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "sched_trace.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define _MASK       (SCHED_TRACE_BUFSIZE - 1)
+#define _PER_LINE   (8U)
+
+static sched_trace_entry_t _ring[SCHED_TRACE_BUFSIZE];
+/* number of entries ever written, the newest is at (_pos - 1) & _MASK */
+static uint32_t _pos;
+/* time of the newest entry */
+static uint32_t _last;
+static bool _enabled;
+
+static inline void _put(sched_trace_event_t event, kernel_pid_t pid,
+                        uint16_t delta, uint32_t arg)
+{
+    _ring[_pos++ & _MASK] = (sched_trace_entry_t){
+        .delta = delta, .event = event, .pid = (uint8_t)pid, .arg = arg,
+    };
+}
+
+void sched_trace_record(sched_trace_event_t event, kernel_pid_t pid,
+                        uint32_t arg)
+{
+    unsigned state = irq_disable();
+
+    if (_enabled) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+        uint32_t delta = now - _last;
+
+        _last = now;
+        if (delta > UINT16_MAX) {
+            _put(SCHED_TRACE_TIME, KERNEL_PID_UNDEF, 0, delta);
+            delta = 0;
+        }
+        _put(event, pid, delta, arg);
+    }
+    irq_restore(state);
+}
+
+void sched_trace_dump(void)
+{
+    unsigned state = irq_disable();
+    bool enabled = _enabled;
+
+    /* printing sends messages and locks mutexes itself */
+    _enabled = false;
+    irq_restore(state);
+
+    uint32_t numof = (_pos > SCHED_TRACE_BUFSIZE) ? SCHED_TRACE_BUFSIZE : _pos;
+
+    printf("sched_trace: begin %" PRIu32 " %" PRIu32 " %" PRIu32 " us\n",
+           numof, _pos - numof, _last);
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = thread_get(pid);
+
+        if (thread != NULL) {
+            const char *name = thread_get_name(thread);
+
+            printf("sched_trace: thread %u %s\n", (unsigned)pid,
+                   name ? name : "-");
+        }
+    }
+    for (uint32_t i = 0; i < numof; i++) {
+        const sched_trace_entry_t *e = &_ring[(_pos - numof + i) & _MASK];
+
+        if ((i % _PER_LINE) == 0) {
+            printf("sched_trace:");
+        }
+        printf(" %04x%02x%02x%08" PRIx32, e->delta, e->event, e->pid, e->arg);
+        if (((i % _PER_LINE) == (_PER_LINE - 1)) || (i == (numof - 1))) {
+            puts("");
+        }
+    }
+    puts("sched_trace: end");
+
+    state = irq_disable();
+    _enabled = enabled;
+    irq_restore(state);
+}
+
+void sched_trace_reset(void)
+{
+    unsigned state = irq_disable();
+
+    _pos = 0;
+    irq_restore(state);
+}
+
+void sched_trace_init(void)
+{
+    ztimer_acquire(ZTIMER_USEC);
+    _last = ztimer_now(ZTIMER_USEC);
+    _enabled = true;
+}
@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_tsrb_spsc
+ * @{
+ * @file
+ * @brief       Lock-free single-producer/single-consumer ringbuffer
+ *              implementation
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "tsrb_spsc.h"
+
+/* copies n bytes starting at ring index idx to dst, wrapping at most once */
+static void _copy_out(const tsrb_t *rb, unsigned idx, uint8_t *dst, size_t n)
+{
+    size_t pos = idx & (rb->size - 1);
+    size_t first = rb->size - pos;
+
+    if (first > n) {
+        first = n;
+    }
+    memcpy(dst, &rb->buf[pos], first);
+    memcpy(dst + first, rb->buf, n - first);
+}
+
+int tsrb_spsc_get(tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    /* reads is only ever changed by the consumer, i.e. the caller */
+    unsigned reads = rb->reads;
+    size_t avail = atomic_load_unsigned(&rb->writes) - reads;
+
+    if (n > avail) {
+        n = avail;
+    }
+    _copy_out(rb, reads, dst, n);
+    atomic_store_unsigned(&rb->reads, reads + n);
+    return (int)n;
+}
+
+int tsrb_spsc_peek(tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    unsigned reads = rb->reads;
+    size_t avail = atomic_load_unsigned(&rb->writes) - reads;
+
+    if (n > avail) {
+        n = avail;
+    }
+    _copy_out(rb, reads, dst, n);
+    return (int)n;
+}
+
+int tsrb_spsc_drop(tsrb_t *rb, size_t n)
+{
+    unsigned reads = rb->reads;
+    size_t avail = atomic_load_unsigned(&rb->writes) - reads;
+
+    if (n > avail) {
+        n = avail;
+    }
+    atomic_store_unsigned(&rb->reads, reads + n);
+    return (int)n;
+}
+
+int tsrb_spsc_add(tsrb_t *rb, const uint8_t *src, size_t n)
+{
+    /* writes is only ever changed by the producer, i.e. the caller */
+    unsigned writes = rb->writes;
+    size_t space = rb->size - (writes - atomic_load_unsigned(&rb->reads));
+    size_t pos = writes & (rb->size - 1);
+    size_t first = rb->size - pos;
+
+    if (n > space) {
+        n = space;
+    }
+    if (first > n) {
+        first = n;
+    }
+    memcpy(&rb->buf[pos], src, first);
+    memcpy(rb->buf, src + first, n - first);
+    /* publish the data only after it has been copied */
+    atomic_store_unsigned(&rb->writes, writes + n);
+    return (int)n;
+}
@@ -38,18 +38,327 @@
 #include "debug.h"
 
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static void _list_add(ztimer_clock_t *clock, ztimer_base_t *entry);
 static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock);
 
-#ifdef MODULE_ZTIMER_EXTEND
+#if MODULE_ZTIMER_EXTEND || MODULE_ZTIMER_WHEEL || MODULE_ZTIMER_SLACK
 static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 {
     return a < b ? a : b;
 }
 #endif
 
+#if MODULE_ZTIMER_SLACK
+static inline uint32_t _add_sat_u32(uint32_t a, uint32_t b)
+{
+    return (a > UINT32_MAX - b) ? UINT32_MAX : a + b;
+}
+
+/* Returns the offset from the list's base to set the alarm to: the latest
+ * time within the slack of the list head and of all timers due until then. */
+static uint32_t _list_deadline(const ztimer_clock_t *clock)
+{
+    const ztimer_base_t *entry = clock->list.next;
+    uint32_t target = entry->offset;
+    uint32_t deadline = _add_sat_u32(target, ((ztimer_t *)entry)->slack);
+
+    while ((entry = entry->next) && (entry->offset <= deadline - target)) {
+        target += entry->offset;
+        deadline = _min_u32(deadline,
+                            _add_sat_u32(target, ((ztimer_t *)entry)->slack));
+    }
+
+    return deadline;
+}
+#endif
+
+static inline void _count_fired(ztimer_clock_t *clock, unsigned numof)
+{
+#if MODULE_ZTIMER_SLACK
+    if (numof) {
+        clock->slack_stats.fired++;
+        clock->slack_stats.coalesced += numof - 1;
+    }
+#else
+    (void)clock;
+    (void)numof;
+#endif
+}
+
+#if MODULE_ZTIMER_WHEEL
+#define WHEEL_SLOT_MASK     (ZTIMER_WHEEL_SLOTS - 1)
+
+/* terminates the timers in a wheel slot, so that only the list's last timer
+ * has no next timer and ztimer_is_set() needs no search for unset timers */
+static ztimer_base_t _wheel_end;
+
+static inline unsigned _wheel_shift(unsigned level)
+{
+    return CONFIG_ZTIMER_WHEEL_NEAR_BITS + level * ZTIMER_WHEEL_SLOT_BITS;
+}
+
+static inline unsigned _msb_u32(uint32_t v)
+{
+    return (sizeof(unsigned long) * 8 - 1) - __builtin_clzl(v);
+}
+
+static bool _wheel_is_empty(const ztimer_clock_t *clock)
+{
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        if (clock->wheel.pending[level]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Puts @p entry (with its absolute target time stored in entry->offset) into
+ * the slot matching its target relative to the wheel's current time, or into
+ * the sorted list if it is due within the current near window or the list is
+ * still short. */
+static void _wheel_place(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = &clock->wheel;
+    uint32_t target = entry->offset;
+    uint32_t diff = target ^ wheel->now;
+    unsigned level;
+
+    if ((wheel->list_len < CONFIG_ZTIMER_WHEEL_LIST_LEN) ||
+        ((target >= wheel->now) && !(diff >> CONFIG_ZTIMER_WHEEL_NEAR_BITS))) {
+        /* offset relative to the list's base, which may be ahead of the
+         * wheel's time if the entry is due already */
+        uint32_t rel = target - wheel->now;
+        uint32_t elapsed = clock->list.offset - wheel->now;
+
+        entry->offset = (rel > elapsed) ? rel - elapsed : 0;
+        _list_add(clock, entry);
+        return;
+    }
+
+    if (target < wheel->now) {
+        /* target lies in the next wrap of the 32bit time, which only the
+         * topmost level can represent */
+        level = ZTIMER_WHEEL_LEVELS - 1;
+    }
+    else {
+        level = (_msb_u32(diff) - CONFIG_ZTIMER_WHEEL_NEAR_BITS) /
+                ZTIMER_WHEEL_SLOT_BITS;
+    }
+
+    unsigned slot = (target >> _wheel_shift(level)) & WHEEL_SLOT_MASK;
+    ztimer_base_t **head = &wheel->slots[level][slot];
+
+    entry->next = *head ? *head : &_wheel_end;
+    if (_wheel_is_empty(clock)) {
+        wheel->next = target;
+        wheel->next_valid = true;
+    }
+    else if (target - wheel->now < wheel->next - wheel->now) {
+        wheel->next = target;
+    }
+    *head = entry;
+    wheel->pending[level] |= 1UL << slot;
+
+    DEBUG("_wheel_place() %p target %" PRIu32 " level %u slot %u\n",
+          (void *)entry, target, level, slot);
+}
+
+/* Returns the pointer referencing @p entry in its wheel slot and stores the
+ * slot's level and index, or NULL if @p entry is not stored in the wheel.
+ * A timer can only be stored in the slot its target maps to on one of the
+ * levels, so only those are searched. Nothing but the address of @p entry
+ * and its offset is used, so timers never set before need not be
+ * initialized. */
+static ztimer_base_t **_wheel_find(ztimer_clock_t *clock,
+                                   const ztimer_base_t *entry,
+                                   unsigned *level, unsigned *slot)
+{
+    ztimer_wheel_t *wheel = &clock->wheel;
+
+    for (unsigned l = 0; l < ZTIMER_WHEEL_LEVELS; l++) {
+        unsigned s = (entry->offset >> _wheel_shift(l)) & WHEEL_SLOT_MASK;
+
+        if (!(wheel->pending[l] & (1UL << s))) {
+            continue;
+        }
+        for (ztimer_base_t **link = &wheel->slots[l][s]; *link != &_wheel_end;
+             link = &(*link)->next) {
+            if (*link == entry) {
+                *level = l;
+                *slot = s;
+                return link;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static void _wheel_unlink(ztimer_clock_t *clock, ztimer_base_t *entry,
+                          ztimer_base_t **link, unsigned level, unsigned slot)
+{
+    ztimer_wheel_t *wheel = &clock->wheel;
+
+    if (entry->offset == wheel->next) {
+        /* the target is still a lower bound for the remaining timers */
+        wheel->next_valid = false;
+    }
+    *link = entry->next;
+    if (wheel->slots[level][slot] == &_wheel_end) {
+        /* entry was the only one in its slot */
+        wheel->slots[level][slot] = NULL;
+        wheel->pending[level] &= ~(1UL << slot);
+    }
+
+    entry->next = NULL;
+}
+
+/* Returns the ticks from the wheel's time to the start of the earliest
+ * non-empty slot and stores that slot's level and index. */
+static uint32_t _wheel_next_slot(const ztimer_clock_t *clock, unsigned *level,
+                                 unsigned *slot)
+{
+    const ztimer_wheel_t *wheel = &clock->wheel;
+    uint32_t next = UINT32_MAX;
+
+    for (unsigned l = 0; l < ZTIMER_WHEEL_LEVELS; l++) {
+        uint32_t pending = wheel->pending[l];
+        if (!pending) {
+            continue;
+        }
+
+        unsigned shift = _wheel_shift(l);
+        unsigned cur = (wheel->now >> shift) & WHEEL_SLOT_MASK;
+        /* search the slots after the current one first, only the topmost
+         * level may contain wrapped around slots at or before it */
+        uint32_t later = (cur == WHEEL_SLOT_MASK) ? 0 : pending & (UINT32_MAX << (cur + 1));
+        unsigned s = __builtin_ctzl(later ? later : pending);
+        uint32_t span = (shift + ZTIMER_WHEEL_SLOT_BITS >= 32)
+                        ? UINT32_MAX
+                        : (1UL << (shift + ZTIMER_WHEEL_SLOT_BITS)) - 1;
+        uint32_t start = ((uint32_t)s << shift) - (wheel->now & span);
+
+        if (start < next) {
+            next = start;
+            *level = l;
+            *slot = s;
+        }
+    }
+
+    return next;
+}
+
+/* Returns the ticks from the wheel's time to the earliest timer in the wheel,
+ * which is stored in the earliest slot @p level / @p slot as slots never
+ * overlap. If the earliest timer has been removed, its target is used as a
+ * lower bound until the clock reaches it, and the slot is searched only then. */
+static uint32_t _wheel_next_target(ztimer_clock_t *clock, unsigned level,
+                                   unsigned slot)
+{
+    ztimer_wheel_t *wheel = &clock->wheel;
+
+    if (!wheel->next_valid && (wheel->next == clock->list.offset)) {
+        uint32_t next = UINT32_MAX;
+
+        for (const ztimer_base_t *entry = wheel->slots[level][slot];
+             entry != &_wheel_end; entry = entry->next) {
+            next = _min_u32(next, entry->offset - wheel->now);
+        }
+        wheel->next = wheel->now + next;
+        wheel->next_valid = true;
+    }
+
+    return wheel->next - wheel->now;
+}
+
+/* Moves all slots whose start time has been reached to the list or to lower
+ * levels. The list's base must have been updated to the current time. */
+static void _wheel_advance(ztimer_clock_t *clock)
+{
+    ztimer_wheel_t *wheel = &clock->wheel;
+    uint32_t elapsed = clock->list.offset - wheel->now;
+    unsigned level, slot;
+
+    if (wheel->next - wheel->now < elapsed) {
+        /* the lower bound has been reached, all timers left in the wheel are
+         * due after the current time */
+        wheel->next = clock->list.offset;
+    }
+
+    while (!_wheel_is_empty(clock)) {
+        uint32_t next = _wheel_next_slot(clock, &level, &slot);
+        if (next > clock->list.offset - wheel->now) {
+            break;
+        }
+
+        wheel->now += next;
+        ztimer_base_t *entry = wheel->slots[level][slot];
+        wheel->slots[level][slot] = NULL;
+        wheel->pending[level] &= ~(1UL << slot);
+        wheel->next_valid = false;
+
+        DEBUG("_wheel_advance(): cascading level %u slot %u at %" PRIu32 "\n",
+              level, slot, wheel->now);
+        while (entry != &_wheel_end) {
+            ztimer_base_t *tmp = entry->next;
+            _wheel_place(clock, entry);
+            entry = tmp;
+        }
+    }
+
+    wheel->now = clock->list.offset;
+}
+#endif /* MODULE_ZTIMER_WHEEL */
+
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+static bool _clock_is_empty(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (!_wheel_is_empty(clock)) {
+        return false;
+    }
+#endif
+    return clock->list.next == NULL;
+}
+#endif
+
+/* Stores the offset of the earliest pending timer relative to the list's base
+ * time in @p offset, returns false if no timer is set. */
+static bool _next_offset(ztimer_clock_t *clock, uint32_t *offset)
+{
+    bool found = false;
+
+    if (clock->list.next) {
+#if MODULE_ZTIMER_SLACK
+        *offset = _list_deadline(clock);
+#else
+        *offset = clock->list.next->offset;
+#endif
+        found = true;
+    }
+#if MODULE_ZTIMER_WHEEL
+    if (!_wheel_is_empty(clock)) {
+        unsigned level, slot;
+        /* the list's base never passes a pending slot's start time */
+        uint32_t elapsed = clock->list.offset - clock->wheel.now;
+        uint32_t next = _wheel_next_slot(clock, &level, &slot) - elapsed;
+
+        /* no timer in the wheel is due before its earliest slot starts */
+        if (!found || (next < *offset)) {
+            uint32_t target = _wheel_next_target(clock, level, slot) - elapsed;
+
+            next = (target > next) ? target : next;
+            *offset = found ? _min_u32(*offset, next) : next;
+            found = true;
+        }
+    }
+#endif
+    return found;
+}
+
 #if MODULE_ZTIMER_ONDEMAND
 static bool _ztimer_acquire(ztimer_clock_t *clock)
 {
@@ -114,6 +423,16 @@ bool ztimer_release(ztimer_clock_t *clock)
 
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (!clock->list.next && t->base.next) {
+        unsigned level, slot;
+
+        /* only timers in the wheel are left, _wheel_find() does not modify
+         * the clock */
+        return _wheel_find((ztimer_clock_t *)clock, &t->base, &level,
+                           &slot) != NULL;
+    }
+#endif
     if (!clock->list.next) {
         return 0;
     }
@@ -156,7 +475,8 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
     return was_removed;
 }
 
-uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+static uint32_t _set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                     uint32_t slack)
 {
     unsigned state = irq_disable();
 
@@ -192,6 +512,11 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     }
 
     timer->base.offset = val;
+#if MODULE_ZTIMER_SLACK
+    timer->slack = slack;
+#else
+    (void)slack;
+#endif
     _add_entry_to_list(clock, &timer->base);
     _ztimer_update(clock);
 
@@ -213,20 +538,52 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 {
-    uint32_t delta_sum = 0;
+    return _set(clock, timer, val, 0);
+}
 
-    ztimer_base_t *list = &clock->list;
+#if MODULE_ZTIMER_SLACK
+uint32_t ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t val, uint32_t slack)
+{
+    return _set(clock, timer, val, slack);
+}
+
+void ztimer_slack_stats(ztimer_clock_t *clock, ztimer_slack_stats_t *stats)
+{
+    unsigned state = irq_disable();
+
+    *stats = clock->slack_stats;
+    irq_restore(state);
+}
+#endif
 
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
-    /* First timer on the clock's linked list */
-    if (list->next == NULL &&
+    /* First timer on the clock */
+    if (_clock_is_empty(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_block(clock->block_pm_mode);
     }
 #endif
 
+#if MODULE_ZTIMER_WHEEL
+    /* the list's base and the wheel's time are both "now" at this point */
+    entry->offset += clock->list.offset;
+    _wheel_place(clock, entry);
+#else
+    _list_add(clock, entry);
+#endif
+}
+
+static void _list_add(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    uint32_t delta_sum = 0;
+
+    ztimer_base_t *list = &clock->list;
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -247,6 +604,9 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
         clock->last = entry;
     }
     list->next = entry;
+#if MODULE_ZTIMER_WHEEL
+    clock->wheel.list_len++;
+#endif
     DEBUG("_add_entry_to_list() %p offset %" PRIu32 "\n", (void *)entry,
           entry->offset);
 
@@ -323,6 +683,9 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
     }
 
     clock->list.offset = now;
+#if MODULE_ZTIMER_WHEEL
+    _wheel_advance(clock);
+#endif
     return now;
 }
 
@@ -335,7 +698,19 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
-    while (list->next) {
+#if MODULE_ZTIMER_WHEEL
+    unsigned level, slot;
+    ztimer_base_t **link = _wheel_find(clock, entry, &level, &slot);
+
+    if (link) {
+        /* entry is stored in a wheel slot, no need to walk the list */
+        _wheel_unlink(clock, entry, link, level, slot);
+        was_removed = true;
+        list = NULL;
+    }
+#endif
+
+    while (list && list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
             if (entry == clock->last) {
@@ -351,6 +726,9 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
             }
 
             was_removed = true;
+#if MODULE_ZTIMER_WHEEL
+            clock->wheel.list_len--;
+#endif
             /* reset the entry's next pointer so _is_set() considers it unset */
             entry->next = NULL;
             break;
@@ -359,8 +737,8 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     }
 
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
-    /* The last timer just got removed from the clock's linked list */
-    if (clock->list.next == NULL &&
+    /* The last timer just got removed from the clock */
+    if (_clock_is_empty(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_unblock(clock->block_pm_mode);
     }
@@ -375,11 +753,15 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
 
     if (entry && (entry->offset == 0)) {
         clock->list.next = entry->next;
+#if MODULE_ZTIMER_WHEEL
+        clock->wheel.list_len--;
+#endif
         if (!entry->next) {
             /* The last timer just got removed from the clock's linked list */
             clock->last = NULL;
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
-            if (clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            if (_clock_is_empty(clock) &&
+                clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
                 pm_unblock(clock->block_pm_mode);
             }
 #endif
@@ -397,12 +779,12 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
 
 static void _ztimer_update(ztimer_clock_t *clock)
 {
+    uint32_t offset;
+
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
-            clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
-                                     clock->max_value >> 1));
+        if (_next_offset(clock, &offset)) {
+            clock->ops->set(clock, _min_u32(offset, clock->max_value >> 1));
         }
         else {
             clock->ops->set(clock, clock->max_value >> 1);
@@ -412,8 +794,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (_next_offset(clock, &offset)) {
+            clock->ops->set(clock, offset);
         }
         else {
             clock->ops->cancel(clock);
@@ -435,9 +817,10 @@ void ztimer_handler(ztimer_clock_t *clock)
     if (clock->max_value < UINT32_MAX) {
         /* calling now triggers checkpointing */
         uint32_t now = ztimer_now(clock);
+        uint32_t offset;
 
-        if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+        if (_next_offset(clock, &offset)) {
+            uint32_t target = clock->list.offset + offset;
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -461,16 +844,30 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 #endif
 
+#if MODULE_ZTIMER_WHEEL
+    /* the alarm may have been set for a timer in a wheel slot, so cascade that
+     * slot and only trigger what is actually due */
+    _ztimer_update_head_offset(clock);
+    if (clock->list.next && (clock->list.next->offset == 0)) {
+#else
     if (clock->list.next) {
+#if MODULE_ZTIMER_SLACK
+        /* the alarm may have been set after the list head, within its slack,
+         * so trigger all timers due by now */
+        _ztimer_update_head_offset(clock);
+#endif
         clock->list.offset += clock->list.next->offset;
         clock->list.next->offset = 0;
+#endif
 
+        unsigned numof = 0;
         ztimer_t *entry = _now_next(clock);
         while (entry) {
             DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
                   (void *)entry, (void *)entry->base.next, clock->ops->now(
                       clock));
             entry->callback(entry->arg);
+            numof++;
 #if MODULE_ZTIMER_ONDEMAND
             no_clock_user_left = ztimer_release(clock);
             if (no_clock_user_left) {
@@ -485,6 +882,7 @@ void ztimer_handler(ztimer_clock_t *clock)
                 entry = _now_next(clock);
             }
         }
+        _count_fired(clock, numof);
     }
 
     /* only arm the clock if there are users left requiring the clock */
@@ -515,6 +913,13 @@ static void _ztimer_print(const ztimer_clock_t *clock)
 
     } while ((entry = entry->next));
     puts("");
+#if MODULE_ZTIMER_WHEEL
+    printf("wheel @%" PRIu32 ":", clock->wheel.now);
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        printf(" 0x%08" PRIx32, clock->wheel.pending[level]);
+    }
+    puts("");
+#endif
 }
 
 #if MODULE_ZTIMER_ONDEMAND && DEVELHELP
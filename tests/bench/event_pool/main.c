@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the event thread pool
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "event/pool.h"
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef WORKERS
+#define WORKERS         (4U)
+#endif
+
+#ifndef EVENTS
+#define EVENTS          (32U)
+#endif
+
+#define WAIT_US         (500U)
+#define COMPUTE_ROUNDS  (20000U)
+#define POST_ROUNDS     (200U)
+
+typedef struct {
+    event_pool_t pool;
+    event_pool_worker_t workers[WORKERS];
+    char stacks[WORKERS][THREAD_STACKSIZE_DEFAULT];
+} _pool_t;
+
+static _pool_t _single;
+static _pool_t _multi;
+static event_t _events[EVENTS];
+static event_t *_batch[EVENTS];
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static unsigned _pending;
+static volatile uint32_t _sink;
+
+static void _finish(void)
+{
+    unsigned state = irq_disable();
+    bool last = (--_pending == 0);
+
+    irq_restore(state);
+    if (last) {
+        mutex_unlock(&_done);
+    }
+}
+
+/* e.g. waiting for a bus transfer or a reply */
+static void _wait(event_t *event)
+{
+    (void)event;
+    ztimer_sleep(ZTIMER_USEC, WAIT_US);
+    _finish();
+}
+
+/* e.g. hashing or encoding */
+static void _compute(event_t *event)
+{
+    uint32_t x = (uintptr_t)event;
+
+    for (unsigned i = 0; i < COMPUTE_ROUNDS; i++) {
+        x = x * 1103515245U + 12345U;
+    }
+    _sink = x;
+    _finish();
+}
+
+static void _nop(event_t *event)
+{
+    (void)event;
+    _finish();
+}
+
+static uint32_t _run(_pool_t *p, event_handler_t handler, bool batch)
+{
+    _pending = EVENTS;
+    for (unsigned i = 0; i < EVENTS; i++) {
+        _events[i].handler = handler;
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    if (batch) {
+        event_pool_post_batch(&p->pool, _batch, EVENTS);
+    }
+    else {
+        for (unsigned i = 0; i < EVENTS; i++) {
+            event_pool_post(&p->pool, &_events[i]);
+        }
+    }
+    mutex_lock(&_done);
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static void _print(const char *name, _pool_t *p, event_handler_t handler)
+{
+    uint32_t usec = _run(p, handler, true);
+
+    printf("%8s %2u workers: %6" PRIu32 " us\n", name, p->pool.numof, usec);
+}
+
+static void _print_post(bool batch)
+{
+    uint32_t usec = 0;
+
+    for (unsigned i = 0; i < POST_ROUNDS; i++) {
+        usec += _run(&_multi, _nop, batch);
+    }
+    printf("%8s %2u workers: %6" PRIu32 " ns/event\n",
+           batch ? "batch" : "post", WORKERS,
+           (uint32_t)(((uint64_t)usec * 1000U) / (POST_ROUNDS * EVENTS)));
+}
+
+int main(void)
+{
+    puts("event_pool benchmark.");
+    printf("events: %u\n", EVENTS);
+
+    for (unsigned i = 0; i < EVENTS; i++) {
+        _batch[i] = &_events[i];
+    }
+    /* below main, so all events are posted before the first one runs */
+    event_pool_init(&_single.pool, _single.workers, 1, _single.stacks[0],
+                    sizeof(_single.stacks[0]), THREAD_PRIORITY_MAIN + 1);
+    event_pool_init(&_multi.pool, _multi.workers, WORKERS, _multi.stacks[0],
+                    sizeof(_multi.stacks[0]), THREAD_PRIORITY_MAIN + 1);
+
+    /* the first run is slower on native */
+    _run(&_single, _compute, true);
+
+    _print("wait", &_single, _wait);
+    _print("wait", &_multi, _wait);
+    _print("compute", &_single, _compute);
+    _print("compute", &_multi, _compute);
+    _print_post(false);
+    _print_post(true);
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("event_pool benchmark.\r\n")
+    for _ in range(4):
+        child.expect(r"\s+\w+\s+\d+ workers:\s+\d+ us\r\n")
+    for _ in range(2):
+        child.expect(r"\s+\w+\s+\d+ workers:\s+\d+ ns/event\r\n")
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
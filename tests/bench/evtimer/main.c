@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for adding and removing many evtimer events
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "evtimer.h"
+#include "random.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef EVENTS
+#define EVENTS          (1000U)
+#endif
+
+#define RESCHED_ROUNDS  (10U * EVENTS)
+/* none of the events fires during the benchmark */
+#define OFFSET_MIN      (3600U * MS_PER_SEC)
+#define OFFSET_RANGE    (3600U * MS_PER_SEC)
+
+static evtimer_t _evtimer;
+static evtimer_event_t _events[EVENTS];
+static uint16_t _order[EVENTS];
+
+static void _callback(evtimer_event_t *event)
+{
+    (void)event;
+    expect(0);
+}
+
+static uint32_t _offset(void)
+{
+    return OFFSET_MIN + random_uint32_range(0, OFFSET_RANGE);
+}
+
+static void _shuffle(void)
+{
+    for (unsigned i = EVENTS - 1; i > 0; i--) {
+        unsigned j = random_uint32_range(0, i + 1);
+        uint16_t tmp = _order[i];
+
+        _order[i] = _order[j];
+        _order[j] = tmp;
+    }
+}
+
+static void _print(const char *name, uint32_t usec, unsigned numof)
+{
+    printf("%8s: %6" PRIu32 " ns/event\n", name,
+           (uint32_t)(((uint64_t)usec * 1000U) / numof));
+}
+
+/* checks that the first event is the earliest one */
+static void _check_first(void)
+{
+    evtimer_event_t *first = evtimer_first_event(&_evtimer);
+    unsigned numof = 0;
+
+    for (evtimer_event_t *e = first; e; e = evtimer_next_event(e)) {
+        if (IS_USED(MODULE_EVTIMER_HEAP)) {
+            expect((e->offset - _evtimer.base) >= (first->offset - _evtimer.base));
+        }
+        numof++;
+    }
+    expect(numof == EVENTS);
+}
+
+int main(void)
+{
+    puts("evtimer benchmark.");
+    printf("events: %u, heap: %s\n", EVENTS,
+           IS_USED(MODULE_EVTIMER_HEAP) ? "yes" : "no");
+
+    evtimer_init(&_evtimer, _callback);
+    for (unsigned i = 0; i < EVENTS; i++) {
+        _order[i] = i;
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < EVENTS; i++) {
+        _events[i].offset = _offset();
+        evtimer_add(&_evtimer, &_events[i]);
+    }
+    _print("add", ztimer_now(ZTIMER_USEC) - start, EVENTS);
+    _check_first();
+
+    uint32_t usec = 0;
+
+    for (unsigned i = 0; i < RESCHED_ROUNDS; i++) {
+        evtimer_event_t *event = &_events[random_uint32_range(0, EVENTS)];
+        uint32_t offset = _offset();
+
+        start = ztimer_now(ZTIMER_USEC);
+        evtimer_del(&_evtimer, event);
+        event->offset = offset;
+        evtimer_add(&_evtimer, event);
+        usec += ztimer_now(ZTIMER_USEC) - start;
+    }
+    _print("resched", usec, RESCHED_ROUNDS);
+    _check_first();
+
+    _shuffle();
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < EVENTS; i++) {
+        evtimer_del(&_evtimer, &_events[_order[i]]);
+    }
+    _print("del", ztimer_now(ZTIMER_USEC) - start, EVENTS);
+    expect(evtimer_first_event(&_evtimer) == NULL);
+
+    puts("done.");
+
+    return 0;
+}
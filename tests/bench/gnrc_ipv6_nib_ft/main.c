@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Route lookup benchmark for the NIB's forwarding table
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/ipv6/addr.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_ROUTES
+#define NUMOF_ROUTES    (256U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (10000U)
+#endif
+
+#define IFACE           (1U)
+#define ROUTE_PFX_LEN   (48U)
+
+static void _set_dst(ipv6_addr_t *addr, unsigned route)
+{
+    /* 2001:db8:<route>::<route>/48 */
+    ipv6_addr_from_str(addr, "2001:db8::");
+    addr->u16[2] = byteorder_htons(route);
+    addr->u16[7] = byteorder_htons(route);
+}
+
+int main(void)
+{
+    ipv6_addr_t next_hop;
+    unsigned routes = 0;
+
+    puts("NIB forwarding table benchmark.");
+    ipv6_addr_from_str(&next_hop, "fe80::1");
+
+    for (unsigned step = 1; step <= NUMOF_ROUTES; step *= 2) {
+        gnrc_ipv6_nib_ft_t fte;
+        ipv6_addr_t dst;
+
+        for (; routes < step; routes++) {
+            _set_dst(&dst, routes);
+            expect(gnrc_ipv6_nib_ft_add(&dst, ROUTE_PFX_LEN, &next_hop,
+                                        IFACE, 0) == 0);
+        }
+
+        uint32_t before = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < REPEAT; i++) {
+            _set_dst(&dst, i % routes);
+            expect(gnrc_ipv6_nib_ft_get(&dst, NULL, &fte) == 0);
+        }
+        uint32_t diff = ztimer_now(ZTIMER_USEC) - before;
+
+        printf("%24s N=%-4u %7" PRIu32 "us / %u = %" PRIu32 "\n",
+               "gnrc_ipv6_nib_ft_get()", routes, diff, REPEAT, diff / REPEAT);
+    }
+    puts("done.");
+
+    return 0;
+}
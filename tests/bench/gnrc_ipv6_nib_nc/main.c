@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Neighbor lookup benchmark for the NIB
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/ipv6/addr.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#include "_nib-internal.h"
+
+#ifndef NUMOF_NEIGHBORS
+#define NUMOF_NEIGHBORS (512U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (10000U)
+#endif
+
+#define IFACE           (1U)
+
+static void _set_addr(ipv6_addr_t *addr, unsigned neighbor)
+{
+    /* fe80::<random-looking IID> */
+    ipv6_addr_from_str(addr, "fe80::");
+    addr->u32[2].u32 = 0x02000000 ^ (neighbor * 0x9e3779b1);
+    addr->u32[3].u32 = neighbor;
+}
+
+int main(void)
+{
+    unsigned neighbors = 0;
+
+    puts("NIB neighbor cache benchmark.");
+
+    for (unsigned step = 16; step <= NUMOF_NEIGHBORS; step *= 2) {
+        ipv6_addr_t addr;
+
+        for (; neighbors < step; neighbors++) {
+            _set_addr(&addr, neighbors);
+            expect(gnrc_ipv6_nib_nc_set(&addr, IFACE, NULL, 0) == 0);
+        }
+
+        _nib_acquire();
+        uint32_t before = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < REPEAT; i++) {
+            _set_addr(&addr, i % neighbors);
+            expect(_nib_onl_get(&addr, IFACE) != NULL);
+        }
+        uint32_t diff = ztimer_now(ZTIMER_USEC) - before;
+        _nib_release();
+
+        printf("%16s N=%-4u %7" PRIu32 "us / %u = %" PRIu32 "\n",
+               "_nib_onl_get()", neighbors, diff, REPEAT, diff / REPEAT);
+    }
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("NIB neighbor cache benchmark.\r\n")
+    # the number of steps depends on NUMOF_NEIGHBORS
+    while child.expect([r"\s+_nib_onl_get\(\) N=\d+\s+\d+us / \d+ = \d+\r\n",
+                        r"done.\r\n"]) == 0:
+        pass
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for batched packet dispatch in gnrc_netapi
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netapi/batch.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "schedstatistics.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef BURST
+#define BURST           (8U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS          (2000U)
+#endif
+
+#define PKT_SIZE        (64U)
+#define MSG_QUEUE_SIZE  (16U)   /* a burst of single messages has to fit */
+#define CTX_RELAY       (1U)
+#define CTX_SINK        (2U)
+
+typedef struct {
+    gnrc_netreg_entry_t entry;
+    msg_t msg_queue[MSG_QUEUE_SIZE];
+    char stack[THREAD_STACKSIZE_DEFAULT];
+} _stage_t;
+
+static _stage_t _relay;
+static _stage_t _sink;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static unsigned _msgs;
+static unsigned _rcvd;
+
+/* stands in for IPv6: passes packets on to the next layer */
+static void *_relay_thread(void *arg)
+{
+    (void)arg;
+    msg_init_queue(_relay.msg_queue, MSG_QUEUE_SIZE);
+    gnrc_netreg_entry_init_pid(&_relay.entry, CTX_RELAY, thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &_relay.entry);
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        _msgs++;
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            expect(gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UNDEF, CTX_SINK,
+                                                msg.content.ptr) == 1);
+        }
+        else if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV_BATCH) {
+            gnrc_netapi_batch_t up;
+
+            gnrc_netapi_batch_init(&up);
+            for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr); i++) {
+                gnrc_netapi_batch_receive(&up, GNRC_NETTYPE_UNDEF, CTX_SINK,
+                                          gnrc_netapi_batch_get(msg.content.ptr, i));
+            }
+            gnrc_netapi_batch_flush(&up);
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+    return NULL;
+}
+
+/* stands in for UDP: consumes packets */
+static void _consume(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktbuf_release(pkt);
+    if (++_rcvd == BURST) {
+        _rcvd = 0;
+        mutex_unlock(&_done);
+    }
+}
+
+static void *_sink_thread(void *arg)
+{
+    (void)arg;
+    msg_init_queue(_sink.msg_queue, MSG_QUEUE_SIZE);
+    gnrc_netreg_entry_init_pid(&_sink.entry, CTX_SINK, thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &_sink.entry);
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        _msgs++;
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            _consume(msg.content.ptr);
+        }
+        else if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV_BATCH) {
+            for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr); i++) {
+                _consume(gnrc_netapi_batch_get(msg.content.ptr, i));
+            }
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+    return NULL;
+}
+
+static unsigned _switches(void)
+{
+    unsigned sum = 0;
+
+    for (unsigned i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        sum += sched_pidlist[i].schedules;
+    }
+    return sum;
+}
+
+static void _run(const char *prio, bool batch)
+{
+    gnrc_netapi_batch_t b;
+
+    _relay.entry.batch = batch;
+    _sink.entry.batch = batch;
+    _msgs = 0;
+    gnrc_netapi_batch_init(&b);
+
+    unsigned switches = _switches();
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        /* a burst as received by a network interface in one go */
+        for (unsigned i = 0; i < BURST; i++) {
+            gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, PKT_SIZE,
+                                                  GNRC_NETTYPE_UNDEF);
+
+            expect(pkt != NULL);
+            if (batch) {
+                gnrc_netapi_batch_receive(&b, GNRC_NETTYPE_UNDEF, CTX_RELAY, pkt);
+            }
+            else {
+                expect(gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UNDEF,
+                                                    CTX_RELAY, pkt) == 1);
+            }
+        }
+        gnrc_netapi_batch_flush(&b);
+        mutex_lock(&_done);
+    }
+
+    uint32_t usec = ztimer_now(ZTIMER_USEC) - start;
+
+    switches = _switches() - switches;
+    printf("%8s %5s: %u msgs, %u switches, %" PRIu32 " ns/pkt\n", prio,
+           batch ? "batch" : "plain", _msgs, switches,
+           (uint32_t)(((uint64_t)usec * 1000U) / (ROUNDS * BURST)));
+}
+
+static void _set_prio(uint8_t relay, uint8_t sink)
+{
+    sched_change_priority(thread_get(_relay.entry.target.pid), relay);
+    sched_change_priority(thread_get(_sink.entry.target.pid), sink);
+}
+
+int main(void)
+{
+    puts("gnrc_netapi batch benchmark.");
+    printf("burst: %u packets, rounds: %u\n", BURST, ROUNDS);
+
+    /* the stages register themselves before main continues */
+    thread_create(_relay.stack, sizeof(_relay.stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _relay_thread, NULL, "relay");
+    thread_create(_sink.stack, sizeof(_sink.stack), THREAD_PRIORITY_MAIN - 2,
+                  0, _sink_thread, NULL, "sink");
+
+    /* as in GNRC: each layer runs at a lower priority than the one below,
+     * so bursts queue up at each layer */
+    _set_prio(THREAD_PRIORITY_MAIN + 1, THREAD_PRIORITY_MAIN + 2);
+    _run("lower", false);
+    _run("lower", true);
+    /* each layer preempts the one below as soon as it gets a message */
+    _set_prio(THREAD_PRIORITY_MAIN - 1, THREAD_PRIORITY_MAIN - 2);
+    _run("higher", false);
+    _run("higher", true);
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Demultiplexing benchmark for gnrc_netreg
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/netreg.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_SOCKETS
+#define NUMOF_SOCKETS   (64U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (10000U)
+#endif
+
+#define PORT_BASE       (49152U)
+
+static gnrc_netreg_entry_t _entries[NUMOF_SOCKETS];
+static msg_t _msg_queue[2];
+
+int main(void)
+{
+    unsigned sockets = 0;
+
+    puts("gnrc_netreg lookup benchmark.");
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+
+    for (unsigned step = 1; step <= NUMOF_SOCKETS; step *= 2) {
+        /* one entry per bound UDP port */
+        for (; sockets < step; sockets++) {
+            gnrc_netreg_entry_init_pid(&_entries[sockets], PORT_BASE + sockets,
+                                       thread_getpid());
+            expect(gnrc_netreg_register(GNRC_NETTYPE_UDP,
+                                        &_entries[sockets]) == 0);
+        }
+
+        gnrc_netreg_acquire_shared();
+        uint32_t before = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < REPEAT; i++) {
+            /* a datagram is passed to all entries of its port */
+            gnrc_netreg_entry_t *entry = gnrc_netreg_lookup(GNRC_NETTYPE_UDP,
+                                                            PORT_BASE + (i % sockets));
+
+            expect(entry != NULL);
+            expect(gnrc_netreg_getnext(entry) == NULL);
+        }
+        uint32_t diff = ztimer_now(ZTIMER_USEC) - before;
+        gnrc_netreg_release_shared();
+
+        printf("%20s N=%-3u %7" PRIu32 "us / %u = %" PRIu32 "ns\n",
+               "gnrc_netreg_lookup()", sockets, diff, REPEAT,
+               (uint32_t)(((uint64_t)diff * 1000U) / REPEAT));
+    }
+    puts("done.");
+
+    return 0;
+}
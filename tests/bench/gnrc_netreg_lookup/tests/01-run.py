@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gnrc_netreg lookup benchmark.\r\n")
+    # the number of steps depends on NUMOF_SOCKETS
+    while child.expect([r"\s+gnrc_netreg_lookup\(\) N=\d+\s+\d+us / \d+ = \d+ns\r\n",
+                        r"done.\r\n"]) == 0:
+        pass
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Memory and latency benchmark for the single-thread GNRC mode
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif.h"
+#include "net/sock/udp.h"
+#include "schedstatistics.h"
+#include "thread.h"
+
+#ifndef BENCH_PINGS
+#define BENCH_PINGS     (1000U)
+#endif
+
+#define BENCH_PORT      (12345U)
+
+static uint8_t _buf[128];
+
+static unsigned _switches(void)
+{
+    unsigned sum = 0;
+
+    for (unsigned i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        sum += sched_pidlist[i].schedules;
+    }
+    return sum;
+}
+
+static void _print_threads(void)
+{
+    unsigned numof = 0;
+    unsigned size = 0;
+    unsigned used = 0;
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = thread_get(pid);
+
+        if (thread == NULL) {
+            continue;
+        }
+        numof++;
+        size += thread_get_stacksize(thread);
+        used += thread_get_stacksize(thread) -
+                thread_measure_stack_free(thread);
+    }
+    printf("threads: %u, stack: %u bytes, used: %u bytes\n", numof, size, used);
+}
+
+int main(void)
+{
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_t sock;
+    ipv6_addr_t addr;
+    char addr_str[IPV6_ADDR_MAX_STR_LEN];
+
+    puts("gnrc single-thread benchmark.");
+    printf("single thread: %u\n", IS_USED(MODULE_GNRC_SINGLE_THREAD));
+    if ((netif == NULL) ||
+        (gnrc_netif_ipv6_addrs_get(netif, &addr, sizeof(addr)) < 0)) {
+        puts("no network interface");
+        return 1;
+    }
+    printf("address: %s%%%u\n",
+           ipv6_addr_to_str(addr_str, &addr, sizeof(addr_str)), netif->pid);
+
+    local.port = BENCH_PORT;
+    if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
+        puts("sock_udp_create failed");
+        return 1;
+    }
+    printf("echoing on port %u\n", BENCH_PORT);
+
+    unsigned switches = 0;
+
+    for (unsigned i = 0; i < BENCH_PINGS; i++) {
+        sock_udp_ep_t remote;
+        ssize_t res = sock_udp_recv(&sock, _buf, sizeof(_buf),
+                                    SOCK_NO_TIMEOUT, &remote);
+
+        if (i == 0) {
+            /* count from the first datagram, not from waiting for the peer */
+            switches = _switches();
+        }
+
+        if ((res < 0) || (sock_udp_send(&sock, _buf, res, &remote) < 0)) {
+            printf("echo failed: %d\n", (int)res);
+            return 1;
+        }
+    }
+    switches = _switches() - switches;
+    sock_udp_close(&sock);
+    printf("switches: %u per echo\n", switches / (BENCH_PINGS - 1));
+    _print_threads();
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import os
+import socket
+import sys
+import time
+
+from testrunner import run
+
+PORT = 12345
+PAYLOAD = bytes(64)
+
+
+def testfunc(child):
+    iface = os.environ.get("TAP", "tap0")
+    pings = int(os.environ.get("BENCH_PINGS", 1000))
+
+    child.expect_exact("gnrc single-thread benchmark.\r\n")
+    child.expect(r"single thread: (\d)\r\n")
+    single = child.match.group(1)
+    child.expect(r"address: ([0-9a-f:]+)%\d+\r\n")
+    addr = child.match.group(1)
+    child.expect_exact(f"echoing on port {PORT}\r\n")
+
+    dst = socket.getaddrinfo(f"{addr}%{iface}", PORT, socket.AF_INET6,
+                             socket.SOCK_DGRAM)[0][4]
+    with socket.socket(socket.AF_INET6, socket.SOCK_DGRAM) as sock:
+        sock.settimeout(1)
+        rtt = 0
+        for _ in range(pings):
+            start = time.perf_counter()
+            sock.sendto(PAYLOAD, dst)
+            assert sock.recv(len(PAYLOAD)) == PAYLOAD
+            rtt += time.perf_counter() - start
+    child.expect(r"switches: (\d+) per echo\r\n")
+    switches = child.match.group(1)
+    child.expect(r"threads: (\d+), stack: (\d+) bytes, used: (\d+) bytes\r\n")
+    threads, stack, used = child.match.groups()
+    child.expect_exact("done.\r\n")
+    print(f"\nsingle thread {single}: {threads} threads, stack {stack} bytes "
+          f"({used} used), {switches} switches/echo, "
+          f"rtt {rtt * 1e6 / pings:.1f} us")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the 6LoWPAN reassembly buffer with interleaved
+ *              fragment streams
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/ipv6/hdr.h"
+#include "net/sixlowpan.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef SOURCES
+#define SOURCES         (256U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS          (20U)
+#endif
+
+#define DATAGRAM_SIZE   (348U)
+#define FRAG_SIZE       (96U)
+#define FRAGS           ((DATAGRAM_SIZE + FRAG_SIZE - 1) / FRAG_SIZE)
+#define L2ADDR_LEN      (8U)
+
+static const uint8_t _dst[L2ADDR_LEN] = {
+    0xa4, 0xf2, 0xd2, 0xc9, 0x13, 0xb9, 0xbb, 0x25
+};
+static uint8_t _datagram[DATAGRAM_SIZE];
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t src[L2ADDR_LEN];
+    uint8_t dst[L2ADDR_LEN];
+} _netif_hdr;
+
+static void _init_datagram(void)
+{
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)_datagram;
+
+    memset(_datagram, 0x54, sizeof(_datagram));
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(DATAGRAM_SIZE - sizeof(ipv6_hdr_t));
+    ipv6->nh = PROTNUM_IPV6_NONXT;
+    ipv6->hl = 64;
+    ipv6_addr_set_link_local_prefix(&ipv6->src);
+    ipv6_addr_set_link_local_prefix(&ipv6->dst);
+}
+
+static void _add(unsigned source, unsigned frag, uint16_t tag)
+{
+    size_t offset = frag * FRAG_SIZE;
+    size_t size = DATAGRAM_SIZE - offset;
+    size_t hdr_size = (frag == 0) ? sizeof(sixlowpan_frag_t) + 1
+                                  : sizeof(sixlowpan_frag_n_t);
+    gnrc_pktsnip_t *pkt;
+    sixlowpan_frag_n_t *hdr;
+
+    if (size > FRAG_SIZE) {
+        size = FRAG_SIZE;
+    }
+    pkt = gnrc_pktbuf_add(NULL, NULL, hdr_size + size, GNRC_NETTYPE_SIXLOWPAN);
+    expect(pkt != NULL);
+    hdr = pkt->data;
+    hdr->disp_size = byteorder_htons(DATAGRAM_SIZE);
+    hdr->tag = byteorder_htons(tag);
+    if (frag == 0) {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        ((uint8_t *)pkt->data)[sizeof(sixlowpan_frag_t)] = SIXLOWPAN_UNCOMP;
+    }
+    else {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        hdr->offset = offset / 8;
+    }
+    memcpy((uint8_t *)pkt->data + hdr_size, &_datagram[offset], size);
+
+    _netif_hdr.src[0] = source >> 8;
+    _netif_hdr.src[1] = source & 0xff;
+    /* completed datagrams have no receiver and are released */
+    expect(gnrc_sixlowpan_frag_rb_add(&_netif_hdr.hdr, pkt, offset, 0) != NULL);
+}
+
+int main(void)
+{
+    uint16_t tag = 0;
+
+    puts("6LoWPAN reassembly buffer benchmark.");
+
+    gnrc_pktbuf_init();
+    _init_datagram();
+    gnrc_netif_hdr_init(&_netif_hdr.hdr, L2ADDR_LEN, L2ADDR_LEN);
+    memset(_netif_hdr.src, 0x02, sizeof(_netif_hdr.src));
+    memcpy(_netif_hdr.dst, _dst, sizeof(_netif_hdr.dst));
+
+    for (unsigned sources = 16; sources <= SOURCES; sources *= 2) {
+        uint32_t before = ztimer_now(ZTIMER_USEC);
+
+        for (unsigned round = 0; round < ROUNDS; round++, tag++) {
+            for (unsigned frag = 0; frag < FRAGS; frag++) {
+                for (unsigned source = 0; source < sources; source++) {
+                    _add(source, frag, tag);
+                }
+            }
+        }
+        uint32_t diff = ztimer_now(ZTIMER_USEC) - before;
+
+        printf("%16s N=%-4u %7" PRIu32 " ns/fragment\n", "rb_add()", sources,
+               (uint32_t)(((uint64_t)diff * 1000U) / (ROUNDS * FRAGS * sources)));
+    }
+    puts("done.");
+
+    return 0;
+}
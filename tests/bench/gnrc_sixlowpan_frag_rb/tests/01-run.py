@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("6LoWPAN reassembly buffer benchmark.\r\n")
+    # the number of steps depends on SOURCES
+    while child.expect([r"\s+rb_add\(\) N=\d+\s+\d+ ns/fragment\r\n",
+                        r"done.\r\n"]) == 0:
+        pass
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,293 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for 6LoWPAN IPHC encoding and decoding of packets to
+ *              several destinations
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/gnrc/udp.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef FLOWS
+#define FLOWS           (16U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS          (200U)
+#endif
+
+#define BATCH           (32U)
+#define L2ADDR_LEN      (8U)
+#define FRAME_MAX       (127U)
+#define PORT            (5683U)
+
+static const uint8_t _l2addr[L2ADDR_LEN] = {
+    0x02, 0x4a, 0x6d, 0x1c, 0x35, 0x9e, 0x80, 0x01
+};
+static const ipv6_addr_t _prefix = { {
+    0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+} };
+static const uint8_t _payload[32] = { 0x42 };
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static msg_t _msg_queue[2 * BATCH];
+static gnrc_netreg_entry_t _ipv6_entry;
+static gnrc_pktsnip_t *_batch[BATCH];
+static ipv6_addr_t _src;
+static struct {
+    uint8_t l2addr[L2ADDR_LEN];
+    ipv6_addr_t addr;
+    uint8_t frame[FRAME_MAX];
+    size_t frame_len;
+} _peers[FLOWS];
+/* flow whose frame the send callback keeps, -1 for none */
+static int _capture = -1;
+
+static int _get_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = FRAME_MAX;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = L2ADDR_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_addr_long(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len >= sizeof(_l2addr));
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    (void)netdev;
+    if (_capture >= 0) {
+        size_t len = 0;
+
+        /* skip the MAC header */
+        for (iolist = iolist->iol_next; iolist; iolist = iolist->iol_next) {
+            expect(len + iolist->iol_len <= FRAME_MAX);
+            memcpy(&_peers[_capture].frame[len], iolist->iol_base,
+                   iolist->iol_len);
+            len += iolist->iol_len;
+        }
+        _peers[_capture].frame_len = len;
+    }
+    return 0;
+}
+
+static void _init_netif(void)
+{
+    eui64_t iid;
+
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_addr_long);
+    netdev_test_set_send_cb(&_dev, _send);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "mock_netif",
+                                        &_dev.netdev.netdev) == 0);
+    thread_yield_higher();
+
+    /* global addresses with a compression context for their prefix */
+    expect(gnrc_sixlowpan_ctx_update(0, &_prefix, 64, UINT16_MAX, true));
+    expect(gnrc_netif_ipv6_get_iid(&_netif, &iid) == sizeof(iid));
+    _src.u64[1] = iid.uint64;
+    ipv6_addr_init_prefix(&_src, &_prefix, 64);
+    for (unsigned i = 0; i < FLOWS; i++) {
+        memcpy(_peers[i].l2addr, _l2addr, L2ADDR_LEN);
+        _peers[i].l2addr[L2ADDR_LEN - 1] = i + 2;
+        expect(gnrc_netif_ipv6_iid_from_addr(&_netif, _peers[i].l2addr,
+                                             L2ADDR_LEN, &iid) == sizeof(iid));
+        _peers[i].addr.u64[1] = iid.uint64;
+        ipv6_addr_init_prefix(&_peers[i].addr, &_prefix, 64);
+    }
+}
+
+static gnrc_pktsnip_t *_build_packet(unsigned flow)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+    ipv6_hdr_t *ipv6;
+    udp_hdr_t *udp;
+
+    pkt = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload),
+                          GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, PORT, PORT);
+    expect(pkt != NULL);
+    udp = pkt->data;
+    udp->length = byteorder_htons(gnrc_pkt_len(pkt));
+    pkt = gnrc_ipv6_hdr_build(pkt, &_src, &_peers[flow].addr);
+    expect(pkt != NULL);
+    ipv6 = pkt->data;
+    ipv6->len = byteorder_htons(gnrc_pkt_len(pkt->next));
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = CONFIG_GNRC_NETIF_DEFAULT_HL;
+    netif = gnrc_netif_hdr_build(NULL, 0, _peers[flow].l2addr, L2ADDR_LEN);
+    expect(netif != NULL);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    return gnrc_pkt_prepend(pkt, netif);
+}
+
+static gnrc_pktsnip_t *_build_frame(unsigned flow)
+{
+    gnrc_pktsnip_t *pkt;
+
+    pkt = gnrc_netif_hdr_build(_l2addr, L2ADDR_LEN,
+                               _peers[flow].l2addr, L2ADDR_LEN);
+    expect(pkt != NULL);
+    gnrc_netif_hdr_set_netif(pkt->data, &_netif);
+    pkt = gnrc_pktbuf_add(pkt, _peers[flow].frame, _peers[flow].frame_len,
+                          GNRC_NETTYPE_SIXLOWPAN);
+    expect(pkt != NULL);
+    return pkt;
+}
+
+static void _release_decoded(void)
+{
+    msg_t msg;
+
+    while (msg_try_receive(&msg) == 1) {
+        expect(msg.type == GNRC_NETAPI_MSG_TYPE_RCV);
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
+}
+
+static void _check_round_trip(unsigned flow)
+{
+    gnrc_pktsnip_t *ipv6;
+    ipv6_hdr_t *hdr;
+    msg_t msg;
+
+    /* the second packet of a flow is encoded from the cache */
+    for (unsigned i = 0; i < 2; i++) {
+        _capture = flow;
+        gnrc_sixlowpan_iphc_send(_build_packet(flow), NULL, 0);
+        _capture = -1;
+        expect(_peers[flow].frame_len > 0);
+
+        gnrc_sixlowpan_iphc_recv(_build_frame(flow), NULL, 0);
+        expect(msg_try_receive(&msg) == 1);
+        ipv6 = gnrc_pktsnip_search_type(msg.content.ptr, GNRC_NETTYPE_IPV6);
+        expect(ipv6 != NULL);
+        hdr = ipv6->data;
+        expect(ipv6_addr_equal(&hdr->src, &_src));
+        expect(ipv6_addr_equal(&hdr->dst, &_peers[flow].addr));
+        expect(hdr->nh == PROTNUM_UDP);
+        expect(hdr->hl == CONFIG_GNRC_NETIF_DEFAULT_HL);
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
+}
+
+int main(void)
+{
+    puts("6LoWPAN IPHC benchmark.");
+
+    gnrc_pktbuf_init();
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    _init_netif();
+    /* decompressed packets end up here */
+    gnrc_netreg_entry_init_pid(&_ipv6_entry, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &_ipv6_entry);
+    for (unsigned flow = 0; flow < FLOWS; flow++) {
+        _check_round_trip(flow);
+    }
+
+    for (unsigned flows = 1; flows <= FLOWS; flows *= 2) {
+        /* fastest batch, the others are disturbed by the host */
+        uint32_t encode = UINT32_MAX, decode = UINT32_MAX;
+
+        for (unsigned round = 0; round < ROUNDS; round++) {
+            uint32_t before, diff;
+
+            for (unsigned i = 0; i < BATCH; i++) {
+                _batch[i] = _build_packet(i % flows);
+            }
+            before = ztimer_now(ZTIMER_USEC);
+            for (unsigned i = 0; i < BATCH; i++) {
+                gnrc_sixlowpan_iphc_send(_batch[i], NULL, 0);
+            }
+            diff = ztimer_now(ZTIMER_USEC) - before;
+            if (diff < encode) {
+                encode = diff;
+            }
+
+            for (unsigned i = 0; i < BATCH; i++) {
+                _batch[i] = _build_frame(i % flows);
+            }
+            before = ztimer_now(ZTIMER_USEC);
+            for (unsigned i = 0; i < BATCH; i++) {
+                gnrc_sixlowpan_iphc_recv(_batch[i], NULL, 0);
+            }
+            diff = ztimer_now(ZTIMER_USEC) - before;
+            if (diff < decode) {
+                decode = diff;
+            }
+            _release_decoded();
+        }
+        printf("%16s N=%-4u %7" PRIu32 " ns/packet\n", "iphc_send()", flows,
+               (encode * 1000U) / BATCH);
+        printf("%16s N=%-4u %7" PRIu32 " ns/packet\n", "iphc_recv()", flows,
+               (decode * 1000U) / BATCH);
+    }
+    puts("done.");
+
+    return 0;
+}
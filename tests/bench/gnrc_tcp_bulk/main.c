@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Bulk transfer benchmark for gnrc_tcp
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "net/af.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/tcp.h"
+#include "ztimer.h"
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES     (1024UL * 1024UL)
+#endif
+
+#define BENCH_PORT      (12345U)
+#define BENCH_TIMEOUT   (10U * MS_PER_SEC)
+
+static gnrc_tcp_tcb_t _tcb;
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static uint8_t _buf[CONFIG_GNRC_TCP_MSS * 8];
+
+static void _print_rate(const char *dir, uint32_t bytes, uint32_t usec)
+{
+    printf("%s: %" PRIu32 " bytes in %" PRIu32 " us, %" PRIu32 " kbit/s\n",
+           dir, bytes, usec, (uint32_t)(((uint64_t)bytes * 8000U) / usec));
+}
+
+static int _rx(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t total = 0;
+    uint32_t start = 0;
+
+    while (total < BENCH_BYTES) {
+        ssize_t res = gnrc_tcp_recv(tcb, _buf, sizeof(_buf), BENCH_TIMEOUT);
+
+        if (res <= 0) {
+            printf("recv failed: %d\n", (int)res);
+            return -1;
+        }
+        if (total == 0) {
+            /* time from the first segment, not from the peer's connect */
+            start = ztimer_now(ZTIMER_USEC);
+        }
+        total += res;
+    }
+    _print_rate("rx", total, ztimer_now(ZTIMER_USEC) - start);
+    return 0;
+}
+
+static int _tx(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t total = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    while (total < BENCH_BYTES) {
+        size_t len = BENCH_BYTES - total;
+        ssize_t res;
+
+        if (len > sizeof(_buf)) {
+            len = sizeof(_buf);
+        }
+        res = gnrc_tcp_send(tcb, _buf, len, BENCH_TIMEOUT);
+        if (res <= 0) {
+            printf("send failed: %d\n", (int)res);
+            return -1;
+        }
+        total += res;
+    }
+    _print_rate("tx", total, ztimer_now(ZTIMER_USEC) - start);
+    return 0;
+}
+
+int main(void)
+{
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+    gnrc_tcp_tcb_t *tcb = NULL;
+    gnrc_tcp_ep_t local;
+    ipv6_addr_t addr;
+    char addr_str[IPV6_ADDR_MAX_STR_LEN];
+
+    puts("gnrc_tcp bulk transfer benchmark.");
+    printf("gso: %u, gro: %u\n", IS_USED(MODULE_GNRC_TCP_GSO),
+           IS_USED(MODULE_GNRC_TCP_GRO));
+    if ((netif == NULL) ||
+        (gnrc_netif_ipv6_addrs_get(netif, &addr, sizeof(addr)) < 0)) {
+        puts("no network interface");
+        return 1;
+    }
+    printf("address: %s%%%u\n",
+           ipv6_addr_to_str(addr_str, &addr, sizeof(addr_str)), netif->pid);
+
+    gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, BENCH_PORT, 0);
+    gnrc_tcp_tcb_init(&_tcb);
+    if (gnrc_tcp_listen(&_queue, &_tcb, 1, &local) < 0) {
+        puts("listen failed");
+        return 1;
+    }
+    printf("listening on port %u\n", BENCH_PORT);
+    if (gnrc_tcp_accept(&_queue, &tcb, GNRC_TCP_NO_TIMEOUT) < 0) {
+        puts("accept failed");
+        return 1;
+    }
+
+    /* the peer sends BENCH_BYTES first, then receives them */
+    if ((_rx(tcb) == 0) && (_tx(tcb) == 0)) {
+        puts("done.");
+    }
+    gnrc_tcp_close(tcb);
+    gnrc_tcp_stop_listen(&_queue);
+
+    return 0;
+}
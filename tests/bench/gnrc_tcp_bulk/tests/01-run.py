@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import os
+import socket
+import sys
+
+from testrunner import run
+
+PORT = 12345
+CHUNK = 65536
+
+
+def testfunc(child):
+    iface = os.environ.get("TAP", "tap0")
+
+    child.expect_exact("gnrc_tcp bulk transfer benchmark.\r\n")
+    child.expect(r"gso: (\d), gro: (\d)\r\n")
+    gso, gro = child.match.group(1), child.match.group(2)
+    child.expect(r"address: ([0-9a-f:]+)%\d+\r\n")
+    addr = child.match.group(1)
+    child.expect_exact(f"listening on port {PORT}\r\n")
+
+    size = int(os.environ.get("BENCH_BYTES", 1048576))
+    with socket.create_connection((f"{addr}%{iface}", PORT), timeout=20) as sock:
+        data = bytes(CHUNK)
+        sent = 0
+        while sent < size:
+            sent += sock.send(data[:size - sent])
+        child.expect(r"rx: \d+ bytes in \d+ us, (\d+) kbit/s\r\n")
+        rx = int(child.match.group(1))
+        received = 0
+        while received < size:
+            chunk = sock.recv(CHUNK)
+            assert chunk, "connection closed early"
+            received += len(chunk)
+        child.expect(r"tx: \d+ bytes in \d+ us, (\d+) kbit/s\r\n")
+        tx = int(child.match.group(1))
+    child.expect_exact("done.\r\n")
+    print(f"\ngso {gso}, gro {gro}: rx {rx} kbit/s, tx {tx} kbit/s")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
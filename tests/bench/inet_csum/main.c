@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Internet checksum throughput benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "net/inet_csum.h"
+#include "ztimer.h"
+
+#ifndef TRANSFER_SIZE
+#define TRANSFER_SIZE   (1024U * 1024U)
+#endif
+
+static const uint16_t _lens[] = { 8, 40, 64, 256, 1280 };
+
+static uint32_t _buf[(1280 + 4) / sizeof(uint32_t)];
+
+static void _bench(uint16_t len, unsigned offset)
+{
+    const uint8_t *buf = (uint8_t *)_buf + offset;
+    unsigned rounds = TRANSFER_SIZE / len;
+    uint16_t sum = 0;
+
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < rounds; i++) {
+        sum = inet_csum_slice(sum, buf, len, 0);
+    }
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - before;
+
+    if (diff == 0) {
+        diff = 1;
+    }
+    printf("len=%-4u offset=%u %7" PRIu32 "us %5" PRIu32 " B/us (sum 0x%04x)\n",
+           len, offset, diff, (uint32_t)(rounds * len) / diff, sum);
+}
+
+int main(void)
+{
+    uint8_t *bytes = (uint8_t *)_buf;
+
+    puts("inet_csum benchmark.");
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        bytes[i] = i * 7;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        _bench(_lens[i], 0);
+        _bench(_lens[i], 1);
+    }
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,18 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("inet_csum benchmark.\r\n")
+    for _ in range(10):
+        child.expect(r"len=\d+\s+offset=\d \s*\d+us\s+\d+ B/us \(sum 0x[0-9a-f]{4}\)\r\n")
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
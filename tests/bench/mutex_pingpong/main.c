@@ -27,8 +27,13 @@
 #define TEST_DURATION       (1000000U)
 #endif
 
+/* number of threads waiting on the mutex */
+#ifndef CONTENDERS
+#define CONTENDERS          (1U)
+#endif
+
 volatile unsigned _flag = 0;
-static char _stack[THREAD_STACKSIZE_MAIN];
+static char _stacks[CONTENDERS][THREAD_STACKSIZE_MAIN];
 static mutex_t _mutex = MUTEX_INIT;
 
 static void _timer_callback(void*arg)
@@ -51,17 +56,21 @@ static void *_second_thread(void *arg)
 
 int main(void)
 {
-    printf("main starting\n");
-
-    thread_create(_stack,
-                  sizeof(_stack),
-                  THREAD_PRIORITY_MAIN - 1,
-                  THREAD_CREATE_WOUT_YIELD,
-                  _second_thread,
-                  NULL,
-                  "second_thread");
+    printf("main starting, %u contenders\n", CONTENDERS);
+
+    /* All contenders share a priority, so each one woken up queues behind
+     * all others when it blocks again. */
+    for (unsigned i = 0; i < CONTENDERS; i++) {
+        thread_create(_stacks[i],
+                      sizeof(_stacks[i]),
+                      THREAD_PRIORITY_MAIN - 1,
+                      THREAD_CREATE_WOUT_YIELD,
+                      _second_thread,
+                      NULL,
+                      "second_thread");
+    }
 
-    /* lock the mutex, then yield to second_thread */
+    /* lock the mutex, then yield to the contenders */
     mutex_lock(&_mutex);
     thread_yield_higher();
 
@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Receive throughput benchmark for netdev_tap
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/netif.h"
+#include "netdev_tap.h"
+#include "ztimer.h"
+
+#ifndef BENCH_SECONDS
+#define BENCH_SECONDS   (10U)
+#endif
+
+int main(void)
+{
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+    uint32_t last = 0;
+    uint8_t addr[GNRC_NETIF_L2ADDR_MAXLEN];
+    char addr_str[GNRC_NETIF_L2ADDR_MAXLEN * 3];
+
+    puts("netdev_tap receive benchmark.");
+    printf("batch size: %u\n", (unsigned)CONFIG_NETDEV_TAP_RX_BATCH);
+    if (netif == NULL) {
+        puts("no network interface");
+        return 1;
+    }
+    int res = gnrc_netapi_get(netif->pid, NETOPT_ADDRESS, 0, addr, sizeof(addr));
+    if (res > 0) {
+        printf("address: %s\n", gnrc_netif_addr_to_str(addr, res, addr_str));
+    }
+
+    for (unsigned i = 0; i < BENCH_SECONDS; i++) {
+        ztimer_sleep(ZTIMER_MSEC, MS_PER_SEC);
+
+        uint32_t count = netif->stats.rx_count;
+        printf("%" PRIu32 " frames/s\n", count - last);
+        last = count;
+    }
+    puts("done.");
+
+    return 0;
+}
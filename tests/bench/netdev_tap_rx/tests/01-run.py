@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import os
+import socket
+import sys
+import threading
+
+from testrunner import run
+
+# IEEE 802 local experimental ethertype, dropped by the stack after reception
+ETHERTYPE = 0x88b5
+FRAME_LEN = 128
+
+
+def flood(iface, stop):
+    sock = socket.socket(socket.AF_PACKET, socket.SOCK_RAW)
+    sock.bind((iface, 0))
+    frame = (b"\xff" * 6 + b"\x02\x00\x00\x00\x00\x01" +
+             ETHERTYPE.to_bytes(2, "big"))
+    frame += bytes(FRAME_LEN - len(frame))
+    while not stop.is_set():
+        try:
+            sock.send(frame)
+        except OSError:
+            # TAP queue full, let the application catch up
+            pass
+    sock.close()
+
+
+def testfunc(child):
+    iface = os.environ.get("TAP", "tap0")
+    stop = threading.Event()
+
+    child.expect_exact("netdev_tap receive benchmark.\r\n")
+    child.expect(r"batch size: (\d+)\r\n")
+    batch = int(child.match.group(1))
+    child.expect(r"address: [0-9A-F:]+\r\n")
+
+    flooder = threading.Thread(target=flood, args=(iface, stop), daemon=True)
+    flooder.start()
+    rates = []
+    try:
+        while True:
+            res = child.expect([r"(\d+) frames/s\r\n", r"done.\r\n"])
+            if res == 1:
+                break
+            rates.append(int(child.match.group(1)))
+    finally:
+        stop.set()
+        flooder.join()
+    print(f"\nbatch size {batch}: max. {max(rates)} frames/s")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=30))
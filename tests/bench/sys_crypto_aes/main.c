@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Cycles per byte benchmark for AES and its modes
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "crypto/ciphers.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/gcm.h"
+#include "periph_conf.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define MSG_MAX     (1024U)
+#define TAG_LEN     (16U)
+/* enough to run for a while on native, about a second on most MCUs */
+#ifndef BYTES
+#define BYTES       (64U * 1024U)
+#endif
+
+static const uint8_t _key[16] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+static const uint8_t _nonce[13];
+static const uint8_t _adata[16];
+
+static cipher_t _cipher;
+static uint8_t _in[MSG_MAX];
+static uint8_t _out[MSG_MAX + TAG_LEN];
+
+static void _blocks(size_t len)
+{
+    cipher_encrypt_blocks(&_cipher, _in, _out, len / 16);
+}
+
+static void _ctr(size_t len)
+{
+    uint8_t ctr[16] = { 0 };
+
+    cipher_encrypt_ctr(&_cipher, ctr, 12, _in, len, _out);
+}
+
+static void _ccm(size_t len)
+{
+    cipher_encrypt_ccm(&_cipher, _adata, sizeof(_adata), 8, 2,
+                       _nonce, 13, _in, len, _out);
+}
+
+static void _gcm(size_t len)
+{
+    cipher_encrypt_gcm(&_cipher, _adata, sizeof(_adata), TAG_LEN,
+                       _nonce, GCM_NONCE_LEN, _in, len, _out);
+}
+
+static void _run(const char *name, void (*encrypt)(size_t), size_t len)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < BYTES / len; i++) {
+        encrypt(len);
+    }
+
+    uint32_t usec = ztimer_now(ZTIMER_USEC) - start;
+    uint64_t cycles = (uint64_t)usec * (CLOCK_CORECLOCK / US_PER_SEC);
+    uint32_t cpb100 = (cycles * 100) / BYTES;
+
+    printf("%-6s %4u B: %5" PRIu32 ".%02" PRIu32 " cycles/B\n", name,
+           (unsigned)len, cpb100 / 100, cpb100 % 100);
+}
+
+int main(void)
+{
+    puts("aes benchmark.");
+    printf("constant-time: %s\n", IS_USED(MODULE_CRYPTO_AES_CT) ? "yes" : "no");
+
+    for (unsigned i = 0; i < MSG_MAX; i++) {
+        _in[i] = i;
+    }
+    cipher_init(&_cipher, CIPHER_AES, _key, sizeof(_key));
+
+    for (size_t len = 64; len <= MSG_MAX; len *= 16) {
+        _run("blocks", _blocks, len);
+        _run("ctr", _ctr, len);
+        _run("ccm", _ccm, len);
+        _run("gcm", _gcm, len);
+    }
+    puts("done.");
+
+    return 0;
+}
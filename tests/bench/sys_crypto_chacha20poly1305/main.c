@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Cycles per byte benchmark for ChaCha20-Poly1305
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "crypto/chacha.h"
+#include "crypto/chacha20poly1305.h"
+#include "crypto/poly1305.h"
+#include "periph_conf.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define MSG_MAX     (1024U)
+/* enough to run for a while on native, about a second on most MCUs */
+#ifndef BYTES
+#define BYTES       (64U * 1024U)
+#endif
+
+static const uint8_t _key[CHACHA20POLY1305_KEY_BYTES] = {
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f
+};
+static const uint8_t _nonce[CHACHA20POLY1305_NONCE_BYTES];
+static const uint8_t _adata[16];
+
+static uint8_t _in[MSG_MAX];
+static uint8_t _out[MSG_MAX + CHACHA20POLY1305_TAG_BYTES];
+
+static void _chacha20(size_t len)
+{
+    chacha20_encrypt_decrypt(_in, _out, _key, _nonce, len);
+}
+
+static void _poly1305(size_t len)
+{
+    poly1305_auth(_out, _in, len, _key);
+}
+
+static void _aead(size_t len)
+{
+    chacha20poly1305_encrypt(_out, _in, len, _adata, sizeof(_adata),
+                             _key, _nonce);
+}
+
+static void _prng(size_t len)
+{
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < len; i += sizeof(uint32_t)) {
+        sum += chacha_prng_next();
+    }
+    _out[0] = sum;
+}
+
+static void _run(const char *name, void (*process)(size_t), size_t len)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < BYTES / len; i++) {
+        process(len);
+    }
+
+    uint32_t usec = ztimer_now(ZTIMER_USEC) - start;
+    uint64_t cycles = (uint64_t)usec * (CLOCK_CORECLOCK / US_PER_SEC);
+    uint32_t cpb100 = (cycles * 100) / BYTES;
+
+    printf("%-8s %4u B: %5" PRIu32 ".%02" PRIu32 " cycles/B\n", name,
+           (unsigned)len, cpb100 / 100, cpb100 % 100);
+}
+
+int main(void)
+{
+    puts("chacha20poly1305 benchmark.");
+    printf("simd: %s\n", IS_USED(MODULE_CRYPTO_CHACHA_SIMD) ? "yes" : "no");
+
+    for (unsigned i = 0; i < MSG_MAX; i++) {
+        _in[i] = i;
+    }
+
+    for (size_t len = 64; len <= MSG_MAX; len *= 16) {
+        _run("chacha20", _chacha20, len);
+        _run("poly1305", _poly1305, len);
+        _run("aead", _aead, len);
+    }
+    _run("prng", _prng, MSG_MAX);
+    puts("done.");
+
+    return 0;
+}
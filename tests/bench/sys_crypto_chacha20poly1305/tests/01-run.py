@@ -0,0 +1,18 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("chacha20poly1305 benchmark.\r\n")
+    for _ in range(7):
+        child.expect(r"(chacha20|poly1305|aead|prng)\s+\d+ B:\s+\d+\.\d+ cycles/B\r\n")
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for SHA-256 and SHA-512
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "hashes/sha256.h"
+#include "hashes/sha512.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define BUF_SIZE    (4096U)
+/* enough to run for a while on native, less than a second on most MCUs */
+#ifndef BYTES
+#define BYTES       (256U * 1024U)
+#endif
+
+static uint8_t _buf[BUF_SIZE];
+
+static void _sha256(size_t chunk)
+{
+    sha256_context_t ctx;
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    sha256_init(&ctx);
+    for (unsigned i = 0; i < BYTES / BUF_SIZE; i++) {
+        for (size_t pos = 0; pos < BUF_SIZE; pos += chunk) {
+            sha256_update(&ctx, &_buf[pos], chunk);
+        }
+    }
+    sha256_final(&ctx, digest);
+}
+
+static void _sha512(size_t chunk)
+{
+    sha512_context_t ctx;
+    uint8_t digest[SHA512_DIGEST_LENGTH];
+
+    sha512_init(&ctx);
+    for (unsigned i = 0; i < BYTES / BUF_SIZE; i++) {
+        for (size_t pos = 0; pos < BUF_SIZE; pos += chunk) {
+            sha512_update(&ctx, &_buf[pos], chunk);
+        }
+    }
+    sha512_final(&ctx, digest);
+}
+
+static void _run(const char *name, void (*hash)(size_t), size_t chunk)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    hash(chunk);
+
+    uint32_t usec = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%s %4u B chunks: %8" PRIu32 " KiB/s\n", name, (unsigned)chunk,
+           (uint32_t)(((uint64_t)BYTES * US_PER_SEC) / 1024U / usec));
+}
+
+int main(void)
+{
+    puts("sha2 benchmark.");
+    printf("accel: %s\n", IS_USED(MODULE_HASHES_SHA2_ACCEL) ? "yes" : "no");
+
+    for (unsigned i = 0; i < BUF_SIZE; i++) {
+        _buf[i] = i;
+    }
+
+    _run("sha256", _sha256, 64);
+    _run("sha256", _sha256, BUF_SIZE);
+    _run("sha512", _sha512, 64);
+    _run("sha512", _sha512, BUF_SIZE);
+    puts("done.");
+
+    return 0;
+}
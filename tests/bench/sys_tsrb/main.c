@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark comparing the IRQ-locking tsrb with the
+ *              lock-free single-producer/single-consumer variant
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "tsrb.h"
+#include "tsrb_spsc.h"
+#include "ztimer.h"
+
+#ifndef BUFFER_SIZE
+#define BUFFER_SIZE     (256U)
+#endif
+
+#ifndef TRANSFER_SIZE
+#define TRANSFER_SIZE   (64U * 1024U)
+#endif
+
+static uint8_t _rb_buf[BUFFER_SIZE];
+static tsrb_t _rb = TSRB_INIT(_rb_buf);
+
+static uint8_t _src[BUFFER_SIZE];
+static uint8_t _dst[BUFFER_SIZE];
+
+/* chunk sizes are chosen to not divide the buffer size evenly, so that
+ * transfers regularly wrap around the end of the buffer */
+static const unsigned _chunks[] = { 1, 7, 61 };
+
+typedef struct {
+    const char *name;
+    int (*add)(tsrb_t *rb, const uint8_t *src, size_t n);
+    int (*get)(tsrb_t *rb, uint8_t *dst, size_t n);
+} _variant_t;
+
+static int _spsc_span_add(tsrb_t *rb, const uint8_t *src, size_t n)
+{
+    size_t done = 0;
+    uint8_t *span;
+
+    while (done < n) {
+        size_t len = tsrb_spsc_write_span(rb, &span);
+        if (!len) {
+            break;
+        }
+        if (len > n - done) {
+            len = n - done;
+        }
+        memcpy(span, src + done, len);
+        tsrb_spsc_commit_write(rb, len);
+        done += len;
+    }
+    return done;
+}
+
+static int _spsc_span_get(tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    size_t done = 0;
+    uint8_t *span;
+
+    while (done < n) {
+        size_t len = tsrb_spsc_peek_span(rb, &span);
+        if (!len) {
+            break;
+        }
+        if (len > n - done) {
+            len = n - done;
+        }
+        memcpy(dst + done, span, len);
+        tsrb_spsc_commit_read(rb, len);
+        done += len;
+    }
+    return done;
+}
+
+static const _variant_t _variants[] = {
+    { "tsrb", tsrb_add, tsrb_get },
+    { "tsrb_spsc", tsrb_spsc_add, tsrb_spsc_get },
+    { "tsrb_spsc span", _spsc_span_add, _spsc_span_get },
+};
+
+static int _run(const _variant_t *v, unsigned chunk)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint8_t expected = 0;
+
+    tsrb_init(&_rb, _rb_buf, sizeof(_rb_buf));
+    for (unsigned done = 0; done < TRANSFER_SIZE; done += chunk) {
+        for (unsigned i = 0; i < chunk; i++) {
+            _src[i] = (uint8_t)(done + i);
+        }
+        if (v->add(&_rb, _src, chunk) != (int)chunk) {
+            return -1;
+        }
+        if (v->get(&_rb, _dst, chunk) != (int)chunk) {
+            return -1;
+        }
+        /* only check the first byte to keep the overhead low */
+        if (_dst[0] != expected) {
+            return -1;
+        }
+        expected += chunk;
+    }
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%16s chunk %3u: %8" PRIu32 " us for %u bytes\n",
+           v->name, chunk, diff, TRANSFER_SIZE);
+    return 0;
+}
+
+int main(void)
+{
+    puts("tsrb benchmark application.\n");
+
+    for (unsigned c = 0; c < ARRAY_SIZE(_chunks); c++) {
+        for (unsigned v = 0; v < ARRAY_SIZE(_variants); v++) {
+            if (_run(&_variants[v], _chunks[c])) {
+                printf("%s: data mismatch\n", _variants[v].name);
+                return 1;
+            }
+        }
+    }
+
+    puts("done.");
+
+    return 0;
+}
@@ -17,6 +17,7 @@
 
 #include <stdio.h>
 
+#include "container.h"
 #include "test_utils/expect.h"
 
 #include "msg.h"
@@ -88,6 +89,47 @@ static void _print_result(const char *desc, unsigned n, uint32_t total)
     printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
 }
 
+/* number of concurrently set timers used by the sweep benchmark */
+static const unsigned _sweep[] = { 1, 10, 100, 1000, 10000 };
+
+/* scatters timers over the whole range (instead of increasing targets) so
+ * that both the list and the optional wheel see a realistic distribution */
+static uint32_t _sweep_val(unsigned n, unsigned numof)
+{
+    return _base + (SPREAD * ((n * 7919LU) % numof));
+}
+
+/*
+ * test setting / removing a timer REPEAT times with @p numof timers set
+ *
+ */
+static void _bench_sweep(unsigned numof)
+{
+    char desc[32];
+    uint32_t before, diff;
+
+    _base = BASE;
+    for (unsigned n = 0; n < numof; n++) {
+        ztimer_set(ZTIMER, &_timers[n], _sweep_val(n, numof));
+    }
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < REPEAT; n++) {
+        unsigned idx = (n * 31U) % numof;
+        ztimer_remove(ZTIMER, &_timers[idx]);
+        ztimer_set(ZTIMER, &_timers[idx], _sweep_val(idx, numof));
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    snprintf(desc, sizeof(desc), "remove() + set() N=%u", numof);
+    _print_result(desc, REPEAT, diff);
+
+    for (unsigned n = 0; n < numof; n++) {
+        ztimer_remove(ZTIMER, &_timers[n]);
+    }
+    expect(!_triggers);
+}
+
 int main(void)
 {
     puts("ztimer benchmark application.\n");
@@ -285,6 +327,17 @@ int main(void)
     _print_result("ztimer_now()", REPEAT, diff);
     expect(!_triggers);
 
+    /*
+     * sweep over the number of concurrently set timers
+     *
+     */
+    for (unsigned i = 0; i < ARRAY_SIZE(_sweep); i++) {
+        if (_sweep[i] > NUMOF_TIMERS) {
+            break;
+        }
+        _bench_sweep(_sweep[i]);
+    }
+
     _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, sizeof(_timers));
 
     puts("done.");
@@ -0,0 +1,247 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Test application for transport checksum offloading when a
+ *              packet is sent over several interfaces
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/udp.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define NETIF_STACKSIZE     THREAD_STACKSIZE_DEFAULT
+#define NETIF_PRIO          (THREAD_PRIORITY_MAIN - 4)
+#define MAIN_QUEUE_SIZE     (8)
+#define FRAME_MAX           (128U)
+#define PORT                (12345U)
+#define TIMEOUT_MS          (1000U)
+#define MSG_TYPE_SENT       (0x4353)
+
+/* offloading and non-offloading devices alternate, so either kind gets a
+ * copy of the packet as well as the original */
+static const bool _offload[] = { true, false, true };
+
+#define NETIF_NUMOF         ARRAY_SIZE(_offload)
+
+static const char _payload[] = "abcdefghijklmnopqrstuvwxyz";
+
+static char _netif_stacks[NETIF_NUMOF][NETIF_STACKSIZE];
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_netif_t _netifs[NETIF_NUMOF];
+static kernel_pid_t _main_pid;
+
+static struct {
+    netdev_test_t dev;
+    netopt_enable_t csum_offload;   /**< per frame flag set by gnrc_netif */
+    bool frame_offloaded;
+    uint8_t frame[FRAME_MAX];
+    size_t frame_len;
+} _devs[NETIF_NUMOF];
+
+static unsigned _dev_idx(netdev_t *dev)
+{
+    netdev_test_t *test = container_of(dev, netdev_test_t, netdev.netdev);
+
+    return (uintptr_t)test->state;
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    unsigned idx = _dev_idx(dev);
+    uint8_t frame[FRAME_MAX];
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)&frame[sizeof(ethernet_hdr_t)];
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    size_t len = 0;
+    msg_t msg = { .type = MSG_TYPE_SENT, .content = { .value = idx } };
+
+    for (; iolist; iolist = iolist->iol_next) {
+        if (len + iolist->iol_len > FRAME_MAX) {
+            /* not the test packet */
+            return iolist_size(iolist) + len;
+        }
+        memcpy(&frame[len], iolist->iol_base, iolist->iol_len);
+        len += iolist->iol_len;
+    }
+    /* ignore e.g. router solicitations */
+    if ((len < sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + sizeof(udp_hdr_t)) ||
+        (ipv6->nh != PROTNUM_UDP) || (byteorder_ntohs(udp->dst_port) != PORT)) {
+        return len;
+    }
+    memcpy(_devs[idx].frame, frame, len);
+    _devs[idx].frame_len = len;
+    _devs[idx].frame_offloaded = (_devs[idx].csum_offload == NETOPT_ENABLE);
+    msg_send(&msg, _main_pid);
+    return len;
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    const uint8_t addr[] = { 0x02, 0x13, 0x37, 0xac, 0xdc, _dev_idx(dev) };
+
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static int _get_csum_offload(netdev_t *dev, void *value, size_t max_len)
+{
+    expect(max_len == sizeof(netopt_enable_t));
+    *((netopt_enable_t *)value) = _offload[_dev_idx(dev)] ? NETOPT_ENABLE
+                                                           : NETOPT_DISABLE;
+    return sizeof(netopt_enable_t);
+}
+
+static int _set_csum_offload(netdev_t *dev, const void *value, size_t len)
+{
+    expect(len == sizeof(netopt_enable_t));
+    _devs[_dev_idx(dev)].csum_offload = *((const netopt_enable_t *)value);
+    return sizeof(netopt_enable_t);
+}
+
+static void _init_netifs(void)
+{
+    for (unsigned i = 0; i < NETIF_NUMOF; i++) {
+        netdev_test_t *dev = &_devs[i].dev;
+        ipv6_addr_t addr = IPV6_ADDR_UNSPECIFIED;
+
+        netdev_test_setup(dev, (void *)(uintptr_t)i);
+        netdev_test_set_send_cb(dev, _send);
+        netdev_test_set_get_cb(dev, NETOPT_DEVICE_TYPE, _get_device_type);
+        netdev_test_set_get_cb(dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+        netdev_test_set_get_cb(dev, NETOPT_ADDRESS, _get_address);
+        if (_offload[i]) {
+            netdev_test_set_get_cb(dev, NETOPT_L4_CSUM_OFFLOAD,
+                                   _get_csum_offload);
+            netdev_test_set_set_cb(dev, NETOPT_L4_CSUM_OFFLOAD,
+                                   _set_csum_offload);
+        }
+        expect(gnrc_netif_ethernet_create(&_netifs[i], _netif_stacks[i],
+                                          sizeof(_netif_stacks[i]), NETIF_PRIO,
+                                          "netdev_test",
+                                          &dev->netdev.netdev) == 0);
+        expect(!_offload[i] ==
+               !(_netifs[i].flags & GNRC_NETIF_FLAGS_L4_CSUM_OFFLOAD));
+        /* a valid link-local address per interface, so the pseudo headers
+         * differ */
+        ipv6_addr_set_link_local_prefix(&addr);
+        addr.u8[15] = i + 1;
+        expect(gnrc_netif_ipv6_addr_add(&_netifs[i], &addr, 64,
+                                        GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+    }
+}
+
+static void _send_to_all_nodes(void)
+{
+    gnrc_pktsnip_t *pkt;
+    ipv6_addr_t dst;
+
+    ipv6_addr_set_all_nodes_multicast(&dst, IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+    pkt = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload), GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, PORT, PORT);
+    expect(pkt != NULL);
+    /* no netif header: the packet is sent over all interfaces */
+    pkt = gnrc_ipv6_hdr_build(pkt, NULL, &dst);
+    expect(pkt != NULL);
+    expect(gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP,
+                                     GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
+}
+
+static void _check_frame(unsigned idx)
+{
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)&_devs[idx].frame[sizeof(ethernet_hdr_t)];
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    uint16_t len = byteorder_ntohs(ipv6->len);
+    uint16_t sum;
+
+    expect(_devs[idx].frame_len == sizeof(ethernet_hdr_t) +
+                                   sizeof(ipv6_hdr_t) + len);
+    expect(len == sizeof(udp_hdr_t) + sizeof(_payload));
+    expect(ipv6->nh == PROTNUM_UDP);
+    expect(memcmp(udp + 1, _payload, sizeof(_payload)) == 0);
+    expect(_devs[idx].frame_offloaded == _offload[idx]);
+    if (_offload[idx]) {
+        /* only the pseudo-header sum of this interface's header, the
+         * device completes it */
+        expect(byteorder_ntohs(udp->checksum) ==
+               ipv6_hdr_inet_csum(0, ipv6, PROTNUM_UDP, len));
+        udp->checksum = byteorder_htons(~inet_csum(0, (uint8_t *)udp, len));
+    }
+    sum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_UDP, len);
+    sum = inet_csum(sum, (uint8_t *)udp, len);
+    expect(sum == 0xffff);
+    printf("netif %u: %s checksum OK\n", idx,
+           _offload[idx] ? "offloaded" : "software");
+}
+
+int main(void)
+{
+    unsigned sent = 0;
+
+    puts("Test application for checksum offloading over several interfaces");
+    _main_pid = thread_getpid();
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    _init_netifs();
+    _send_to_all_nodes();
+
+    while (sent < NETIF_NUMOF) {
+        msg_t msg;
+
+        expect(ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg, TIMEOUT_MS) >= 0);
+        if (msg.type != MSG_TYPE_SENT) {
+            continue;
+        }
+        _check_frame(msg.content.value);
+        sent++;
+    }
+    for (unsigned i = 0; i < NETIF_NUMOF; i++) {
+        ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)&_devs[i].frame[sizeof(ethernet_hdr_t)];
+
+        /* every interface fills in its own source address */
+        for (unsigned j = 0; j < i; j++) {
+            expect(!ipv6_addr_equal(
+                &ipv6->src,
+                &((ipv6_hdr_t *)&_devs[j].frame[sizeof(ethernet_hdr_t)])->src));
+        }
+    }
+
+    puts("TEST PASSED");
+
+    return 0;
+}
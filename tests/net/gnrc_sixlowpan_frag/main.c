@@ -232,10 +232,20 @@ static void _test_entry(const gnrc_sixlowpan_frag_rb_t *entry,
                         "entry->super.dst != TEST_NETIF_HDR_DST");
     TEST_ASSERT_EQUAL_INT(TEST_TAG, entry->super.tag);
     TEST_ASSERT_EQUAL_INT(exp_current_size, entry->super.current_size);
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+    /* exactly the 8-byte blocks of the interval are marked as received */
+    for (unsigned i = 0; i < (sizeof(entry->super.covered) * 8); i++) {
+        TEST_ASSERT_EQUAL_INT(((exp_int_start / 8) <= i) &&
+                              (i <= (exp_int_end / 8)),
+                              bf_isset(entry->super.covered, i));
+    }
+    TEST_ASSERT_EQUAL_INT(1, entry->super.frags);
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
     TEST_ASSERT_NOT_NULL(entry->super.ints);
     TEST_ASSERT_NULL(entry->super.ints->next);
     TEST_ASSERT_EQUAL_INT(exp_int_start, entry->super.ints->start);
     TEST_ASSERT_EQUAL_INT(exp_int_end, entry->super.ints->end);
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
 }
 
 static void _check_pktbuf(const gnrc_sixlowpan_frag_rb_t *entry)
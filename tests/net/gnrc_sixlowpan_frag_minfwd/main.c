@@ -291,6 +291,7 @@ static gnrc_pktsnip_t *_create_send_datagram(bool compressed, bool payload);
 static size_t _wait_for_packet(size_t exp_size);
 static void _check_vrbe_values(gnrc_sixlowpan_frag_vrb_t *vrbe,
                                size_t mhr_len, int frag_type);
+static void _check_vrbe_first_frag_only(gnrc_sixlowpan_frag_vrb_t *vrbe);
 static void _check_1st_frag_uncomp(size_t mhr_len, uint8_t exp_hl_diff);
 static void _check_send_frag1(size_t mhr_len, bool check_tag);
 static void _check_send_frag2(size_t mhr_len, bool check_tag);
@@ -818,9 +819,7 @@ static void test_sixlo_recv__1st_frag_uncomp(void)
     _check_vrbe_values(vrbe, mhr_len, FIRST_FRAGMENT);
     TEST_ASSERT_EQUAL_INT(TEST_1ST_FRAG_UNCOMP_SIZE,
                           vrbe->super.current_size);
-    /* only the received fragment is registered */
-    TEST_ASSERT_NOT_NULL(vrbe->super.ints);
-    TEST_ASSERT_NULL(vrbe->super.ints->next);
+    _check_vrbe_first_frag_only(vrbe);
     TEST_ASSERT(_target_buf[0] & IEEE802154_FCF_FRAME_PEND);
     _check_1st_frag_uncomp(mhr_len, 1U);
 }
@@ -943,9 +942,7 @@ static void test_sixlo_recv__1st_frag_comp(void)
     _check_vrbe_values(vrbe, mhr_len, FIRST_FRAGMENT);
     TEST_ASSERT_EQUAL_INT(TEST_1ST_FRAG_COMP_FRAG_SIZE,
                           vrbe->super.current_size);
-    /* only the received fragment is registered */
-    TEST_ASSERT_NOT_NULL(vrbe->super.ints);
-    TEST_ASSERT_NULL(vrbe->super.ints->next);
+    _check_vrbe_first_frag_only(vrbe);
     TEST_ASSERT(_target_buf[0] & IEEE802154_FCF_FRAME_PEND);
     TEST_ASSERT_MESSAGE(
             memcmp(&_test_1st_frag_comp[TEST_1ST_FRAG_COMP_PAYLOAD_POS],
@@ -994,9 +991,7 @@ static void test_sixlo_recv__1st_frag_comp__only_iphc(void)
     _check_vrbe_values(vrbe, mhr_len, FIRST_FRAGMENT);
     TEST_ASSERT_EQUAL_INT(TEST_1ST_FRAG_COMP_ONLY_IPHC_FRAG_SIZE,
                           vrbe->super.current_size);
-    /* only the received fragment is registered */
-    TEST_ASSERT_NOT_NULL(vrbe->super.ints);
-    TEST_ASSERT_NULL(vrbe->super.ints->next);
+    _check_vrbe_first_frag_only(vrbe);
     TEST_ASSERT(_target_buf[0] & IEEE802154_FCF_FRAME_PEND);
     TEST_ASSERT_MESSAGE(
             memcmp(&_test_1st_frag_comp[TEST_1ST_FRAG_COMP_PAYLOAD_POS],
@@ -1038,9 +1033,7 @@ static void test_sixlo_recv__1st_frag_comp__only_iphc_no_nhc(void)
         )));
     _check_vrbe_values(vrbe, mhr_len, FIRST_FRAGMENT);
     TEST_ASSERT_EQUAL_INT(TEST_SEND_FRAG1_SIZE, vrbe->super.current_size);
-    /* only the received fragment is registered */
-    TEST_ASSERT_NOT_NULL(vrbe->super.ints);
-    TEST_ASSERT_NULL(vrbe->super.ints->next);
+    _check_vrbe_first_frag_only(vrbe);
     TEST_ASSERT(_target_buf[0] & IEEE802154_FCF_FRAME_PEND);
     TEST_ASSERT_MESSAGE(
             memcmp(&_test_send_frag1[TEST_SEND_FRAG1_PAYLOAD_POS],
@@ -1627,6 +1620,18 @@ static size_t _wait_for_packet(size_t exp_size)
     return mhr_len;
 }
 
+static void _check_vrbe_first_frag_only(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    /* only the received fragment is registered */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+    TEST_ASSERT(bf_isset(vrbe->super.covered, 0));
+    TEST_ASSERT_EQUAL_INT(1, vrbe->super.frags);
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
+    TEST_ASSERT_NOT_NULL(vrbe->super.ints);
+    TEST_ASSERT_NULL(vrbe->super.ints->next);
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
+}
+
 static void _check_vrbe_values(gnrc_sixlowpan_frag_vrb_t *vrbe,
                                size_t mhr_len, int frag_type)
 {
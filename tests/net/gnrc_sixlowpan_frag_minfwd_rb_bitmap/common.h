@@ -0,0 +1 @@
+../gnrc_sixlowpan_frag_minfwd/common.h
\ No newline at end of file
@@ -0,0 +1 @@
+../gnrc_sixlowpan_frag_sfr/main.c
\ No newline at end of file
@@ -0,0 +1 @@
+../gnrc_sixlowpan_frag_sfr/mockup_netif.c
\ No newline at end of file
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import os
+import sys
+import time
+
+from helpers import Runner, RiotTcpServer, HostTcpClient, RawTcpPeer, \
+                    generate_port_number, sudo_guard
+
+_SACK_PERMITTED = 4
+_SACK = 5
+
+
+@Runner(timeout=10)
+def test_gnrc_tcp_recv_out_of_order_segments(child):
+    """ Segments after a lost segment are held, reported in SACK options and
+        delivered once the lost segment is retransmitted
+    """
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        host_cli = HostTcpClient(riot_srv)
+        with RawTcpPeer(child, riot_srv, host_cli.interface) as peer:
+            child.sendline('gnrc_tcp_accept 2000')
+            assert _SACK_PERMITTED in peer.connect()
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+            riot_srv.opened = True
+
+            data = 'ABCDEFGHIJ' * 30
+            isn = peer.seq
+            seq = lambda offset: (isn + offset) & 0xFFFFFFFF  # noqa: E731
+
+            # The first segment is lost: the others are acknowledged selectively
+            peer.send_data(100, data[100:200].encode())
+            ack = peer.expect(lambda seg: seg['flags'] & peer.ACK)
+            assert ack['ack'] == isn
+            assert ack['options'][_SACK] == [(seq(100), seq(200))]
+
+            peer.send_data(200, data[200:300].encode())
+            ack = peer.expect(lambda seg: seg['flags'] & peer.ACK)
+            assert ack['ack'] == isn
+            assert ack['options'][_SACK] == [(seq(100), seq(300))]
+
+            # The retransmission fills the gap: all data is acknowledged
+            peer.send_data(0, data[0:100].encode())
+            ack = peer.expect(lambda seg: seg['flags'] & peer.ACK)
+            assert ack['ack'] == seq(300)
+            assert _SACK not in ack['options']
+
+            riot_srv.receive(timeout_ms=1000, sent_payload=data)
+            riot_srv.abort()
+
+
+@Runner(timeout=10)
+def test_gnrc_tcp_send_fast_retransmit(child):
+    """ Duplicate ACKs trigger a retransmission well before the retransmission
+        timeout of at least one second
+    """
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        host_cli = HostTcpClient(riot_srv)
+        with RawTcpPeer(child, riot_srv, host_cli.interface) as peer:
+            child.sendline('gnrc_tcp_accept 2000')
+            peer.connect(mss=100)
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+            riot_srv.opened = True
+
+            # Data is sent in several segments at once (gnrc_tcp_gso)
+            data = 'ABCDEFGHIJ' * 40
+            assert riot_srv._setup_internal_buffer() >= len(data)
+            # short lines: the stdin buffer of native drops longer input
+            for i in range(0, len(data), 40):
+                child.sendline('buffer_write {} {}'.format(i, data[i:i + 40]))
+                child.expect_exact('buffer_write: argc=3')
+            child.sendline('gnrc_tcp_send 5000 {}'.format(len(data)))
+
+            isn = peer.ack
+            segs = []
+            while sum(len(seg['payload']) for seg in segs) < len(data):
+                segs.append(peer.expect(lambda seg: len(seg['payload']) > 0))
+            assert segs[0]['seq'] == isn
+
+            # The first segment is lost: acknowledge the others as duplicates
+            start = time.monotonic()
+            for seg in segs[1:]:
+                peer.send(peer.ACK, ack=isn)
+            retransmit = peer.expect(lambda seg: len(seg['payload']) > 0 and seg['seq'] == isn)
+            assert time.monotonic() - start < 0.5
+            assert retransmit['payload'] == data[:len(retransmit['payload'])].encode()
+
+            peer.send(peer.ACK, ack=(isn + len(data)) & 0xFFFFFFFF)
+            child.expect_exact('gnrc_tcp_send: sent {}'.format(len(data)))
+            riot_srv.abort()
+
+
+if __name__ == '__main__':
+    sudo_guard(uses_scapy=True)
+
+    # Read and run all test functions.
+    script = sys.modules[__name__]
+    tests = [getattr(script, t) for t in script.__dict__
+             if type(getattr(script, t)).__name__ == 'function'
+             and t.startswith('test_')]
+
+    for test in tests:
+        res = test()
+        if (res != 0):
+            sys.exit(res)
+
+    print('\n' + os.path.basename(sys.argv[0]) + ': success\n')
@@ -8,8 +8,11 @@
 import sys
 import os
 import re
+import select
 import socket
+import struct
 import random
+import time
 import testrunner
 
 
@@ -305,6 +308,125 @@ class RiotTcpClient(_RiotTcpNode):
         self.opened = True
 
 
+class RawTcpPeer:
+    """ TCP peer built from raw Ethernet frames, to inject loss and reordering.
+
+        The peer uses an address unknown to the host system. Its neighbor
+        cache entry is added to the RIOT node, so that neither neighbor
+        discovery nor the TCP stack of the host system interferes.
+    """
+    ETH_P_IPV6 = 0x86DD
+    FIN, SYN, RST, PSH, ACK = 0x01, 0x02, 0x04, 0x08, 0x10
+
+    def __init__(self, child, target, interface, address='fe80::dead',
+                 mac='02:00:00:00:de:ad'):
+        self.child = child
+        self.target = target
+        self.address = address
+        self.mac = mac
+        self.port = generate_port_number()
+        self.seq = random.randint(0, 0xFFFFFFFF)
+        self.ack = 0
+        self.interface = interface
+        self.sock = socket.socket(socket.AF_PACKET, socket.SOCK_RAW,
+                                  socket.htons(self.ETH_P_IPV6))
+        self.sock.bind((self.interface, self.ETH_P_IPV6))
+        self.child.sendline('nib neigh add {} {} {}'.format(
+            target.interface, self.address, self.mac)
+        )
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, _1, _2, _3):
+        self.sock.close()
+        self.child.sendline('nib neigh del {} {}'.format(self.target.interface, self.address))
+
+    def connect(self, mss=1220, sack_permitted=True):
+        """ Performs the handshake, returns the options of the SYN+ACK """
+        options = struct.pack('!BBH', 2, 4, mss)
+        if sack_permitted:
+            options += bytes([1, 1, 4, 2])
+        self.send(self.SYN, options=options)
+        syn_ack = self.expect(lambda seg: seg['flags'] & self.SYN)
+        self.seq = (self.seq + 1) & 0xFFFFFFFF
+        self.ack = (syn_ack['seq'] + 1) & 0xFFFFFFFF
+        self.send(self.ACK)
+        return syn_ack['options']
+
+    def send(self, flags, payload=b'', seq=None, ack=None, options=b'', window=65535):
+        seq = self.seq if seq is None else seq
+        ack = self.ack if ack is None else ack
+        tcp = struct.pack('!HHIIBBHHH', self.port, int(self.target.listen_port), seq,
+                          ack, (5 + len(options) // 4) << 4, flags, window, 0, 0)
+        tcp += options + payload
+        src = socket.inet_pton(socket.AF_INET6, self.address)
+        dst = socket.inet_pton(socket.AF_INET6, self.target.address)
+        pseudo = src + dst + struct.pack('!IxxxB', len(tcp), 6)
+        tcp = tcp[:16] + struct.pack('!H', self._csum(pseudo + tcp)) + tcp[18:]
+        ipv6 = struct.pack('!IHBB', 6 << 28, len(tcp), 6, 64) + src + dst
+        eth = self._mac(self.target.mac) + self._mac(self.mac) + \
+            struct.pack('!H', self.ETH_P_IPV6)
+        self.sock.send(eth + ipv6 + tcp)
+
+    def send_data(self, offset, payload, flags=PSH | ACK):
+        self.send(flags, payload, seq=(self.seq + offset) & 0xFFFFFFFF)
+
+    def expect(self, match, timeout=2):
+        """ Returns the first segment from the RIOT node that satisfies match """
+        deadline = time.monotonic() + timeout
+        while True:
+            left = deadline - time.monotonic()
+            assert left > 0, 'no matching segment received'
+            if not select.select([self.sock], [], [], left)[0]:
+                continue
+            seg = self._parse(self.sock.recv(2048))
+            if seg is not None and match(seg):
+                return seg
+
+    def _parse(self, frame):
+        ipv6 = frame[14:54]
+        if len(ipv6) < 40 or ipv6[6] != 6 or \
+           ipv6[24:40] != socket.inet_pton(socket.AF_INET6, self.address):
+            return None
+        tcp = frame[54:54 + struct.unpack('!H', ipv6[4:6])[0]]
+        sport, dport, seq, ack, off, flags, window = struct.unpack('!HHIIBBH', tcp[:16])
+        if dport != self.port:
+            return None
+        return {'seq': seq, 'ack': ack, 'flags': flags, 'window': window,
+                'options': self._parse_options(tcp[20:(off >> 4) * 4]),
+                'payload': tcp[(off >> 4) * 4:]}
+
+    @staticmethod
+    def _parse_options(raw_opts):
+        options = {}
+        i = 0
+        while i < len(raw_opts) and raw_opts[i] != 0:
+            if raw_opts[i] == 1:
+                i += 1
+                continue
+            kind, length = raw_opts[i], raw_opts[i + 1]
+            value = raw_opts[i + 2:i + length]
+            if kind == 5:
+                value = [struct.unpack('!II', value[j:j + 8]) for j in range(0, len(value), 8)]
+            options[kind] = value
+            i += length
+        return options
+
+    @staticmethod
+    def _mac(mac):
+        return bytes(int(b, 16) for b in mac.replace('-', ':').split(':'))
+
+    @staticmethod
+    def _csum(data):
+        if len(data) % 2:
+            data += b'\0'
+        csum = sum(struct.unpack('!{}H'.format(len(data) // 2), data))
+        while csum >> 16:
+            csum = (csum & 0xFFFF) + (csum >> 16)
+        return ~csum & 0xFFFF
+
+
 def generate_port_number():
     return random.randint(1024, 65535)
 
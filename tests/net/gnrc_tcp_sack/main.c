@@ -0,0 +1,359 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Test application for the reassembly of TCP segments received
+ *              out of order and the SACK blocks acknowledging them
+ *
+ * The main thread plays the peer: it injects segments into the IPv6 layer and
+ * checks the acknowledgements sent over a @ref netdev_test device.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/af.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/tcp.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/tcp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define NETIF_STACKSIZE     THREAD_STACKSIZE_DEFAULT
+#define NETIF_PRIO          (THREAD_PRIORITY_MAIN - 4)
+#define SERVER_STACKSIZE    THREAD_STACKSIZE_DEFAULT
+#define SERVER_PRIO         (THREAD_PRIORITY_MAIN - 1)
+#define MAIN_QUEUE_SIZE     (8)
+#define FRAME_MAX           (256U)
+#define PORT                (12345U)
+#define PEER_PORT           (54321U)
+#define PEER_ISS            (0xfffffe00UL)  /* wraps around during the test */
+#define PEER_WINDOW         (1024U)
+#define TIMEOUT_MS          (1000U)
+#define MSG_TYPE_SENT       (0x5443)
+#define MSG_TYPE_RCVD       (0x5444)
+
+#define SEG_LEN             (100U)
+#define SEG_NUMOF           (4U)
+#define DATA_LEN            (SEG_LEN * SEG_NUMOF)
+#define SACK_BLOCKS_MAX     (4U)
+#define SEGS_NUMOF          (4U)            /* captured segments in flight */
+
+#define CTL_FIN             (0x01)
+#define CTL_SYN             (0x02)
+#define CTL_ACK             (0x10)
+#define CTL_MASK            (0x3f)
+
+/**
+ * @brief   A segment sent by the TCP under test
+ */
+typedef struct {
+    uint32_t seq;
+    uint32_t ack;
+    uint8_t ctl;
+    unsigned sack_numof;
+    uint32_t sack[2 * SACK_BLOCKS_MAX];
+} _seg_t;
+
+static const uint8_t _local_l2addr[] = { 0x02, 0x13, 0x37, 0xac, 0xdc, 0x01 };
+static const uint8_t _peer_l2addr[] = { 0x02, 0x13, 0x37, 0xac, 0xdc, 0x02 };
+
+static char _netif_stack[NETIF_STACKSIZE];
+static char _server_stack[SERVER_STACKSIZE];
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static kernel_pid_t _main_pid;
+static ipv6_addr_t _local_addr;
+static ipv6_addr_t _peer_addr;
+
+static _seg_t _segs[SEGS_NUMOF];
+static unsigned _segs_next;
+
+static gnrc_tcp_tcb_queue_t _queue;
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _data[DATA_LEN];
+/* one byte more, so a read never asks for 0 bytes */
+static uint8_t _rcvd[DATA_LEN + 1];
+
+static void _parse_options(_seg_t *seg, const uint8_t *opt, size_t len)
+{
+    while (len > 0) {
+        if (opt[0] == TCP_OPTION_KIND_EOL) {
+            break;
+        }
+        if (opt[0] == TCP_OPTION_KIND_NOP) {
+            opt++;
+            len--;
+            continue;
+        }
+        expect((len >= TCP_OPTION_LENGTH_MIN) && (opt[1] >= TCP_OPTION_LENGTH_MIN) &&
+               (opt[1] <= len));
+        if (opt[0] == TCP_OPTION_KIND_SACK) {
+            unsigned numof = (opt[1] - TCP_OPTION_LENGTH_MIN) /
+                             TCP_OPTION_LENGTH_SACK_BLOCK;
+
+            expect(numof <= SACK_BLOCKS_MAX);
+            for (unsigned i = 0; i < 2 * numof; i++) {
+                network_uint32_t edge;
+
+                memcpy(&edge, &opt[TCP_OPTION_LENGTH_MIN + (4 * i)], sizeof(edge));
+                seg->sack[i] = byteorder_ntohl(edge);
+            }
+            seg->sack_numof = numof;
+        }
+        len -= opt[1];
+        opt += opt[1];
+    }
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    uint8_t frame[FRAME_MAX];
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)&frame[sizeof(ethernet_hdr_t)];
+    tcp_hdr_t *tcp = (tcp_hdr_t *)(ipv6 + 1);
+    size_t len = 0;
+    _seg_t *seg = &_segs[_segs_next];
+    msg_t msg = { .type = MSG_TYPE_SENT, .content = { .ptr = seg } };
+
+    (void)dev;
+    for (; iolist; iolist = iolist->iol_next) {
+        if (len + iolist->iol_len > FRAME_MAX) {
+            /* not a segment of the test */
+            return iolist_size(iolist) + len;
+        }
+        memcpy(&frame[len], iolist->iol_base, iolist->iol_len);
+        len += iolist->iol_len;
+    }
+    /* ignore e.g. router solicitations */
+    if ((len < sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + sizeof(tcp_hdr_t)) ||
+        (ipv6->nh != PROTNUM_TCP) || (byteorder_ntohs(tcp->src_port) != PORT)) {
+        return len;
+    }
+    memset(seg, 0, sizeof(*seg));
+    seg->seq = byteorder_ntohl(tcp->seq_num);
+    seg->ack = byteorder_ntohl(tcp->ack_num);
+    seg->ctl = byteorder_ntohs(tcp->off_ctl) & CTL_MASK;
+    _parse_options(seg, (uint8_t *)(tcp + 1),
+                   ((byteorder_ntohs(tcp->off_ctl) >> 12) * 4) - sizeof(tcp_hdr_t));
+    _segs_next = (_segs_next + 1) % SEGS_NUMOF;
+    msg_send(&msg, _main_pid);
+    return len;
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_local_l2addr));
+    memcpy(value, _local_l2addr, sizeof(_local_l2addr));
+    return sizeof(_local_l2addr);
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_send_cb(&_dev, _send);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                      NETIF_PRIO, "netdev_test",
+                                      &_dev.netdev.netdev) == 0);
+    /* a valid address and a known peer, so neither waits for neighbor
+     * discovery */
+    ipv6_addr_set_link_local_prefix(&_local_addr);
+    _local_addr.u8[15] = 1;
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_local_addr, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+    ipv6_addr_set_link_local_prefix(&_peer_addr);
+    _peer_addr.u8[15] = 2;
+    expect(gnrc_ipv6_nib_nc_set(&_peer_addr, _netif.pid, _peer_l2addr,
+                                sizeof(_peer_l2addr)) == 0);
+}
+
+static void *_server(void *arg)
+{
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_tcb_t *tcb;
+    size_t total = 0;
+    ssize_t res;
+    msg_t msg = { .type = MSG_TYPE_RCVD };
+
+    (void)arg;
+    gnrc_tcp_tcb_init(&_tcb);
+    gnrc_tcp_tcb_queue_init(&_queue);
+    expect(gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, PORT, 0) == 0);
+    expect(gnrc_tcp_listen(&_queue, &_tcb, 1, &local) == 0);
+    expect(gnrc_tcp_accept(&_queue, &tcb, TIMEOUT_MS) == 0);
+    /* until the FIN, so it is lost if this times out */
+    while ((res = gnrc_tcp_recv(tcb, &_rcvd[total], sizeof(_rcvd) - total,
+                                TIMEOUT_MS)) > 0) {
+        total += res;
+    }
+    expect(res == 0);
+    msg.content.value = total;
+    msg_send(&msg, _main_pid);
+    return NULL;
+}
+
+static void _inject(uint32_t seq, uint32_t ack, uint8_t ctl,
+                    const uint8_t *opt, size_t opt_len, const uint8_t *data)
+{
+    uint8_t buf[sizeof(ipv6_hdr_t) + sizeof(tcp_hdr_t) + 4 + SEG_LEN];
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)buf;
+    tcp_hdr_t *tcp = (tcp_hdr_t *)(ipv6 + 1);
+    size_t hdr_len = sizeof(tcp_hdr_t) + opt_len;
+    size_t len = hdr_len + (data ? SEG_LEN : 0);
+    gnrc_pktsnip_t *pkt, *netif_hdr;
+    uint16_t sum;
+
+    expect((opt_len <= 4) && ((opt_len % 4) == 0));
+    memset(buf, 0, sizeof(buf));
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(len);
+    ipv6->nh = PROTNUM_TCP;
+    ipv6->hl = 64;
+    ipv6->src = _peer_addr;
+    ipv6->dst = _local_addr;
+    tcp->src_port = byteorder_htons(PEER_PORT);
+    tcp->dst_port = byteorder_htons(PORT);
+    tcp->seq_num = byteorder_htonl(seq);
+    tcp->ack_num = byteorder_htonl(ack);
+    tcp->off_ctl = byteorder_htons(((hdr_len / 4) << 12) | ctl);
+    tcp->window = byteorder_htons(PEER_WINDOW);
+    memcpy(tcp + 1, opt, opt_len);
+    if (data) {
+        memcpy((uint8_t *)tcp + hdr_len, data, SEG_LEN);
+    }
+    sum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_TCP, len);
+    sum = inet_csum(sum, (uint8_t *)tcp, len);
+    tcp->checksum = byteorder_htons(~sum);
+
+    pkt = gnrc_pktbuf_add(NULL, buf, sizeof(ipv6_hdr_t) + len, GNRC_NETTYPE_IPV6);
+    expect(pkt != NULL);
+    netif_hdr = gnrc_netif_hdr_build(_peer_l2addr, sizeof(_peer_l2addr),
+                                     _local_l2addr, sizeof(_local_l2addr));
+    expect(netif_hdr != NULL);
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    pkt = gnrc_pkt_append(pkt, netif_hdr);
+    expect(gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                        GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
+}
+
+static const _seg_t *_sent(void)
+{
+    msg_t msg;
+
+    do {
+        expect(ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg, TIMEOUT_MS) >= 0);
+    } while (msg.type != MSG_TYPE_SENT);
+    return msg.content.ptr;
+}
+
+/* sends the segment of data with index idx and checks the acknowledgement */
+static void _send_data(uint32_t iss, uint32_t snd_una, unsigned idx,
+                       uint32_t ack, const uint32_t *sack, unsigned sack_numof)
+{
+    uint32_t base = PEER_ISS + 1;
+    uint8_t ctl = CTL_ACK | ((idx == SEG_NUMOF - 1) ? CTL_FIN : 0);
+    const _seg_t *seg;
+
+    _inject(base + (idx * SEG_LEN), snd_una, ctl, NULL, 0, &_data[idx * SEG_LEN]);
+    seg = _sent();
+    printf("segment %u: ACK %" PRIu32, idx, seg->ack - base);
+    for (unsigned i = 0; i < seg->sack_numof; i++) {
+        printf(", SACK %" PRIu32 "-%" PRIu32, seg->sack[2 * i] - base,
+               seg->sack[(2 * i) + 1] - base);
+    }
+    puts("");
+    expect(seg->ctl == CTL_ACK);
+    expect(seg->seq == iss + 1);
+    expect(seg->ack == base + ack);
+    expect(seg->sack_numof == sack_numof);
+    for (unsigned i = 0; i < 2 * sack_numof; i++) {
+        expect(seg->sack[i] == base + sack[i]);
+    }
+}
+
+int main(void)
+{
+    /* SACK-permitted, padded */
+    static const uint8_t syn_opt[] = {
+        TCP_OPTION_KIND_SACK_PERMITTED, TCP_OPTION_LENGTH_SACK_PERMITTED,
+        TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+    };
+    const _seg_t *seg;
+    uint32_t iss;
+    msg_t msg;
+
+    puts("Test application for TCP reassembly and SACK blocks");
+    _main_pid = thread_getpid();
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    for (unsigned i = 0; i < DATA_LEN; i++) {
+        _data[i] = i;
+    }
+    _init_netif();
+    thread_create(_server_stack, sizeof(_server_stack), SERVER_PRIO, 0,
+                  _server, NULL, "server");
+
+    /* three-way handshake */
+    _inject(PEER_ISS, 0, CTL_SYN, syn_opt, sizeof(syn_opt), NULL);
+    seg = _sent();
+    expect(seg->ctl == (CTL_SYN | CTL_ACK));
+    expect(seg->ack == PEER_ISS + 1);
+    iss = seg->seq;
+    _inject(PEER_ISS + 1, iss + 1, CTL_ACK, NULL, 0, NULL);
+
+    /* the segments arrive in the order 3 (with the FIN), 1, 2, 0: each one
+     * after the gap is acknowledged with the blocks held, the one most recently
+     * received first */
+    _send_data(iss, iss + 1, 3, 0, (const uint32_t []){ 300, 400 }, 1);
+    _send_data(iss, iss + 1, 1, 0, (const uint32_t []){ 100, 200, 300, 400 }, 2);
+    _send_data(iss, iss + 1, 2, 0, (const uint32_t []){ 100, 400 }, 1);
+    /* filling the gap acknowledges all data and the FIN */
+    _send_data(iss, iss + 1, 0, DATA_LEN + 1, NULL, 0);
+
+    do {
+        expect(ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg, TIMEOUT_MS) >= 0);
+    } while (msg.type != MSG_TYPE_RCVD);
+    printf("received %u bytes\n", (unsigned)msg.content.value);
+    expect(msg.content.value == DATA_LEN);
+    expect(memcmp(_rcvd, _data, DATA_LEN) == 0);
+
+    puts("TEST PASSED");
+
+    return 0;
+}
@@ -17,6 +17,7 @@ int main(void)
     TESTS_RUN(tests_crypto_cipher_tests());
     TESTS_RUN(tests_crypto_modes_ccm_tests());
     TESTS_RUN(tests_crypto_modes_ocb_tests());
+    TESTS_RUN(tests_crypto_modes_gcm_tests());
     TESTS_RUN(tests_crypto_modes_ecb_tests());
     TESTS_RUN(tests_crypto_modes_cbc_tests());
     TESTS_RUN(tests_crypto_modes_ctr_tests());
@@ -8,6 +8,7 @@
 
 #include "crypto/chacha.h"
 
+#include <stdalign.h>
 #include <string.h>
 
 /*
@@ -105,7 +106,7 @@ static void _test_crypto_chacha(unsigned rounds, unsigned keylen,
                                 const uint8_t block1[64])
 {
     chacha_ctx ctx;
-    uint8_t block[64];
+    alignas(uint32_t) uint8_t block[64];
 
     TEST_ASSERT_EQUAL_INT(0, chacha_init(&ctx, rounds, key, keylen, iv));
     TEST_ASSERT_EQUAL_INT(0, memcmp(ctx.state, after_init, 64));
@@ -135,12 +136,42 @@ static void test_crypto_chacha20_tc8(void)
                         TC8_CHACHA20_BLOCK0, TC8_CHACHA20_BLOCK1);
 }
 
+/* several blocks at once must give the same as one block at a time */
+static void _test_crypto_chacha_blocks(unsigned rounds, uint32_t counter)
+{
+    static alignas(uint32_t) uint8_t blocks[11 * 64];
+    chacha_ctx ctx;
+    chacha_ctx ref;
+    alignas(uint32_t) uint8_t block[64];
+
+    TEST_ASSERT_EQUAL_INT(0, chacha_init(&ctx, rounds, TC8_KEY, 16, TC8_IV));
+    ctx.state[12] = counter;
+    ref = ctx;
+
+    chacha_keystream_blocks(&ctx, blocks, 11);
+    for (unsigned i = 0; i < 11; i++) {
+        chacha_keystream_bytes(&ref, block);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(&blocks[i * 64], block, 64));
+    }
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ctx.state, ref.state, 64));
+}
+
+static void test_crypto_chacha_blocks(void)
+{
+    _test_crypto_chacha_blocks(8, 0);
+    _test_crypto_chacha_blocks(12, 0);
+    _test_crypto_chacha_blocks(20, 0);
+    /* the counter carries into its high word */
+    _test_crypto_chacha_blocks(20, UINT32_MAX - 6);
+}
+
 Test *tests_crypto_chacha_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_chacha8_tc8),
         new_TestFixture(test_crypto_chacha12_tc8),
         new_TestFixture(test_crypto_chacha20_tc8),
+        new_TestFixture(test_crypto_chacha_blocks),
     };
     EMB_UNIT_TESTCALLER(crypto_chacha_tests, NULL, NULL, fixtures);
     return (Test *)&crypto_chacha_tests;
@@ -79,10 +79,44 @@ static void test_crypto_chacha20poly1305_1(void)
     _test_chacha20poly1305(key_1, nonce_1, msg_1, sizeof(msg_1), aad_1, sizeof(aad_1));
 }
 
+/* Longer than the blocks computed at once, generated with OpenSSL */
+#define LONG_MSG_LEN    (1000U)
+
+static const uint8_t tag_long[] = {
+    0xab, 0xc7, 0x6a, 0x1c, 0x11, 0xf4, 0x27, 0xd1, 0x5c, 0x9b, 0xec, 0xe6,
+    0x10, 0x41, 0xc8, 0xc9,
+};
+
+static const uint8_t ciphertext_long_end[] = {
+    0xf6, 0x16, 0xe3, 0xf5, 0x40, 0xde, 0x77, 0x30, 0x20, 0x14, 0x5c, 0xcc,
+    0x66, 0xf5, 0x0f, 0x7f,
+};
+
+static void test_crypto_chacha20poly1305_long(void)
+{
+    for (unsigned i = 0; i < LONG_MSG_LEN; i++) {
+        pbuf[i] = i * 7;
+    }
+    chacha20poly1305_encrypt(ebuf, pbuf, LONG_MSG_LEN, aad_1, sizeof(aad_1),
+                             key_1, nonce_1);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&ebuf[LONG_MSG_LEN - 16],
+                                    ciphertext_long_end, 16));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&ebuf[LONG_MSG_LEN], tag_long, 16));
+
+    /* decrypt in place */
+    size_t len;
+    TEST_ASSERT_EQUAL_INT(1,
+            chacha20poly1305_decrypt(ebuf, LONG_MSG_LEN + 16, ebuf, &len,
+                                     aad_1, sizeof(aad_1), key_1, nonce_1));
+    TEST_ASSERT_EQUAL_INT(LONG_MSG_LEN, len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ebuf, pbuf, LONG_MSG_LEN));
+}
+
 Test *tests_crypto_chacha20poly1305_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_chacha20poly1305_1),
+        new_TestFixture(test_crypto_chacha20poly1305_long),
     };
     EMB_UNIT_TESTCALLER(crypto_chacha20poly1305_tests, NULL, NULL, fixtures);
     return (Test *) &crypto_chacha20poly1305_tests;
@@ -0,0 +1,405 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#include <string.h>
+
+#include "crypto/ciphers.h"
+#include "crypto/modes/gcm.h"
+#include "kernel_defines.h"
+#include "tests-crypto.h"
+
+/* Test vectors from "The Galois/Counter Mode of Operation (GCM)" by McGrew and
+ * Viega, the last two with other key sizes and their results computed with
+ * OpenSSL */
+
+/* Test Case 1 */
+static const uint8_t TEST_1_KEY[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#define TEST_1_KEY_LEN sizeof(TEST_1_KEY)
+static const uint8_t TEST_1_NONCE[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+#define TEST_1_NONCE_LEN sizeof(TEST_1_NONCE)
+#define TEST_1_ADATA NULL
+#define TEST_1_ADATA_LEN 0
+#define TEST_1_INPUT NULL
+#define TEST_1_INPUT_LEN 0
+static const uint8_t TEST_1_EXPECTED[] = {
+    0x58, 0xe2, 0xfc, 0xce, 0xfa, 0x7e, 0x30, 0x61,
+    0x36, 0x7f, 0x1d, 0x57, 0xa4, 0xe7, 0x45, 0x5a,
+};
+#define TEST_1_EXPECTED_LEN sizeof(TEST_1_EXPECTED)
+
+/* Test Case 2 */
+static const uint8_t TEST_2_KEY[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#define TEST_2_KEY_LEN sizeof(TEST_2_KEY)
+static const uint8_t TEST_2_NONCE[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+#define TEST_2_NONCE_LEN sizeof(TEST_2_NONCE)
+#define TEST_2_ADATA NULL
+#define TEST_2_ADATA_LEN 0
+static const uint8_t TEST_2_INPUT[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#define TEST_2_INPUT_LEN sizeof(TEST_2_INPUT)
+static const uint8_t TEST_2_EXPECTED[] = {
+    0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92,
+    0xf3, 0x28, 0xc2, 0xb9, 0x71, 0xb2, 0xfe, 0x78,
+    0xab, 0x6e, 0x47, 0xd4, 0x2c, 0xec, 0x13, 0xbd,
+    0xf5, 0x3a, 0x67, 0xb2, 0x12, 0x57, 0xbd, 0xdf,
+};
+#define TEST_2_EXPECTED_LEN sizeof(TEST_2_EXPECTED)
+
+/* Test Case 3 */
+static const uint8_t TEST_3_KEY[] = {
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+    0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+};
+#define TEST_3_KEY_LEN sizeof(TEST_3_KEY)
+static const uint8_t TEST_3_NONCE[] = {
+    0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad,
+    0xde, 0xca, 0xf8, 0x88,
+};
+#define TEST_3_NONCE_LEN sizeof(TEST_3_NONCE)
+#define TEST_3_ADATA NULL
+#define TEST_3_ADATA_LEN 0
+static const uint8_t TEST_3_INPUT[] = {
+    0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5,
+    0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+    0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda,
+    0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+    0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53,
+    0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+    0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57,
+    0xba, 0x63, 0x7b, 0x39, 0x1a, 0xaf, 0xd2, 0x55,
+};
+#define TEST_3_INPUT_LEN sizeof(TEST_3_INPUT)
+static const uint8_t TEST_3_EXPECTED[] = {
+    0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24,
+    0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+    0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0,
+    0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+    0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c,
+    0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+    0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97,
+    0x3d, 0x58, 0xe0, 0x91, 0x47, 0x3f, 0x59, 0x85,
+    0x4d, 0x5c, 0x2a, 0xf3, 0x27, 0xcd, 0x64, 0xa6,
+    0x2c, 0xf3, 0x5a, 0xbd, 0x2b, 0xa6, 0xfa, 0xb4,
+};
+#define TEST_3_EXPECTED_LEN sizeof(TEST_3_EXPECTED)
+
+/* Test Case 4 */
+static const uint8_t TEST_4_KEY[] = {
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+    0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+};
+#define TEST_4_KEY_LEN sizeof(TEST_4_KEY)
+static const uint8_t TEST_4_NONCE[] = {
+    0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad,
+    0xde, 0xca, 0xf8, 0x88,
+};
+#define TEST_4_NONCE_LEN sizeof(TEST_4_NONCE)
+static const uint8_t TEST_4_ADATA[] = {
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xab, 0xad, 0xda, 0xd2,
+};
+#define TEST_4_ADATA_LEN sizeof(TEST_4_ADATA)
+static const uint8_t TEST_4_INPUT[] = {
+    0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5,
+    0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+    0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda,
+    0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+    0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53,
+    0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+    0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57,
+    0xba, 0x63, 0x7b, 0x39,
+};
+#define TEST_4_INPUT_LEN sizeof(TEST_4_INPUT)
+static const uint8_t TEST_4_EXPECTED[] = {
+    0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24,
+    0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+    0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0,
+    0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+    0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c,
+    0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+    0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97,
+    0x3d, 0x58, 0xe0, 0x91, 0x5b, 0xc9, 0x4f, 0xbc,
+    0x32, 0x21, 0xa5, 0xdb, 0x94, 0xfa, 0xe9, 0x5a,
+    0xe7, 0x12, 0x1a, 0x47,
+};
+#define TEST_4_EXPECTED_LEN sizeof(TEST_4_EXPECTED)
+
+/* Test Case 6: 60 byte nonce */
+static const uint8_t TEST_5_KEY[] = {
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+    0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+};
+#define TEST_5_KEY_LEN sizeof(TEST_5_KEY)
+static const uint8_t TEST_5_NONCE[] = {
+    0x93, 0x13, 0x22, 0x5d, 0xf8, 0x84, 0x06, 0xe5,
+    0x55, 0x90, 0x9c, 0x5a, 0xff, 0x52, 0x69, 0xaa,
+    0x6a, 0x7a, 0x95, 0x38, 0x53, 0x4f, 0x7d, 0xa1,
+    0xe4, 0xc3, 0x03, 0xd2, 0xa3, 0x18, 0xa7, 0x28,
+    0xc3, 0xc0, 0xc9, 0x51, 0x56, 0x80, 0x95, 0x39,
+    0xfc, 0xf0, 0xe2, 0x42, 0x9a, 0x6b, 0x52, 0x54,
+    0x16, 0xae, 0xdb, 0xf5, 0xa0, 0xde, 0x6a, 0x57,
+    0xa6, 0x37, 0xb3, 0x9b,
+};
+#define TEST_5_NONCE_LEN sizeof(TEST_5_NONCE)
+static const uint8_t TEST_5_ADATA[] = {
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xab, 0xad, 0xda, 0xd2,
+};
+#define TEST_5_ADATA_LEN sizeof(TEST_5_ADATA)
+static const uint8_t TEST_5_INPUT[] = {
+    0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5,
+    0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+    0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda,
+    0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+    0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53,
+    0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+    0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57,
+    0xba, 0x63, 0x7b, 0x39,
+};
+#define TEST_5_INPUT_LEN sizeof(TEST_5_INPUT)
+static const uint8_t TEST_5_EXPECTED[] = {
+    0x8c, 0xe2, 0x49, 0x98, 0x62, 0x56, 0x15, 0xb6,
+    0x03, 0xa0, 0x33, 0xac, 0xa1, 0x3f, 0xb8, 0x94,
+    0xbe, 0x91, 0x12, 0xa5, 0xc3, 0xa2, 0x11, 0xa8,
+    0xba, 0x26, 0x2a, 0x3c, 0xca, 0x7e, 0x2c, 0xa7,
+    0x01, 0xe4, 0xa9, 0xa4, 0xfb, 0xa4, 0x3c, 0x90,
+    0xcc, 0xdc, 0xb2, 0x81, 0xd4, 0x8c, 0x7c, 0x6f,
+    0xd6, 0x28, 0x75, 0xd2, 0xac, 0xa4, 0x17, 0x03,
+    0x4c, 0x34, 0xae, 0xe5, 0x61, 0x9c, 0xc5, 0xae,
+    0xff, 0xfe, 0x0b, 0xfa, 0x46, 0x2a, 0xf4, 0x3c,
+    0x16, 0x99, 0xd0, 0x50,
+};
+#define TEST_5_EXPECTED_LEN sizeof(TEST_5_EXPECTED)
+
+/* Test Case 4 with an AES-192 key */
+static const uint8_t TEST_6_KEY[] = {
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+    0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+};
+#define TEST_6_KEY_LEN sizeof(TEST_6_KEY)
+static const uint8_t TEST_6_NONCE[] = {
+    0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad,
+    0xde, 0xca, 0xf8, 0x88,
+};
+#define TEST_6_NONCE_LEN sizeof(TEST_6_NONCE)
+static const uint8_t TEST_6_ADATA[] = {
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xab, 0xad, 0xda, 0xd2,
+};
+#define TEST_6_ADATA_LEN sizeof(TEST_6_ADATA)
+static const uint8_t TEST_6_INPUT[] = {
+    0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5,
+    0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+    0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda,
+    0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+    0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53,
+    0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+    0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57,
+    0xba, 0x63, 0x7b, 0x39,
+};
+#define TEST_6_INPUT_LEN sizeof(TEST_6_INPUT)
+static const uint8_t TEST_6_EXPECTED[] = {
+    0x39, 0x80, 0xca, 0x0b, 0x3c, 0x00, 0xe8, 0x41,
+    0xeb, 0x06, 0xfa, 0xc4, 0x87, 0x2a, 0x27, 0x57,
+    0x85, 0x9e, 0x1c, 0xea, 0xa6, 0xef, 0xd9, 0x84,
+    0x62, 0x85, 0x93, 0xb4, 0x0c, 0xa1, 0xe1, 0x9c,
+    0x7d, 0x77, 0x3d, 0x00, 0xc1, 0x44, 0xc5, 0x25,
+    0xac, 0x61, 0x9d, 0x18, 0xc8, 0x4a, 0x3f, 0x47,
+    0x18, 0xe2, 0x44, 0x8b, 0x2f, 0xe3, 0x24, 0xd9,
+    0xcc, 0xda, 0x27, 0x10, 0x25, 0x19, 0x49, 0x8e,
+    0x80, 0xf1, 0x47, 0x8f, 0x37, 0xba, 0x55, 0xbd,
+    0x6d, 0x27, 0x61, 0x8c,
+};
+#define TEST_6_EXPECTED_LEN sizeof(TEST_6_EXPECTED)
+
+/* Test Case 5 (8 byte nonce) with an AES-256 key and a 96 bit tag */
+static const uint8_t TEST_7_KEY[] = {
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+    0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+    0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+};
+#define TEST_7_KEY_LEN sizeof(TEST_7_KEY)
+static const uint8_t TEST_7_NONCE[] = {
+    0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad,
+};
+#define TEST_7_NONCE_LEN sizeof(TEST_7_NONCE)
+static const uint8_t TEST_7_ADATA[] = {
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xab, 0xad, 0xda, 0xd2,
+};
+#define TEST_7_ADATA_LEN sizeof(TEST_7_ADATA)
+static const uint8_t TEST_7_INPUT[] = {
+    0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5,
+    0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+    0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda,
+    0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+    0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53,
+    0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+    0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57,
+    0xba, 0x63, 0x7b, 0x39,
+};
+#define TEST_7_INPUT_LEN sizeof(TEST_7_INPUT)
+static const uint8_t TEST_7_EXPECTED[] = {
+    0xc3, 0x76, 0x2d, 0xf1, 0xca, 0x78, 0x7d, 0x32,
+    0xae, 0x47, 0xc1, 0x3b, 0xf1, 0x98, 0x44, 0xcb,
+    0xaf, 0x1a, 0xe1, 0x4d, 0x0b, 0x97, 0x6a, 0xfa,
+    0xc5, 0x2f, 0xf7, 0xd7, 0x9b, 0xba, 0x9d, 0xe0,
+    0xfe, 0xb5, 0x82, 0xd3, 0x39, 0x34, 0xa4, 0xf0,
+    0x95, 0x4c, 0xc2, 0x36, 0x3b, 0xc7, 0x3f, 0x78,
+    0x62, 0xac, 0x43, 0x0e, 0x64, 0xab, 0xe4, 0x99,
+    0xf4, 0x7c, 0x9b, 0x1f, 0x3a, 0x33, 0x7d, 0xbf,
+    0x46, 0xa7, 0x92, 0xc4, 0x5e, 0x45, 0x49, 0x13,
+};
+#define TEST_7_EXPECTED_LEN sizeof(TEST_7_EXPECTED)
+
+typedef struct {
+    const uint8_t *key;
+    uint8_t key_len;
+    const uint8_t *nonce;
+    size_t nonce_len;
+    const uint8_t *adata;
+    size_t adata_len;
+    const uint8_t *input;
+    size_t input_len;
+    const uint8_t *expected;
+    size_t expected_len;
+} gcm_test_t;
+
+#define TEST(n) { \
+        TEST_ ## n ## _KEY, TEST_ ## n ## _KEY_LEN, \
+        TEST_ ## n ## _NONCE, TEST_ ## n ## _NONCE_LEN, \
+        TEST_ ## n ## _ADATA, TEST_ ## n ## _ADATA_LEN, \
+        TEST_ ## n ## _INPUT, TEST_ ## n ## _INPUT_LEN, \
+        TEST_ ## n ## _EXPECTED, TEST_ ## n ## _EXPECTED_LEN }
+
+static const gcm_test_t _tests[] = {
+    TEST(1),
+    TEST(2),
+    TEST(3),
+    TEST(4),
+    TEST(5),
+    TEST(6),
+    TEST(7),
+};
+
+static void test_crypto_modes_gcm_encrypt(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_tests); i++) {
+        const gcm_test_t *t = &_tests[i];
+        uint8_t tag_len = t->expected_len - t->input_len;
+        uint8_t data[80];
+        cipher_t cipher;
+
+        TEST_ASSERT_EQUAL_INT(1, cipher_init(&cipher, CIPHER_AES, t->key,
+                                             t->key_len));
+        int32_t len = cipher_encrypt_gcm(&cipher, t->adata, t->adata_len,
+                                         tag_len, t->nonce, t->nonce_len,
+                                         t->input, t->input_len, data);
+
+        TEST_ASSERT_EQUAL_INT(t->expected_len, len);
+        TEST_ASSERT_MESSAGE(1 == compare(t->expected, data, len),
+                            "wrong ciphertext");
+    }
+}
+
+static void test_crypto_modes_gcm_decrypt(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_tests); i++) {
+        const gcm_test_t *t = &_tests[i];
+        uint8_t tag_len = t->expected_len - t->input_len;
+        uint8_t data[80], input[80];
+        cipher_t cipher;
+
+        TEST_ASSERT_EQUAL_INT(1, cipher_init(&cipher, CIPHER_AES, t->key,
+                                             t->key_len));
+        int32_t len = cipher_decrypt_gcm(&cipher, t->adata, t->adata_len,
+                                         tag_len, t->nonce, t->nonce_len,
+                                         t->expected, t->expected_len, data);
+
+        TEST_ASSERT_EQUAL_INT(t->input_len, len);
+        TEST_ASSERT_MESSAGE(1 == compare(t->input, data, len),
+                            "wrong plaintext");
+
+        /* any change to the ciphertext or tag must be noticed */
+        memcpy(input, t->expected, t->expected_len);
+        input[t->expected_len - 1] ^= 0x01;
+        len = cipher_decrypt_gcm(&cipher, t->adata, t->adata_len, tag_len,
+                                 t->nonce, t->nonce_len, input,
+                                 t->expected_len, data);
+        TEST_ASSERT_EQUAL_INT(GCM_ERR_INVALID_TAG, len);
+
+        if (t->input_len) {
+            input[t->expected_len - 1] ^= 0x01;
+            input[0] ^= 0x80;
+            len = cipher_decrypt_gcm(&cipher, t->adata, t->adata_len, tag_len,
+                                     t->nonce, t->nonce_len, input,
+                                     t->expected_len, data);
+            TEST_ASSERT_EQUAL_INT(GCM_ERR_INVALID_TAG, len);
+        }
+    }
+}
+
+static void test_crypto_modes_gcm_bad_parameter_values(void)
+{
+    uint8_t key[16] = { 0 }, auth_data[1] = { 0 }, nonce[12] = { 0 };
+    uint8_t input[16] = { 0 }, output[32];
+    cipher_t cipher;
+
+    cipher_init(&cipher, CIPHER_AES, key, 16);
+
+    int32_t rv = cipher_encrypt_gcm(&cipher, auth_data, sizeof(auth_data), 0,
+                                    nonce, sizeof(nonce), input,
+                                    sizeof(input), output);
+    TEST_ASSERT_EQUAL_INT(GCM_ERR_INVALID_TAG_LENGTH, rv);
+
+    rv = cipher_encrypt_gcm(&cipher, auth_data, sizeof(auth_data), 10, nonce,
+                            sizeof(nonce), input, sizeof(input), output);
+    TEST_ASSERT_EQUAL_INT(GCM_ERR_INVALID_TAG_LENGTH, rv);
+
+    rv = cipher_encrypt_gcm(&cipher, auth_data, sizeof(auth_data), 17, nonce,
+                            sizeof(nonce), input, sizeof(input), output);
+    TEST_ASSERT_EQUAL_INT(GCM_ERR_INVALID_TAG_LENGTH, rv);
+
+    rv = cipher_encrypt_gcm(&cipher, auth_data, sizeof(auth_data), 16, nonce,
+                            0, input, sizeof(input), output);
+    TEST_ASSERT_EQUAL_INT(GCM_ERR_INVALID_NONCE_LENGTH, rv);
+
+    rv = cipher_decrypt_gcm(&cipher, auth_data, sizeof(auth_data), 16, nonce,
+                            sizeof(nonce), input, 15, output);
+    TEST_ASSERT_EQUAL_INT(GCM_ERR_INVALID_DATA_LENGTH, rv);
+}
+
+Test *tests_crypto_modes_gcm_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_crypto_modes_gcm_encrypt),
+        new_TestFixture(test_crypto_modes_gcm_decrypt),
+        new_TestFixture(test_crypto_modes_gcm_bad_parameter_values),
+    };
+
+    EMB_UNIT_TESTCALLER(crypto_modes_gcm_tests, NULL, NULL, fixtures);
+
+    return (Test *)&crypto_modes_gcm_tests;
+}
@@ -7,6 +7,7 @@
 #include "embUnit/embUnit.h"
 #include "tests-crypto.h"
 
+#include "container.h"
 #include "crypto/poly1305.h"
 
 #include <string.h>
@@ -278,6 +279,50 @@ static void test_crypto_poly1305_11(void)
     _test_poly1305(key_11, msg_11, sizeof(msg_11), tag_11);
 }
 
+/* Longer than the blocks processed at once, generated with OpenSSL */
+#define LONG_MSG_LEN    (1000U)
+
+static uint8_t msg_long[LONG_MSG_LEN];
+
+static const uint8_t tag_long[] = {
+    0x2b, 0x6c, 0x89, 0xf2, 0xf8, 0x2b, 0x8f, 0x89, 0xbc, 0xff, 0x58, 0x1f,
+    0xdf, 0xca, 0xce, 0x4a,
+};
+
+/* all ones, for the largest intermediate values */
+static const uint8_t tag_long_ff[] = {
+    0xde, 0x94, 0x06, 0xb1, 0x0e, 0x70, 0x23, 0xbc, 0xd6, 0x92, 0xff, 0x68,
+    0x7f, 0x4c, 0xbc, 0x7f,
+};
+
+static void test_crypto_poly1305_long(void)
+{
+    static const size_t chunks[] = { 1, 15, 33, 64, 100, 7, 16, 200, 564 };
+    uint8_t key[32];
+    uint8_t tag[16];
+    poly1305_ctx_t ctx;
+
+    for (unsigned i = 0; i < sizeof(key); i++) {
+        key[i] = 0x80 + i;
+    }
+    for (unsigned i = 0; i < LONG_MSG_LEN; i++) {
+        msg_long[i] = i * 7;
+    }
+    _test_poly1305(key, msg_long, LONG_MSG_LEN, tag_long);
+
+    /* the same split into chunks of odd sizes */
+    poly1305_init(&ctx, key);
+    for (unsigned i = 0, pos = 0; i < ARRAY_SIZE(chunks); pos += chunks[i++]) {
+        poly1305_update(&ctx, &msg_long[pos], chunks[i]);
+    }
+    poly1305_finish(&ctx, tag);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(tag, tag_long, sizeof(tag)));
+
+    memset(key, 0xff, sizeof(key));
+    memset(msg_long, 0xff, LONG_MSG_LEN);
+    _test_poly1305(key, msg_long, LONG_MSG_LEN, tag_long_ff);
+}
+
 Test *tests_crypto_poly1305_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -292,6 +337,7 @@ Test *tests_crypto_poly1305_tests(void)
         new_TestFixture(test_crypto_poly1305_9),
         new_TestFixture(test_crypto_poly1305_10),
         new_TestFixture(test_crypto_poly1305_11),
+        new_TestFixture(test_crypto_poly1305_long),
     };
     EMB_UNIT_TESTCALLER(crypto_poly1305_tests, NULL, NULL, fixtures);
     return (Test *) &crypto_poly1305_tests;
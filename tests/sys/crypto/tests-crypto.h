@@ -57,6 +57,7 @@ Test* tests_crypto_aes_tests(void);
 Test* tests_crypto_cipher_tests(void);
 Test* tests_crypto_modes_ccm_tests(void);
 Test* tests_crypto_modes_ocb_tests(void);
+Test* tests_crypto_modes_gcm_tests(void);
 Test* tests_crypto_modes_ecb_tests(void);
 Test* tests_crypto_modes_cbc_tests(void);
 Test* tests_crypto_modes_ctr_tests(void);
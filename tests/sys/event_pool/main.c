@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the event thread pool
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event/pool.h"
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define WORKERS     (3U)
+#define EVENTS      (8U)
+
+static char _stacks[WORKERS][THREAD_STACKSIZE_DEFAULT];
+static event_pool_worker_t _workers[WORKERS];
+static event_pool_t _pool;
+
+static mutex_t _blocker = MUTEX_INIT_LOCKED;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static unsigned _count[EVENTS];
+static unsigned _pending;
+static event_t _events[EVENTS];
+static event_t *_batch[EVENTS];
+
+static void _handler(event_t *event)
+{
+    _count[event - _events]++;
+    if (--_pending == 0) {
+        mutex_unlock(&_done);
+    }
+}
+
+static void _block(event_t *event)
+{
+    (void)event;
+    /* holds one worker, the others have to steal its events */
+    mutex_lock(&_blocker);
+    mutex_unlock(&_blocker);
+}
+
+static event_t _blocking = { .handler = _block };
+
+static void _expect_counts(unsigned count, unsigned except)
+{
+    for (unsigned i = 0; i < EVENTS; i++) {
+        expect(_count[i] == ((i == except) ? count - 1 : count));
+    }
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < EVENTS; i++) {
+        _events[i].handler = _handler;
+        _batch[i] = &_events[i];
+    }
+    /* below main, so main posts everything before the workers run */
+    event_pool_init(&_pool, _workers, WORKERS, _stacks[0], sizeof(_stacks[0]),
+                    THREAD_PRIORITY_MAIN + 1);
+
+    /* posting twice queues once */
+    _pending = EVENTS;
+    for (unsigned i = 0; i < EVENTS; i++) {
+        event_pool_post(&_pool, &_events[i]);
+        event_pool_post(&_pool, &_events[i]);
+    }
+    mutex_lock(&_done);
+    _expect_counts(1, EVENTS);
+    puts("post: OK");
+
+    _pending = EVENTS;
+    event_pool_post_batch(&_pool, _batch, EVENTS);
+    mutex_lock(&_done);
+    _expect_counts(2, EVENTS);
+    puts("batch: OK");
+
+    /* events behind a blocked worker are stolen by the others */
+    _pending = EVENTS;
+    event_pool_post(&_pool, &_blocking);
+    event_pool_post_batch(&_pool, _batch, EVENTS);
+    mutex_lock(&_done);
+    _expect_counts(3, EVENTS);
+    mutex_unlock(&_blocker);
+    puts("steal: OK");
+
+    /* a cancelled event does not run */
+    _pending = EVENTS - 1;
+    event_pool_post_batch(&_pool, _batch, EVENTS);
+    event_pool_cancel(&_pool, &_events[3]);
+    mutex_lock(&_done);
+    _expect_counts(4, 3);
+    puts("cancel: OK");
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1 @@
+../evtimer_mbox/main.c
\ No newline at end of file
@@ -16,6 +16,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "evtimer_msg.h"
 #include "thread.h"
@@ -88,6 +89,14 @@ int main(void)
     printf("This should list %u items\n", NEVENTS - 2);
     evtimer_print(&evtimer);
 
+    /* Deleting an event that was never added changes nothing, whatever the
+     * event holds */
+    evtimer_msg_event_t unused;
+    memset(&unused, 0xa5, sizeof(unused));
+    evtimer_del(&evtimer, &unused.event);
+    printf("This should still list %u items\n", NEVENTS - 2);
+    evtimer_print(&evtimer);
+
     /* Delete the remaining entries */
     for (unsigned i = 0; i < NEVENTS; i++) {
         evtimer_del(&evtimer, &events[i].event);
@@ -0,0 +1 @@
+../evtimer_msg/main.c
\ No newline at end of file
@@ -0,0 +1 @@
+../evtimer_underflow/main.c
\ No newline at end of file
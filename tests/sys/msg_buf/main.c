@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for buffer messages
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg_buf.h"
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define BUF_SIZE        (32U)
+#define BUF_NUMOF       (4U)
+#define FRAMES          (16U)
+#define MSG_TYPE_FRAME  (0x4242)
+
+static MSG_BUF_POOL_MEM(_mem, BUF_SIZE, BUF_NUMOF);
+static msg_buf_pool_t _pool;
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _msg_queue[2];
+static kernel_pid_t _worker_pid;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static unsigned _sent;
+static unsigned _dropped;
+static unsigned _rcvd;
+static ztimer_t _timer;
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+
+    while (1) {
+        msg_t msg;
+        size_t len;
+
+        msg_receive(&msg);
+        expect(msg.type == MSG_TYPE_FRAME);
+
+        uint8_t *frame = msg_buf_get(&msg, &len);
+
+        expect(len == (frame[0] % BUF_SIZE) + 1);
+        for (unsigned i = 1; i < len; i++) {
+            expect(frame[i] == frame[0]);
+        }
+        msg_buf_free(frame);
+        _rcvd++;
+    }
+    return NULL;
+}
+
+/* stands in for a driver ISR handing received frames to a thread */
+static void _isr(void *arg)
+{
+    (void)arg;
+
+    unsigned n = _sent + _dropped;
+    uint8_t *frame = msg_buf_alloc(&_pool);
+
+    if (frame == NULL) {
+        _dropped++;
+    }
+    else {
+        size_t len = (n % BUF_SIZE) + 1;
+        msg_t msg = { .type = MSG_TYPE_FRAME };
+
+        memset(frame, n, len);
+        if (msg_buf_send(&msg, _worker_pid, frame, len) == 1) {
+            _sent++;
+        }
+        else {
+            /* the queue of the worker is full, the buffer is back */
+            _dropped++;
+        }
+    }
+    if (_sent + _dropped < FRAMES) {
+        ztimer_set(ZTIMER_USEC, &_timer, 100);
+    }
+    else {
+        mutex_unlock(&_done);
+    }
+}
+
+int main(void)
+{
+    msg_buf_pool_init(&_pool, _mem, BUF_SIZE, BUF_NUMOF);
+    expect(msg_buf_available(&_pool) == BUF_NUMOF);
+
+    /* allocation */
+    void *bufs[BUF_NUMOF];
+
+    for (unsigned i = 0; i < BUF_NUMOF; i++) {
+        bufs[i] = msg_buf_alloc(&_pool);
+        expect(bufs[i] != NULL);
+        expect(msg_buf_size(bufs[i]) >= BUF_SIZE);
+    }
+    expect(msg_buf_alloc(&_pool) == NULL);
+    for (unsigned i = 0; i < BUF_NUMOF; i++) {
+        msg_buf_free(bufs[i]);
+    }
+    expect(msg_buf_available(&_pool) == BUF_NUMOF);
+    puts("alloc: OK");
+
+    /* undeliverable: nobody waits for main and it has no queue */
+    msg_t msg = { .type = MSG_TYPE_FRAME };
+
+    expect(msg_buf_try_send(&msg, thread_getpid(),
+                            msg_buf_alloc(&_pool), 1) == 0);
+    expect(msg_buf_available(&_pool) == BUF_NUMOF);
+    puts("drop: OK");
+
+    /* from ISR to a thread */
+    _worker_pid = thread_create(_stack, sizeof(_stack),
+                                THREAD_PRIORITY_MAIN - 1, 0, _worker, NULL,
+                                "worker");
+    _timer.callback = _isr;
+    ztimer_set(ZTIMER_USEC, &_timer, 100);
+    mutex_lock(&_done);
+    printf("isr: sent %u, received %u\n", _sent, _rcvd);
+    expect(_rcvd == _sent);
+    expect(_sent + _dropped == FRAMES);
+    expect(msg_buf_available(&_pool) == BUF_NUMOF);
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       sched_trace module test application
+ *
+ * Records message passing, a contended mutex and a thread woken up from a
+ * timer interrupt and dumps the trace.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "sched_trace.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#define ROUNDS          (4U)
+#define FLAG_TIMER      (0x1)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _msg_queue[4];
+static mutex_t _mutex = MUTEX_INIT;
+
+static void _timer_cb(void *arg)
+{
+    thread_flags_set(arg, FLAG_TIMER);
+}
+
+static void *_thread(void *arg)
+{
+    kernel_pid_t main_pid = (kernel_pid_t)(uintptr_t)arg;
+
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        /* main holds the mutex until the timer fired */
+        mutex_lock(&_mutex);
+        mutex_unlock(&_mutex);
+        msg_send(&msg, main_pid);
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0, _thread,
+                                     (void *)(uintptr_t)thread_getpid(),
+                                     "worker");
+
+    sched_trace_user(0);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        msg_t msg = { .type = i };
+        ztimer_t timer = { .callback = _timer_cb, .arg = thread_get_active() };
+
+        mutex_lock(&_mutex);
+        /* the worker preempts main and waits for the mutex */
+        msg_send(&msg, pid);
+        ztimer_set(ZTIMER_USEC, &timer, 100);
+        thread_flags_wait_any(FLAG_TIMER);
+        mutex_unlock(&_mutex);
+        msg_receive(&msg);
+    }
+    sched_trace_user(1);
+
+    sched_trace_dump();
+    puts("done.");
+
+    return 0;
+}
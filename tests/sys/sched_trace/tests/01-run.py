@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT Developers
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+# delta, event, PID, argument
+ENTRY = r" [0-9a-f]{4}[0-9a-f]{2}[0-9a-f]{2}[0-9a-f]{8}"
+
+
+def testfunc(child):
+    child.expect(r"sched_trace: begin (\d+) 0 \d+ us\r\n")
+    numof = int(child.match.group(1))
+    assert numof > 0
+    child.expect_exact("sched_trace: thread 2 main\r\n")
+    child.expect_exact("sched_trace: thread 3 worker\r\n")
+    for _ in range((numof + 7) // 8):
+        child.expect(r"sched_trace:(" + ENTRY + r"){1,8}\r\n")
+    child.expect_exact("sched_trace: end\r\n")
+    child.expect_exact("done.")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "container.h"
+#include "prio_waitq.h"
+#include "thread.h"
+
+#include "tests-core.h"
+
+#if IS_USED(MODULE_CORE_PRIO_WAITQ)
+
+#define TEST_THREADS    (12)
+
+/* [0] is indexed, [1] is the reference kept by thread_add_to_list() */
+static thread_t _threads[2][TEST_THREADS];
+static list_node_t _lists[2];
+static prio_waitq_t _q;
+static uint32_t _rand_state;
+
+static void set_up(void)
+{
+    memset(_threads, 0, sizeof(_threads));
+    memset(_lists, 0, sizeof(_lists));
+    memset(&_q, 0, sizeof(_q));
+    _rand_state = 1;
+}
+
+static uint32_t _rand(void)
+{
+    /* xorshift32, good enough to shuffle operations */
+    _rand_state ^= _rand_state << 13;
+    _rand_state ^= _rand_state >> 17;
+    _rand_state ^= _rand_state << 5;
+    return _rand_state;
+}
+
+static unsigned _idx(unsigned set, list_node_t *node)
+{
+    thread_t *thread = container_of((clist_node_t *)node, thread_t, rq_entry);
+
+    return thread - _threads[set];
+}
+
+static void _add(unsigned i, uint8_t prio)
+{
+    _threads[0][i].priority = prio;
+    _threads[1][i].priority = prio;
+    prio_waitq_add(&_q, &_lists[0], &_threads[0][i]);
+    thread_add_to_list(&_lists[1], &_threads[1][i]);
+}
+
+static void _assert_same(void)
+{
+    list_node_t *a = _lists[0].next;
+    list_node_t *b = _lists[1].next;
+
+    while (a && b) {
+        TEST_ASSERT_EQUAL_INT(_idx(1, b), _idx(0, a));
+        a = a->next;
+        b = b->next;
+    }
+    TEST_ASSERT_NULL(a);
+    TEST_ASSERT_NULL(b);
+    if (!_lists[0].next) {
+        TEST_ASSERT_EQUAL_INT(0, _q.bitmap);
+    }
+}
+
+static void test_prio_waitq_add__order(void)
+{
+    static const uint8_t prios[] = { 5, 3, 5, 7, 3, 0, 7, 5 };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(prios); i++) {
+        _add(i, prios[i]);
+        _assert_same();
+    }
+    TEST_ASSERT_EQUAL_INT((1 << 0) | (1 << 3) | (1 << 5) | (1 << 7), _q.bitmap);
+}
+
+static void test_prio_waitq_remove_head(void)
+{
+    test_prio_waitq_add__order();
+    while (_lists[1].next) {
+        list_node_t *a = prio_waitq_remove_head(&_q, &_lists[0]);
+        list_node_t *b = list_remove_head(&_lists[1]);
+
+        TEST_ASSERT_EQUAL_INT(_idx(1, b), _idx(0, a));
+        _assert_same();
+    }
+    TEST_ASSERT_NULL(prio_waitq_remove_head(&_q, &_lists[0]));
+}
+
+static void test_prio_waitq_remove(void)
+{
+    /* last of 5, first of 3, the only 0, middle of 5, ... */
+    static const unsigned order[] = { 7, 1, 5, 2, 0, 3, 6, 4 };
+
+    test_prio_waitq_add__order();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(order); i++) {
+        TEST_ASSERT(prio_waitq_remove(&_q, &_lists[0], &_threads[0][order[i]]));
+        TEST_ASSERT_NOT_NULL(list_remove(&_lists[1],
+                                         (list_node_t *)&_threads[1][order[i]].rq_entry));
+        _assert_same();
+        /* removed already */
+        TEST_ASSERT(!prio_waitq_remove(&_q, &_lists[0], &_threads[0][order[i]]));
+    }
+}
+
+static void test_prio_waitq__random(void)
+{
+    bool queued[TEST_THREADS] = { false };
+
+    for (unsigned round = 0; round < 1000; round++) {
+        unsigned i = _rand() % TEST_THREADS;
+
+        if (!queued[i]) {
+            _add(i, _rand() % 4);
+            queued[i] = true;
+        }
+        else if (_rand() % 2) {
+            list_node_t *a = prio_waitq_remove_head(&_q, &_lists[0]);
+
+            list_remove_head(&_lists[1]);
+            queued[_idx(0, a)] = false;
+        }
+        else {
+            TEST_ASSERT(prio_waitq_remove(&_q, &_lists[0], &_threads[0][i]));
+            list_remove(&_lists[1], (list_node_t *)&_threads[1][i].rq_entry);
+            queued[i] = false;
+        }
+        _assert_same();
+    }
+}
+
+Test *tests_core_prio_waitq_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_prio_waitq_add__order),
+        new_TestFixture(test_prio_waitq_remove_head),
+        new_TestFixture(test_prio_waitq_remove),
+        new_TestFixture(test_prio_waitq__random),
+    };
+
+    EMB_UNIT_TESTCALLER(core_prio_waitq_tests, set_up, NULL, fixtures);
+
+    return (Test *)&core_prio_waitq_tests;
+}
+
+#endif /* IS_USED(MODULE_CORE_PRIO_WAITQ) */
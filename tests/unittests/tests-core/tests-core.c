@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: LGPL-2.1-only
  */
 
+#include "modules.h"
+
 #include "tests-core.h"
 
 void tests_core(void)
@@ -13,6 +15,9 @@ void tests_core(void)
     TESTS_RUN(tests_core_clist_tests());
     TESTS_RUN(tests_core_list_tests());
     TESTS_RUN(tests_core_mbox_tests());
+#if IS_USED(MODULE_CORE_PRIO_WAITQ)
+    TESTS_RUN(tests_core_prio_waitq_tests());
+#endif
     TESTS_RUN(tests_core_priority_queue_tests());
     TESTS_RUN(tests_core_byteorder_tests());
     TESTS_RUN(tests_core_ringbuffer_tests());
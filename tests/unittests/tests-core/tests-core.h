@@ -68,6 +68,13 @@ Test *tests_core_list_tests(void);
  */
 Test *tests_core_mbox_tests(void);
 
+/**
+ * @brief   Generates tests for prio_waitq.h
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_core_prio_waitq_tests(void);
+
 /**
  * @brief   Generates tests for priority_queue.h
  *
@@ -26,11 +26,9 @@
 
 static void set_up(void)
 {
-    evtimer_event_t *tmp;
+    evtimer_event_t *ptr;
 
-    for (evtimer_event_t *ptr = _nib_evtimer.events;
-         (ptr != NULL) && (tmp = (ptr->next), 1);
-         ptr = tmp) {
+    while ((ptr = evtimer_first_event(&_nib_evtimer))) {
         evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
     }
     _nib_init();
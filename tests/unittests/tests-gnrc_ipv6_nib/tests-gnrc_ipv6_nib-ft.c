@@ -31,11 +31,9 @@
 
 static void set_up(void)
 {
-    evtimer_event_t *tmp;
+    evtimer_event_t *ptr;
 
-    for (evtimer_event_t *ptr = _nib_evtimer.events;
-         (ptr != NULL) && (tmp = (ptr->next), 1);
-         ptr = tmp) {
+    while ((ptr = evtimer_first_event(&_nib_evtimer))) {
         evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
     }
     _nib_init();
@@ -175,6 +173,80 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+/*
+ * Creates forwarding table sizes from 1 to CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF
+ * routes with nested prefixes (and a sibling for every prefix) to a
+ * destination, then removes the routes from the longest to the shortest
+ * prefix.
+ * Expected result: gnrc_ipv6_nib_ft_get() always returns the route with the
+ * longest prefix left that matches the destination
+ */
+static void test_nib_ft_get__success_longest_prefix_scale(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                      { .u64 = TEST_UINT64 } } };
+    const unsigned max_routes = CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF / 2;
+
+    for (unsigned routes = 1; routes <= max_routes; routes++) {
+        set_up();
+        for (unsigned i = 0; i < routes; i++) {
+            ipv6_addr_t pfx = dst;
+            unsigned pfx_len = 16 + ((i * 96) / max_routes);
+
+            /* sibling differing in the last bit of the prefix */
+            pfx.u8[(pfx_len - 1) / 8] ^= 0x80 >> ((pfx_len - 1) % 8);
+            next_hop.u16[1] = byteorder_htons(UINT16_MAX);
+            TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&pfx, pfx_len,
+                                                          &next_hop, IFACE, 0));
+            next_hop.u16[1] = byteorder_htons(i);
+            TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, pfx_len,
+                                                          &next_hop, IFACE, 0));
+        }
+        for (unsigned i = routes; i > 0; i--) {
+            unsigned pfx_len = 16 + (((i - 1) * 96) / max_routes);
+
+            TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+            TEST_ASSERT_EQUAL_INT(pfx_len, fte.dst_len);
+            TEST_ASSERT_EQUAL_INT(i - 1, byteorder_ntohs(fte.next_hop.u16[1]));
+            gnrc_ipv6_nib_ft_del(&dst, pfx_len);
+        }
+        TEST_ASSERT_EQUAL_INT(-ENETUNREACH, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    }
+}
+
+/*
+ * Adds two routes with the same prefix but different next hops and removes
+ * the first one.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the first route, after its
+ * removal the second one
+ */
+static void test_nib_ft_get__success_same_prefix(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                      { .u64 = TEST_UINT64 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop, IFACE, 0));
+    next_hop.u16[0].u16++;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop, IFACE, 0));
+    next_hop.u16[0].u16--;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop, &fte.next_hop));
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN);
+    next_hop.u16[0].u16++;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop, &fte.next_hop));
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN);
+    TEST_ASSERT_EQUAL_INT(-ENETUNREACH, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -724,6 +796,8 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__success_longest_prefix_scale),
+        new_TestFixture(test_nib_ft_get__success_same_prefix),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
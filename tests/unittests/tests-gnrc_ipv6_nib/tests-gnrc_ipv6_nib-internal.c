@@ -346,6 +346,48 @@ static void test_nib_get__success(void)
     TEST_ASSERT(nib_alloced == nib_got);
 }
 
+/*
+ * Fills the NIB with entries, clears every other entry and re-adds them with
+ * new addresses.
+ * Expected result: _nib_onl_get() finds exactly the entries that are in the
+ * NIB
+ */
+static void test_nib_get__success_full_nib_churn(void)
+{
+    _nib_onl_entry_t *nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        addr.u16[7].u16 = i;
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_alloc(&addr, IFACE)));
+        nodes[i]->mode = _NC;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        nodes[i]->mode = _EMPTY;
+        TEST_ASSERT(_nib_onl_clear(nodes[i]));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        addr.u16[7].u16 = i;
+        if (i & 1) {
+            TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, IFACE));
+            TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, 0));
+        }
+        else {
+            TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
+        }
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        addr.u16[7].u16 = i + CONFIG_GNRC_IPV6_NIB_NUMOF;
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_alloc(&addr, IFACE)));
+        nodes[i]->mode = _NC;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        addr.u16[7].u16 = (i & 1) ? i : (i + CONFIG_GNRC_IPV6_NIB_NUMOF);
+        TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, IFACE));
+    }
+}
+
 /*
  * Tries to get a NIB entry that is not in the NIB.
  * Expected result: _nib_onl_get() returns NULL
@@ -2070,6 +2112,7 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_iter__three_elem_middle_removed),
         new_TestFixture(test_nib_get__empty),
         new_TestFixture(test_nib_get__not_in_nib),
+        new_TestFixture(test_nib_get__success_full_nib_churn),
         new_TestFixture(test_nib_get__success),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_iface),
@@ -0,0 +1,195 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include "embUnit.h"
+
+#include "msg.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netapi/batch.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "thread.h"
+
+#include "tests-gnrc_netapi_batch.h"
+
+#define CTX_A           (1U)
+#define CTX_B           (2U)
+#define MSG_QUEUE_SIZE  (2 * CONFIG_GNRC_NETAPI_BATCH_SIZE)
+
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static gnrc_netreg_entry_t _plain, _batch;
+static gnrc_netapi_batch_t _b;
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    gnrc_netreg_init();
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    gnrc_netreg_entry_init_pid(&_plain, CTX_A, thread_getpid());
+    gnrc_netreg_entry_init_pid(&_batch, CTX_A, thread_getpid());
+    _batch.batch = true;
+    gnrc_netapi_batch_init(&_b);
+}
+
+static void tear_down(void)
+{
+    /* not all tests register both entries */
+    gnrc_netreg_init();
+    TEST_ASSERT_EQUAL_INT(0, msg_avail());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void _add(gnrc_pktsnip_t **pkts, unsigned numof, uint32_t ctx)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        pkts[i] = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkts[i]);
+        gnrc_netapi_batch_receive(&_b, GNRC_NETTYPE_TEST, ctx, pkts[i]);
+    }
+}
+
+static void _expect_rcv(gnrc_pktsnip_t *pkt)
+{
+    msg_t msg;
+
+    TEST_ASSERT_EQUAL_INT(1, msg_try_receive(&msg));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETAPI_MSG_TYPE_RCV, msg.type);
+    TEST_ASSERT(msg.content.ptr == pkt);
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _expect_rcv_batch(gnrc_pktsnip_t **pkts, unsigned numof)
+{
+    msg_t msg;
+
+    TEST_ASSERT_EQUAL_INT(1, msg_try_receive(&msg));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETAPI_MSG_TYPE_RCV_BATCH, msg.type);
+    TEST_ASSERT_EQUAL_INT(numof, gnrc_netapi_batch_numof(msg.content.ptr));
+    for (unsigned i = 0; i < numof; i++) {
+        TEST_ASSERT(gnrc_netapi_batch_get(msg.content.ptr, i) == pkts[i]);
+        gnrc_pktbuf_release(pkts[i]);
+    }
+    gnrc_pktbuf_release(msg.content.ptr);
+}
+
+static void test_batch_flush__empty(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netapi_batch_flush(&_b));
+}
+
+static void test_batch_flush__no_subscribers(void)
+{
+    gnrc_pktsnip_t *pkts[3];
+
+    _add(pkts, 3, CTX_A);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netapi_batch_flush(&_b));
+    TEST_ASSERT_EQUAL_INT(0, _b.numof);
+}
+
+static void test_batch_flush__plain(void)
+{
+    gnrc_pktsnip_t *pkts[3];
+
+    gnrc_netreg_register(GNRC_NETTYPE_TEST, &_plain);
+    _add(pkts, 3, CTX_A);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_batch_flush(&_b));
+    for (unsigned i = 0; i < 3; i++) {
+        _expect_rcv(pkts[i]);
+    }
+}
+
+static void test_batch_flush__batch(void)
+{
+    gnrc_pktsnip_t *pkts[3];
+
+    gnrc_netreg_register(GNRC_NETTYPE_TEST, &_batch);
+    _add(pkts, 3, CTX_A);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_batch_flush(&_b));
+    _expect_rcv_batch(pkts, 3);
+}
+
+static void test_batch_flush__single(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    /* a single packet is dispatched without a batch snip */
+    gnrc_netreg_register(GNRC_NETTYPE_TEST, &_batch);
+    _add(&pkt, 1, CTX_A);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_batch_flush(&_b));
+    _expect_rcv(pkt);
+}
+
+static void test_batch_flush__mixed(void)
+{
+    gnrc_pktsnip_t *pkts[3];
+
+    gnrc_netreg_register(GNRC_NETTYPE_TEST, &_plain);
+    gnrc_netreg_register(GNRC_NETTYPE_TEST, &_batch);
+    _add(pkts, 3, CTX_A);
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netapi_batch_flush(&_b));
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(2, pkts[i]->users);
+    }
+    /* registered last, so looked up first */
+    _expect_rcv_batch(pkts, 3);
+    for (unsigned i = 0; i < 3; i++) {
+        _expect_rcv(pkts[i]);
+    }
+}
+
+static void test_batch_receive__other_ctx(void)
+{
+    gnrc_pktsnip_t *pkts[3];
+    gnrc_pktsnip_t *other;
+
+    gnrc_netreg_register(GNRC_NETTYPE_TEST, &_batch);
+    _add(pkts, 3, CTX_A);
+    /* a packet for other subscribers flushes the batch */
+    _add(&other, 1, CTX_B);
+    TEST_ASSERT_EQUAL_INT(1, _b.numof);
+    _expect_rcv_batch(pkts, 3);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netapi_batch_flush(&_b));
+}
+
+static void test_batch_receive__full(void)
+{
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_NETAPI_BATCH_SIZE];
+
+    gnrc_netreg_register(GNRC_NETTYPE_TEST, &_batch);
+    _add(pkts, CONFIG_GNRC_NETAPI_BATCH_SIZE, CTX_A);
+    TEST_ASSERT_EQUAL_INT(0, _b.numof);
+    _expect_rcv_batch(pkts, CONFIG_GNRC_NETAPI_BATCH_SIZE);
+}
+
+static Test *tests_gnrc_netapi_batch_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_batch_flush__empty),
+        new_TestFixture(test_batch_flush__no_subscribers),
+        new_TestFixture(test_batch_flush__plain),
+        new_TestFixture(test_batch_flush__batch),
+        new_TestFixture(test_batch_flush__single),
+        new_TestFixture(test_batch_flush__mixed),
+        new_TestFixture(test_batch_receive__other_ctx),
+        new_TestFixture(test_batch_receive__full),
+    };
+
+    EMB_UNIT_TESTCALLER(batch_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&batch_tests;
+}
+
+void tests_gnrc_netapi_batch(void)
+{
+    TESTS_RUN(tests_gnrc_netapi_batch_tests());
+}
+
+/** @} */
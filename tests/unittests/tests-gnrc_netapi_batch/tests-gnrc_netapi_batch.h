@@ -0,0 +1,29 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup unittests
+ * @{
+ *
+ * @file
+ * @brief   unittests for the `gnrc_netapi_batch` module
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The entry point of this test suite.
+ */
+void tests_gnrc_netapi_batch(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
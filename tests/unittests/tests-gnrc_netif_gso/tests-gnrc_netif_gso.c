@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/netif/gso.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/tcp.h"
+
+#include "tests-gnrc_netif_gso.h"
+
+#define SEQ_NUM     (0xfffffc00UL)  /* wraps around within the test data */
+#define CTL_ACK_PSH (0x0018)
+#define CTL_PSH     (0x0008)
+#define GSO_SIZE    (100U)
+#define SEGS_MAX    (4U)
+
+static gnrc_netif_t _netif;
+static gnrc_pktsnip_t *_segs[SEGS_MAX];
+static unsigned _segs_numof;
+static uint8_t _data[(SEGS_MAX * GSO_SIZE) - 1];
+
+static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    TEST_ASSERT(netif == &_netif);
+    TEST_ASSERT(_segs_numof < SEGS_MAX);
+    _segs[_segs_numof++] = pkt;
+}
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    memset(&_netif, 0, sizeof(_netif));
+    _segs_numof = 0;
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = i;
+    }
+}
+
+static void tear_down(void)
+{
+    for (unsigned i = 0; i < _segs_numof; i++) {
+        gnrc_pktbuf_release(_segs[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static gnrc_pktsnip_t *_build(gnrc_nettype_t l4_type, size_t pay_len)
+{
+    gnrc_pktsnip_t *pkt;
+    tcp_hdr_t tcp_hdr = {
+        .seq_num = byteorder_htonl(SEQ_NUM),
+        .off_ctl = byteorder_htons((TCP_HDR_OFFSET_MIN << 12) | CTL_ACK_PSH),
+    };
+    ipv6_hdr_t ipv6_hdr = { .nh = PROTNUM_TCP, .hl = 64 };
+
+    ipv6_hdr_set_version(&ipv6_hdr);
+    ipv6_hdr.src.u8[15] = 1;
+    ipv6_hdr.dst.u8[15] = 2;
+    /* the packet buffer is large enough for the test data */
+    pkt = gnrc_pktbuf_add(NULL, _data, pay_len, GNRC_NETTYPE_UNDEF);
+    pkt = gnrc_pktbuf_add(pkt, &tcp_hdr, sizeof(tcp_hdr), l4_type);
+    ipv6_hdr.len = byteorder_htons(gnrc_pkt_len(pkt));
+    pkt = gnrc_pktbuf_add(pkt, &ipv6_hdr, sizeof(ipv6_hdr), GNRC_NETTYPE_IPV6);
+    gnrc_pktsnip_t *netif_hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+
+    gnrc_netif_hdr_set_gso(netif_hdr->data, GSO_SIZE);
+    return gnrc_pkt_prepend(pkt, netif_hdr);
+}
+
+static void test_gso_segment__not_tcp(void)
+{
+    gnrc_pktsnip_t *pkt = _build(GNRC_NETTYPE_UNDEF, sizeof(_data));
+
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, gnrc_netif_gso_segment(&_netif, pkt, _send));
+    TEST_ASSERT_EQUAL_INT(0, _segs_numof);
+}
+
+static void test_gso_segment__single(void)
+{
+    gnrc_pktsnip_t *pkt = _build(GNRC_NETTYPE_TCP, GSO_SIZE);
+
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_gso_segment(&_netif, pkt, _send));
+    TEST_ASSERT_EQUAL_INT(1, _segs_numof);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_hdr_get_gso(_segs[0]->data));
+    TEST_ASSERT_EQUAL_INT(sizeof(ipv6_hdr_t) + sizeof(tcp_hdr_t) + GSO_SIZE,
+                          gnrc_pkt_len(_segs[0]->next));
+}
+
+static void test_gso_segment__multiple(void)
+{
+    gnrc_pktsnip_t *pkt = _build(GNRC_NETTYPE_TCP, sizeof(_data));
+
+    TEST_ASSERT_EQUAL_INT(SEGS_MAX, gnrc_netif_gso_segment(&_netif, pkt, _send));
+    TEST_ASSERT_EQUAL_INT(SEGS_MAX, _segs_numof);
+    for (unsigned i = 0; i < SEGS_MAX; i++) {
+        gnrc_pktsnip_t *ipv6 = _segs[i]->next;
+        gnrc_pktsnip_t *tcp = ipv6->next;
+        gnrc_pktsnip_t *pay = tcp->next;
+        ipv6_hdr_t *ipv6_hdr = ipv6->data;
+        tcp_hdr_t *tcp_hdr = tcp->data;
+        size_t pay_len = (i < (SEGS_MAX - 1)) ? GSO_SIZE : (GSO_SIZE - 1);
+
+        TEST_ASSERT(_segs[i]->type == GNRC_NETTYPE_NETIF);
+        TEST_ASSERT(ipv6->type == GNRC_NETTYPE_IPV6);
+        TEST_ASSERT(tcp->type == GNRC_NETTYPE_TCP);
+        TEST_ASSERT_NOT_NULL(pay);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_hdr_get_gso(_segs[i]->data));
+        TEST_ASSERT_EQUAL_INT(pay_len, pay->size);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(pay->data, &_data[i * GSO_SIZE], pay_len));
+        TEST_ASSERT_EQUAL_INT(sizeof(tcp_hdr_t) + pay_len,
+                              byteorder_ntohs(ipv6_hdr->len));
+        TEST_ASSERT_EQUAL_INT((uint32_t)(SEQ_NUM + (i * GSO_SIZE)),
+                              byteorder_ntohl(tcp_hdr->seq_num));
+        /* PSH only on the last segment */
+        TEST_ASSERT_EQUAL_INT((i < (SEGS_MAX - 1)) ? 0 : CTL_PSH,
+                              byteorder_ntohs(tcp_hdr->off_ctl) & CTL_PSH);
+    }
+}
+
+static void test_gso_segment__csum_offload(void)
+{
+    gnrc_pktsnip_t *pkt = _build(GNRC_NETTYPE_TCP, sizeof(_data));
+
+    _netif.flags |= GNRC_NETIF_FLAGS_L4_CSUM_OFFLOAD;
+    TEST_ASSERT_EQUAL_INT(SEGS_MAX, gnrc_netif_gso_segment(&_netif, pkt, _send));
+    for (unsigned i = 0; i < SEGS_MAX; i++) {
+        gnrc_netif_hdr_t *netif_hdr = _segs[i]->data;
+        gnrc_pktsnip_t *tcp = _segs[i]->next->next;
+        tcp_hdr_t *tcp_hdr = tcp->data;
+
+        TEST_ASSERT(netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_CSUM_OFFLOAD);
+        /* the checksum field holds the uncomplemented pseudo-header sum */
+        TEST_ASSERT_EQUAL_INT(ipv6_hdr_inet_csum(0, _segs[i]->next->data,
+                                                 PROTNUM_TCP, gnrc_pkt_len(tcp)),
+                              byteorder_ntohs(tcp_hdr->checksum));
+    }
+}
+
+static Test *tests_gnrc_netif_gso_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gso_segment__not_tcp),
+        new_TestFixture(test_gso_segment__single),
+        new_TestFixture(test_gso_segment__multiple),
+        new_TestFixture(test_gso_segment__csum_offload),
+    };
+
+    EMB_UNIT_TESTCALLER(gso_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&gso_tests;
+}
+
+void tests_gnrc_netif_gso(void)
+{
+    TESTS_RUN(tests_gnrc_netif_gso_tests());
+}
+
+/** @} */
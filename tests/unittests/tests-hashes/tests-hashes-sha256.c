@@ -25,6 +25,7 @@
 #include <stdlib.h>
 
 #include "embUnit/embUnit.h"
+#include "kernel_defines.h"
 
 #include "hashes/sha256.h"
 
@@ -264,6 +265,46 @@ static void test_hashes_sha256_hash_sequence_abc_long(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, h_fips_multiblock));
 }
 
+/**
+ * @brief expected hash of the 1000 bytes `(i * 7 + 3) & 0xff`, generated with
+ *        python hashlib
+ */
+static const unsigned char h_chunked[] = {
+    0x1e, 0x9b, 0xc3, 0x8c, 0xbf, 0x86, 0x0b, 0x9e,
+    0xc3, 0x19, 0x18, 0xb0, 0x65, 0xf9, 0xb5, 0x24,
+    0x76, 0xc5, 0x49, 0xa7, 0x82, 0xe0, 0xe7, 0x99,
+    0x0b, 0xed, 0x8c, 0xe3, 0x86, 0x8d, 0x23, 0x71,
+};
+
+static void test_hashes_sha256_hash_chunked(void)
+{
+    /* one more byte to check unaligned input */
+    static uint8_t data[1001];
+    static const size_t chunks[] = { 1, 63, 64, 65, 127, 128, 129, 423 };
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    sha256_context_t ctx;
+
+    for (unsigned i = 0; i < 1000; i++) {
+        data[i + 1] = (i * 7 + 3) & 0xff;
+    }
+
+    /* all blocks at once */
+    sha256(&data[1], 1000, hash);
+    TEST_ASSERT(memcmp(h_chunked, hash, sizeof(hash)) == 0);
+
+    /* in chunks that fill up the block buffer in different ways */
+    sha256_init(&ctx);
+    for (size_t pos = 0, i = 0; pos < 1000; i++) {
+        size_t len = chunks[i % ARRAY_SIZE(chunks)];
+
+        len = (len > 1000 - pos) ? 1000 - pos : len;
+        sha256_update(&ctx, &data[1 + pos], len);
+        pos += len;
+    }
+    sha256_final(&ctx, hash);
+    TEST_ASSERT(memcmp(h_chunked, hash, sizeof(hash)) == 0);
+}
+
 Test *tests_hashes_sha256_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -282,6 +323,7 @@ Test *tests_hashes_sha256_tests(void)
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
+        new_TestFixture(test_hashes_sha256_hash_chunked),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha256_tests, NULL, NULL,
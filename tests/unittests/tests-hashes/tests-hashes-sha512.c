@@ -21,6 +21,7 @@
 #include <stdlib.h>
 
 #include "embUnit/embUnit.h"
+#include "kernel_defines.h"
 
 #include "hashes/sha512.h"
 
@@ -371,6 +372,50 @@ static void test_hashes_sha512_hash_clear_ctx(void)
     }
 }
 
+/**
+ * @brief expected hash of the 1000 bytes `(i * 7 + 3) & 0xff`, generated with
+ *        python hashlib
+ */
+static const unsigned char h_chunked[] = {
+    0x00, 0xe3, 0x6f, 0xcc, 0xf1, 0x93, 0xe5, 0x96,
+    0x97, 0xa9, 0x2b, 0x5a, 0xb2, 0x46, 0x66, 0xce,
+    0x63, 0x26, 0xd7, 0xfa, 0x16, 0xbf, 0x10, 0x83,
+    0x2d, 0x09, 0x91, 0xdd, 0xc5, 0x91, 0x11, 0x2e,
+    0x9d, 0xfa, 0x6a, 0x63, 0x69, 0x50, 0xed, 0x9c,
+    0x4d, 0x67, 0x34, 0x4a, 0x76, 0x06, 0x54, 0xc2,
+    0xff, 0x77, 0x85, 0xe1, 0xd6, 0x00, 0x94, 0xd6,
+    0x51, 0x03, 0x87, 0x35, 0xb5, 0xdc, 0xca, 0xbd,
+};
+
+static void test_hashes_sha512_hash_chunked(void)
+{
+    /* one more byte to check unaligned input */
+    static uint8_t data[1001];
+    static const size_t chunks[] = { 1, 63, 64, 65, 127, 128, 129, 423 };
+    uint8_t hash[SHA512_DIGEST_LENGTH];
+    sha512_context_t ctx;
+
+    for (unsigned i = 0; i < 1000; i++) {
+        data[i + 1] = (i * 7 + 3) & 0xff;
+    }
+
+    /* all blocks at once */
+    sha512(&data[1], 1000, hash);
+    TEST_ASSERT(memcmp(h_chunked, hash, sizeof(hash)) == 0);
+
+    /* in chunks that fill up the block buffer in different ways */
+    sha512_init(&ctx);
+    for (size_t pos = 0, i = 0; pos < 1000; i++) {
+        size_t len = chunks[i % ARRAY_SIZE(chunks)];
+
+        len = (len > 1000 - pos) ? 1000 - pos : len;
+        sha512_update(&ctx, &data[1 + pos], len);
+        pos += len;
+    }
+    sha512_final(&ctx, hash);
+    TEST_ASSERT(memcmp(h_chunked, hash, sizeof(hash)) == 0);
+}
+
 Test *tests_hashes_sha512_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -389,6 +434,7 @@ Test *tests_hashes_sha512_tests(void)
 
         new_TestFixture(test_hashes_sha512_hash_sequence_abc),
         new_TestFixture(test_hashes_sha512_hash_sequence_abc_long),
+        new_TestFixture(test_hashes_sha512_hash_chunked),
 
         new_TestFixture(test_hashes_sha512_hash_sequence_binary),
         new_TestFixture(test_hashes_sha512_hash_update_twice),
@@ -10,6 +10,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -162,6 +163,46 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    /* straightforward byte-wise reference implementation */
+    uint32_t csum = sum;
+
+    for (uint16_t i = 0; i < len; i++) {
+        csum += ((accum_len + i) & 1) ? buf[i] : (uint16_t)(buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void test_inet_csum__unaligned_slices(void)
+{
+    static uint8_t data[300];
+    uint32_t seed = 0x12345678;
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        seed = (seed * 1103515245) + 12345;
+        data[i] = seed >> 16;
+    }
+    /* cover all head and tail alignments of the word-wise implementation */
+    for (unsigned offset = 0; offset < 16; offset++) {
+        for (uint16_t len = 0; len <= sizeof(data) - offset; len += 7) {
+            for (size_t accum_len = 0; accum_len < 2; accum_len++) {
+                TEST_ASSERT_EQUAL_INT(
+                    _ref_csum_slice(0x1234, &data[offset], len, accum_len),
+                    inet_csum_slice(0x1234, &data[offset], len, accum_len));
+            }
+        }
+    }
+    /* all bytes 0xff maximize carries */
+    memset(data, 0xff, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(_ref_csum_slice(0xffff, &data[1], 257, 1),
+                          inet_csum_slice(0xffff, &data[1], 257, 1));
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -173,6 +214,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__unaligned_slices),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -18,10 +18,22 @@
 #include "unittests-constants.h"
 #include "tests-netreg.h"
 
+#define MANY_NUMOF   (32U)
+
 static gnrc_netreg_entry_t entries[] = {
     GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16, TEST_UINT8),
     GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16, TEST_UINT8 + 1)
 };
+static gnrc_netreg_entry_t many[MANY_NUMOF];
+
+/* registers an entry per demux context TEST_UINT16 + i, as for many sockets */
+static void _register_many(void)
+{
+    for (unsigned i = 0; i < MANY_NUMOF; i++) {
+        gnrc_netreg_entry_init_pid(&many[i], TEST_UINT16 + i, TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &many[i]));
+    }
+}
 
 static void set_up(void)
 {
@@ -182,6 +194,59 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_lookup__many(void)
+{
+    _register_many();
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 0; i < MANY_NUMOF; i++) {
+        gnrc_netreg_entry_t *res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                      TEST_UINT16 + i);
+
+        TEST_ASSERT(res == &many[i]);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + MANY_NUMOF));
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UNDEF, TEST_UINT16));
+    gnrc_netreg_release_shared();
+}
+
+void test_netreg_unregister__many(void)
+{
+    _register_many();
+    for (unsigned i = 0; i < MANY_NUMOF; i += 2) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[i]);
+    }
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 0; i < MANY_NUMOF; i++) {
+        gnrc_netreg_entry_t *res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                      TEST_UINT16 + i);
+
+        TEST_ASSERT((i % 2) ? (res == &many[i]) : (res == NULL));
+    }
+    gnrc_netreg_release_shared();
+}
+
+void test_netreg_getnext__order(void)
+{
+    gnrc_netreg_entry_t *res;
+
+    /* the entries for TEST_UINT16 are registered between many others */
+    _register_many();
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[0]);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &many[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[1]));
+
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_EQUAL_INT(3, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    /* newest first */
+    TEST_ASSERT((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16)) == &entries[1]);
+    TEST_ASSERT((res = gnrc_netreg_getnext(res)) == &many[0]);
+    TEST_ASSERT((res = gnrc_netreg_getnext(res)) == &entries[0]);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    gnrc_netreg_release_shared();
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -198,6 +263,9 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_lookup__many),
+        new_TestFixture(test_netreg_unregister__many),
+        new_TestFixture(test_netreg_getnext__order),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
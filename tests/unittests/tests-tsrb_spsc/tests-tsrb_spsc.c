@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "tsrb_spsc.h"
+#include "tests-tsrb_spsc.h"
+
+#define TEST_INPUT          (0xdb)
+#define TEST_OFFSET         (5U)
+#define BUFFER_SIZE         (16)
+#define IO_BUFFER_CANARY    (0xb8)
+
+static uint8_t _tsrb_buffer[BUFFER_SIZE];
+static uint8_t _io_buffer[BUFFER_SIZE * 2];
+static tsrb_t _tsrb = TSRB_INIT(_tsrb_buffer);
+
+static void tear_down(void)
+{
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    memset(_tsrb_buffer, 0, sizeof(_tsrb_buffer));
+    tsrb_init(&_tsrb, _tsrb_buffer, BUFFER_SIZE);
+}
+
+/* moves the read and write index so that the next operation wraps around */
+static void _move_to_offset(void)
+{
+    for (unsigned i = 0; i < BUFFER_SIZE - TEST_OFFSET; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_spsc_add_one(&_tsrb, TEST_INPUT));
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_OFFSET,
+                          tsrb_spsc_drop(&_tsrb, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_spsc_empty(&_tsrb));
+}
+
+static void test_avail_free(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, tsrb_spsc_avail(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_spsc_free(&_tsrb));
+
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_spsc_full(&_tsrb));
+        TEST_ASSERT_EQUAL_INT(0, tsrb_spsc_add_one(&_tsrb, TEST_INPUT));
+        TEST_ASSERT_EQUAL_INT(i + 1, tsrb_spsc_avail(&_tsrb));
+        TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - (i + 1), tsrb_spsc_free(&_tsrb));
+    }
+    TEST_ASSERT_EQUAL_INT(1, tsrb_spsc_full(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(-1, tsrb_spsc_add_one(&_tsrb, TEST_INPUT));
+}
+
+static void test_get_one(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, tsrb_spsc_get_one(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_spsc_add_one(&_tsrb, 0xff));
+    /* 0xff must not be confused with -1 */
+    TEST_ASSERT_EQUAL_INT(0xff, tsrb_spsc_get_one(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(-1, tsrb_spsc_get_one(&_tsrb));
+}
+
+static void test_add_get_wrap(void)
+{
+    _move_to_offset();
+
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_spsc_add(&_tsrb, _io_buffer,
+                                                     sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_spsc_full(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_spsc_add(&_tsrb, _io_buffer, 1));
+
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_spsc_peek(&_tsrb, _io_buffer,
+                                                      sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_spsc_avail(&_tsrb));
+
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_spsc_get(&_tsrb, _io_buffer,
+                                                     sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    for (int i = BUFFER_SIZE; i < (int)sizeof(_io_buffer); i++) {
+        TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(1, tsrb_spsc_empty(&_tsrb));
+}
+
+static void test_spans(void)
+{
+    uint8_t *span;
+
+    _move_to_offset();
+
+    /* free space is split at the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(TEST_OFFSET, tsrb_spsc_write_span(&_tsrb, &span));
+    TEST_ASSERT(span == &_tsrb_buffer[BUFFER_SIZE - TEST_OFFSET]);
+    memset(span, TEST_INPUT, TEST_OFFSET);
+    tsrb_spsc_commit_write(&_tsrb, TEST_OFFSET);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_OFFSET,
+                          tsrb_spsc_write_span(&_tsrb, &span));
+    TEST_ASSERT(span == _tsrb_buffer);
+    span[0] = TEST_INPUT + 1;
+    tsrb_spsc_commit_write(&_tsrb, 1);
+    TEST_ASSERT_EQUAL_INT(TEST_OFFSET + 1, tsrb_spsc_avail(&_tsrb));
+
+    /* readable data is split the same way */
+    TEST_ASSERT_EQUAL_INT(TEST_OFFSET, tsrb_spsc_peek_span(&_tsrb, &span));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, span[TEST_OFFSET - 1]);
+    tsrb_spsc_commit_read(&_tsrb, TEST_OFFSET);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_spsc_peek_span(&_tsrb, &span));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + 1, span[0]);
+    tsrb_spsc_commit_read(&_tsrb, 1);
+    TEST_ASSERT_EQUAL_INT(0, tsrb_spsc_peek_span(&_tsrb, &span));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_spsc_empty(&_tsrb));
+}
+
+static Test *tests_tsrb_spsc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_avail_free),
+        new_TestFixture(test_get_one),
+        new_TestFixture(test_add_get_wrap),
+        new_TestFixture(test_spans),
+    };
+
+    EMB_UNIT_TESTCALLER(tsrb_spsc_tests, NULL, tear_down, fixtures);
+
+    return (Test *)&tsrb_spsc_tests;
+}
+
+void tests_tsrb_spsc(void)
+{
+    TESTS_RUN(tests_tsrb_spsc_tests());
+}
+/** @} */
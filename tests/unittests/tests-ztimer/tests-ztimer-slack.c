@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for coalescing ztimer timers with slack
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#if IS_USED(MODULE_ZTIMER_SLACK)
+
+static void cb_incr(void *arg)
+{
+    uint32_t *ptr = arg;
+    *ptr += 1;
+}
+
+/**
+ * @brief   Testing timers firing together within their slack
+ */
+static void test_ztimer_slack_coalesce(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_slack_stats_t stats;
+    uint32_t count[3] = { 0 };
+    ztimer_t alarms[3] = {
+        { .callback = cb_incr, .arg = &count[0], },
+        { .callback = cb_incr, .arg = &count[1], },
+        { .callback = cb_incr, .arg = &count[2], },
+    };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_set_with_slack(z, &alarms[0], 100, 50);
+    ztimer_set_with_slack(z, &alarms[1], 120, 50);
+    ztimer_set(z, &alarms[2], 200);
+
+    /* alarm 0 may fire until 150, alarm 1 is due by then */
+    ztimer_mock_advance(&zmock, 99);
+    TEST_ASSERT_EQUAL_INT(0, count[0]);
+    TEST_ASSERT_EQUAL_INT(0, count[1]);
+    ztimer_mock_advance(&zmock, 51);
+    TEST_ASSERT_EQUAL_INT(1, count[0]);
+    TEST_ASSERT_EQUAL_INT(1, count[1]);
+    TEST_ASSERT_EQUAL_INT(0, count[2]);
+
+    /* no slack, fires exactly */
+    ztimer_mock_advance(&zmock, 49);
+    TEST_ASSERT_EQUAL_INT(0, count[2]);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count[2]);
+
+    ztimer_slack_stats(z, &stats);
+    TEST_ASSERT_EQUAL_INT(2, stats.fired);
+    TEST_ASSERT_EQUAL_INT(1, stats.coalesced);
+}
+
+/**
+ * @brief   Testing that a timer without slack is not delayed
+ */
+static void test_ztimer_slack_exact(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_slack_stats_t stats;
+    uint32_t count[2] = { 0 };
+    ztimer_t alarms[2] = {
+        { .callback = cb_incr, .arg = &count[0], },
+        { .callback = cb_incr, .arg = &count[1], },
+    };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_set_with_slack(z, &alarms[0], 90, 50);
+    ztimer_set(z, &alarms[1], 100);
+
+    ztimer_mock_advance(&zmock, 99);
+    TEST_ASSERT_EQUAL_INT(0, count[0]);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count[0]);
+    TEST_ASSERT_EQUAL_INT(1, count[1]);
+
+    ztimer_slack_stats(z, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.fired);
+    TEST_ASSERT_EQUAL_INT(1, stats.coalesced);
+}
+
+/**
+ * @brief   Testing that removing and resetting timers moves the alarm
+ */
+static void test_ztimer_slack_remove(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count[2] = { 0 };
+    ztimer_t alarms[2] = {
+        { .callback = cb_incr, .arg = &count[0], },
+        { .callback = cb_incr, .arg = &count[1], },
+    };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_set_with_slack(z, &alarms[0], 100, 100);
+    ztimer_set(z, &alarms[1], 150);
+    /* without the timer due at 150, alarm 0 may fire until 200 */
+    ztimer_remove(z, &alarms[1]);
+    ztimer_mock_advance(&zmock, 199);
+    TEST_ASSERT_EQUAL_INT(0, count[0]);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count[0]);
+
+    /* setting a timer again with ztimer_set() drops the slack */
+    ztimer_set_with_slack(z, &alarms[0], 100, 100);
+    ztimer_set(z, &alarms[0], 100);
+    ztimer_mock_advance(&zmock, 100);
+    TEST_ASSERT_EQUAL_INT(2, count[0]);
+    TEST_ASSERT_EQUAL_INT(0, count[1]);
+}
+
+Test *tests_ztimer_slack_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_slack_coalesce),
+        new_TestFixture(test_ztimer_slack_exact),
+        new_TestFixture(test_ztimer_slack_remove),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+#endif /* IS_USED(MODULE_ZTIMER_SLACK) */
+
+/** @} */
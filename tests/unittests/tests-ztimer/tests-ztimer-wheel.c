@@ -0,0 +1,290 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT Developers
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for storing ztimer timers in the timing wheel
+ */
+
+#include <string.h>
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#if IS_USED(MODULE_ZTIMER_WHEEL)
+
+static void cb_incr(void *arg)
+{
+    uint32_t *ptr = arg;
+    *ptr += 1;
+}
+
+static bool _in_wheel(const ztimer_clock_t *z, const ztimer_t *t)
+{
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        for (unsigned slot = 0; slot < ZTIMER_WHEEL_SLOTS; slot++) {
+            for (const ztimer_base_t *entry = z->wheel.slots[level][slot];
+                 entry; entry = entry->next) {
+                if (entry == &t->base) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/* fills the sorted list with timers far in the future, so that all
+ * following timers outside of the near window go into the wheel */
+static void _fill_list(ztimer_clock_t *z, ztimer_t *fill, uint32_t *count)
+{
+    for (unsigned i = 0; i < CONFIG_ZTIMER_WHEEL_LIST_LEN; i++) {
+        fill[i] = (ztimer_t){ .callback = cb_incr, .arg = count };
+        ztimer_set(z, &fill[i], UINT32_MAX);
+    }
+}
+
+/**
+ * @brief   Testing timers stored in slots on several levels fire in order
+ *          and at the exact tick
+ */
+static void test_ztimer_wheel_slots(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t fill[CONFIG_ZTIMER_WHEEL_LIST_LEN];
+    uint32_t fill_count = 0;
+    uint32_t count[4] = { 0 };
+    const uint32_t vals[] = { 200, 5000, 300000, 50000000 };
+    ztimer_t alarms[ARRAY_SIZE(vals)];
+
+    ztimer_mock_init(&zmock, 32);
+    _fill_list(z, fill, &fill_count);
+
+    /* set in reverse order so the earliest timer is not the first one set */
+    for (unsigned i = ARRAY_SIZE(vals); i-- > 0;) {
+        alarms[i] = (ztimer_t){ .callback = cb_incr, .arg = &count[i] };
+        ztimer_set(z, &alarms[i], vals[i]);
+        TEST_ASSERT(_in_wheel(z, &alarms[i]));
+        TEST_ASSERT(ztimer_is_set(z, &alarms[i]));
+    }
+
+    /* the alarm is set for the earliest timer, not for its slot */
+    TEST_ASSERT(zmock.armed);
+    TEST_ASSERT_EQUAL_INT(vals[0], zmock.target);
+
+    uint32_t now = 0;
+    for (unsigned i = 0; i < ARRAY_SIZE(vals); i++) {
+        ztimer_mock_advance(&zmock, vals[i] - 1 - now);
+        TEST_ASSERT_EQUAL_INT(0, count[i]);
+        ztimer_mock_advance(&zmock, 1);
+        now = vals[i];
+        for (unsigned j = 0; j < ARRAY_SIZE(vals); j++) {
+            TEST_ASSERT_EQUAL_INT(j <= i, count[j]);
+        }
+        TEST_ASSERT(!ztimer_is_set(z, &alarms[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(0, fill_count);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(fill); i++) {
+        TEST_ASSERT(ztimer_remove(z, &fill[i]));
+    }
+    TEST_ASSERT(!zmock.armed);
+}
+
+/**
+ * @brief   Testing removal of timers from a slot and of timers already
+ *          cascaded from the wheel into the list
+ */
+static void test_ztimer_wheel_remove(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t fill[CONFIG_ZTIMER_WHEEL_LIST_LEN];
+    uint32_t fill_count = 0;
+    uint32_t count[3] = { 0 };
+    ztimer_t alarms[3] = {
+        { .callback = cb_incr, .arg = &count[0], },
+        { .callback = cb_incr, .arg = &count[1], },
+        { .callback = cb_incr, .arg = &count[2], },
+    };
+
+    ztimer_mock_init(&zmock, 32);
+    _fill_list(z, fill, &fill_count);
+
+    /* all three share one slot */
+    ztimer_set(z, &alarms[0], 1000);
+    ztimer_set(z, &alarms[1], 1010);
+    ztimer_set(z, &alarms[2], 1020);
+    TEST_ASSERT(_in_wheel(z, &alarms[1]));
+
+    /* removing from the middle of the slot keeps the others */
+    TEST_ASSERT(ztimer_remove(z, &alarms[2]));
+    TEST_ASSERT(!ztimer_is_set(z, &alarms[2]));
+    TEST_ASSERT(!ztimer_remove(z, &alarms[2]));
+
+    /* firing the first timer cascades the second one into the list */
+    ztimer_mock_advance(&zmock, 1000);
+    TEST_ASSERT_EQUAL_INT(1, count[0]);
+    TEST_ASSERT(!_in_wheel(z, &alarms[1]));
+    TEST_ASSERT(ztimer_is_set(z, &alarms[1]));
+    TEST_ASSERT_EQUAL_INT(10, zmock.target);
+
+    TEST_ASSERT(ztimer_remove(z, &alarms[1]));
+    TEST_ASSERT(!ztimer_is_set(z, &alarms[1]));
+    ztimer_mock_advance(&zmock, 100);
+    TEST_ASSERT_EQUAL_INT(1, count[0]);
+    TEST_ASSERT_EQUAL_INT(0, count[1]);
+    TEST_ASSERT_EQUAL_INT(0, count[2]);
+
+    /* the list is sorted and the alarm is set for the fillers only */
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX - 1100, zmock.target);
+    for (unsigned i = 0; i < ARRAY_SIZE(fill); i++) {
+        TEST_ASSERT(ztimer_remove(z, &fill[i]));
+    }
+    TEST_ASSERT(!zmock.armed);
+    TEST_ASSERT_EQUAL_INT(0, fill_count);
+}
+
+/**
+ * @brief   Testing that removing the earliest timer in the wheel does not
+ *          delay the next one
+ */
+static void test_ztimer_wheel_remove_next(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t fill[CONFIG_ZTIMER_WHEEL_LIST_LEN];
+    uint32_t fill_count = 0;
+    uint32_t count[2] = { 0 };
+    ztimer_t alarms[2] = {
+        { .callback = cb_incr, .arg = &count[0], },
+        { .callback = cb_incr, .arg = &count[1], },
+    };
+
+    ztimer_mock_init(&zmock, 32);
+    _fill_list(z, fill, &fill_count);
+
+    ztimer_set(z, &alarms[0], 500);
+    ztimer_set(z, &alarms[1], 3000);
+    TEST_ASSERT_EQUAL_INT(500, zmock.target);
+    TEST_ASSERT(ztimer_remove(z, &alarms[0]));
+
+    ztimer_mock_advance(&zmock, 2999);
+    TEST_ASSERT_EQUAL_INT(0, count[1]);
+    TEST_ASSERT_EQUAL_INT(1, zmock.target);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(0, count[0]);
+    TEST_ASSERT_EQUAL_INT(1, count[1]);
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX - 3000, zmock.target);
+}
+
+/**
+ * @brief   Testing timers whose target wraps around the 32bit time
+ */
+static void test_ztimer_wheel_wrap(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t fill[CONFIG_ZTIMER_WHEEL_LIST_LEN];
+    uint32_t fill_count = 0;
+    uint32_t count[3] = { 0 };
+    const uint32_t vals[] = { 300, 70000, 0xf0000000 };
+    ztimer_t alarms[ARRAY_SIZE(vals)];
+
+    ztimer_mock_init(&zmock, 32);
+    /* start shortly before the 32bit time wraps around */
+    ztimer_mock_jump(&zmock, UINT32_MAX - 100);
+    _fill_list(z, fill, &fill_count);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(vals); i++) {
+        alarms[i] = (ztimer_t){ .callback = cb_incr, .arg = &count[i] };
+        ztimer_set(z, &alarms[i], vals[i]);
+        TEST_ASSERT(_in_wheel(z, &alarms[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(vals[0], zmock.target);
+
+    uint32_t now = 0;
+    for (unsigned i = 0; i < ARRAY_SIZE(vals); i++) {
+        ztimer_mock_advance(&zmock, vals[i] - 1 - now);
+        TEST_ASSERT_EQUAL_INT(0, count[i]);
+        ztimer_mock_advance(&zmock, 1);
+        TEST_ASSERT_EQUAL_INT(1, count[i]);
+        now = vals[i];
+    }
+
+    /* the fillers have wrapped around as well */
+    ztimer_mock_advance(&zmock, UINT32_MAX - 1 - now);
+    TEST_ASSERT_EQUAL_INT(0, fill_count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(CONFIG_ZTIMER_WHEEL_LIST_LEN, fill_count);
+}
+
+/**
+ * @brief   Testing that setting a timer that was never initialized does not
+ *          corrupt the timers stored in the wheel
+ */
+static void test_ztimer_wheel_uninitialized(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t fill[CONFIG_ZTIMER_WHEEL_LIST_LEN];
+    uint32_t fill_count = 0;
+    uint32_t count[2] = { 0 };
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count[0] };
+    ztimer_t garbage;
+
+    ztimer_mock_init(&zmock, 32);
+    _fill_list(z, fill, &fill_count);
+    ztimer_set(z, &alarm, 5000);
+    TEST_ASSERT(_in_wheel(z, &alarm));
+
+    /* like a timer on the stack: the pointers are garbage and the offset
+     * maps to the slot of the timer already stored */
+    memset(&garbage, 0xa5, sizeof(garbage));
+    garbage.base.offset = 5000;
+    garbage.callback = cb_incr;
+    garbage.arg = &count[1];
+    ztimer_set(z, &garbage, 4000);
+    TEST_ASSERT(ztimer_is_set(z, &garbage));
+    TEST_ASSERT(_in_wheel(z, &alarm));
+
+    ztimer_mock_advance(&zmock, 4000);
+    TEST_ASSERT_EQUAL_INT(0, count[0]);
+    TEST_ASSERT_EQUAL_INT(1, count[1]);
+    ztimer_mock_advance(&zmock, 1000);
+    TEST_ASSERT_EQUAL_INT(1, count[0]);
+    TEST_ASSERT_EQUAL_INT(1, count[1]);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(fill); i++) {
+        TEST_ASSERT(ztimer_remove(z, &fill[i]));
+    }
+    TEST_ASSERT(!zmock.armed);
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_slots),
+        new_TestFixture(test_ztimer_wheel_remove),
+        new_TestFixture(test_ztimer_wheel_remove_next),
+        new_TestFixture(test_ztimer_wheel_wrap),
+        new_TestFixture(test_ztimer_wheel_uninitialized),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+#endif /* IS_USED(MODULE_ZTIMER_WHEEL) */
+
+/** @} */
@@ -13,17 +13,26 @@
  */
 
 #include "embUnit/embUnit.h"
+#include "modules.h"
 
 #include "tests-ztimer.h"
 
 Test *tests_ztimer_mock_tests(void);
 Test *tests_ztimer_convert_muldiv64_tests(void);
 Test *tests_ztimer_ondemand_tests(void);
+Test *tests_ztimer_slack_tests(void);
+Test *tests_ztimer_wheel_tests(void);
 
 void tests_ztimer(void)
 {
     TESTS_RUN(tests_ztimer_mock_tests());
     TESTS_RUN(tests_ztimer_convert_muldiv64_tests());
     TESTS_RUN(tests_ztimer_ondemand_tests());
+#if IS_USED(MODULE_ZTIMER_SLACK)
+    TESTS_RUN(tests_ztimer_slack_tests());
+#endif
+#if IS_USED(MODULE_ZTIMER_WHEEL)
+    TESTS_RUN(tests_ztimer_wheel_tests());
+#endif
 }
 /** @} */